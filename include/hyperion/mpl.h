@@ -49,5 +49,29 @@
 #include <hyperion/mpl/metapredicates.h>
 //
 #include <hyperion/mpl/list.h>
+//
+#include <hyperion/mpl/spsc_queue.h>
+#include <hyperion/mpl/pipeline.h>
+#include <hyperion/mpl/when_all.h>
+#include <hyperion/mpl/thread_pool.h>
+#include <hyperion/mpl/search_table.h>
+#include <hyperion/mpl/lut.h>
+#include <hyperion/mpl/aggregate_hash.h>
+#include <hyperion/mpl/fixed_string.h>
+#include <hyperion/mpl/radix_sort.h>
+#include <hyperion/mpl/record.h>
+#include <hyperion/mpl/hot_cold.h>
+#include <hyperion/mpl/concurrent_layout.h>
+#include <hyperion/mpl/sharded_counters.h>
+#include <hyperion/mpl/mpsc_queue.h>
+#include <hyperion/mpl/event_bus.h>
+#include <hyperion/mpl/inplace_function.h>
+#include <hyperion/mpl/static_vector.h>
+#include <hyperion/mpl/flat_map.h>
+#include <hyperion/mpl/injector.h>
+#include <hyperion/mpl/options.h>
+#include <hyperion/mpl/json.h>
+#include <hyperion/mpl/delta.h>
+#include <hyperion/mpl/record_batch.h>
 
 #endif // HYPERION_MPL_H
@@ -0,0 +1,455 @@
+/// @file aggregate_hash.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Generated equality and hash function objects for `List`-described aggregates
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/type.h>
+#include <hyperion/mpl/value.h>
+
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <type_traits>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup aggregate_hash Aggregate Equality and Hashing
+/// Hyperion provides `mpl::aggregate_equal` and `mpl::aggregate_hash` for generating
+/// equality and hash function objects for aggregates, given an `mpl::List` of `mpl::Value`s
+/// of pointers to the aggregate's fields.
+///
+/// When the fields cover every byte of the aggregate and the aggregate has unique object
+/// representations (i.e. it has no padding and no floating point fields), equality is a
+/// single `std::memcmp` and the hash is a single pass of a wide, multiply-mix byte hash
+/// over the object. Otherwise, both fall back to combining the fields one at a time.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/aggregate_hash.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// struct cache_key {
+///     u64 tenant;
+///     u32 shard;
+///     u32 kind;
+/// };
+///
+/// using cache_key_fields
+///     = List<Value<&cache_key::tenant>, Value<&cache_key::shard>, Value<&cache_key::kind>>;
+///
+/// // equality and hashing of `cache_key` are both bytewise
+/// auto cache = std::unordered_set<cache_key,
+///                                 aggregate_hash<cache_key_fields>,
+///                                 aggregate_equal<cache_key_fields>>{};
+/// @endcode
+/// @headerfile hyperion/mpl/aggregate_hash.h
+/// @}
+
+#ifndef HYPERION_MPL_AGGREGATE_HASH_H
+    #define HYPERION_MPL_AGGREGATE_HASH_H
+
+namespace hyperion::mpl {
+
+    namespace detail {
+        template<typename TMember>
+        struct field_pointer_traits;
+
+        template<typename TField, typename TAggregate>
+        struct field_pointer_traits<TField TAggregate::*> {
+            using aggregate_type = TAggregate;
+            using field_type = TField;
+        };
+
+        template<auto TMember>
+        using field_aggregate_t =
+            typename field_pointer_traits<std::remove_cv_t<decltype(TMember)>>::aggregate_type;
+
+        template<auto TMember>
+        using field_t =
+            typename field_pointer_traits<std::remove_cv_t<decltype(TMember)>>::field_type;
+
+        template<auto TFirst, auto... TRest>
+        static inline constexpr auto first_field = TFirst;
+
+        /// @brief Returns whether `TLhs` and `TRhs` point to the same data member
+        template<auto TLhs, auto TRhs>
+        [[nodiscard]] constexpr auto same_field() noexcept -> bool {
+            if constexpr(std::same_as<decltype(TLhs), decltype(TRhs)>) {
+                return TLhs == TRhs;
+            }
+            else {
+                return false;
+            }
+        }
+
+        /// @brief The number of `TMembers` that point to the same data member as `TMember`
+        template<auto TMember, auto... TMembers>
+        static inline constexpr auto field_count
+            = (static_cast<usize>(same_field<TMember, TMembers>()) + ...);
+
+        /// @brief Whether no data member is pointed to by more than one of `TMembers`
+        template<auto... TMembers>
+        static inline constexpr auto distinct_fields
+            = ((field_count<TMembers, TMembers...> == 1_usize) && ...);
+
+        /// @brief Requires that `TMembers` is a non-empty set of pointers to distinct data
+        /// members of the same class
+        template<auto... TMembers>
+        concept field_pointers
+            = sizeof...(TMembers) != 0
+              && (std::is_member_object_pointer_v<decltype(TMembers)> && ...)
+              && (std::same_as<field_aggregate_t<TMembers>,
+                               field_aggregate_t<first_field<TMembers...>>>
+                  && ...)
+              && distinct_fields<TMembers...>;
+
+        static inline constexpr u64 hash_secret0 = 0xa0761d6478bd642f_u64;
+        static inline constexpr u64 hash_secret1 = 0xe7037ed1a0b428db_u64;
+        static inline constexpr u64 hash_secret2 = 0x8ebc6af09c88c6e3_u64;
+        static inline constexpr u64 hash_secret3 = 0x589965cc75374cc3_u64;
+
+        /// @brief Multiplies `lhs` and `rhs` into a 128-bit product, returning the
+        /// exclusive-or of its halves
+        [[nodiscard]] inline auto hash_mix(u64 lhs, u64 rhs) noexcept -> u64 {
+    #if HYPERION_PLATFORM_COMPILER_IS_CLANG || HYPERION_PLATFORM_COMPILER_IS_GCC
+            __extension__ using u128 = unsigned __int128;
+            const auto product = static_cast<u128>(lhs) * rhs;
+            return static_cast<u64>(product) ^ static_cast<u64>(product >> 64_u32);
+    #else
+            const auto lhs_high = lhs >> 32_u32;
+            const auto lhs_low = lhs & 0xFFFF'FFFF_u64;
+            const auto rhs_high = rhs >> 32_u32;
+            const auto rhs_low = rhs & 0xFFFF'FFFF_u64;
+            const auto high_high = lhs_high * rhs_high;
+            const auto high_low = lhs_high * rhs_low;
+            const auto low_high = lhs_low * rhs_high;
+            const auto low_low = lhs_low * rhs_low;
+            const auto middle = (low_low >> 32_u32) + (high_low & 0xFFFF'FFFF_u64)
+                                + (low_high & 0xFFFF'FFFF_u64);
+            const auto low = (middle << 32_u32) | (low_low & 0xFFFF'FFFF_u64);
+            const auto high = high_high + (high_low >> 32_u32) + (low_high >> 32_u32)
+                              + (middle >> 32_u32);
+            return low ^ high;
+    #endif // HYPERION_PLATFORM_COMPILER_IS_CLANG || HYPERION_PLATFORM_COMPILER_IS_GCC
+        }
+
+        template<typename TInteger>
+        [[nodiscard]] inline auto
+        hash_read(std::span<const std::byte> bytes, usize offset) noexcept -> u64 {
+            auto value = TInteger{};
+            std::memcpy(&value, bytes.subspan(offset, sizeof(TInteger)).data(), sizeof(TInteger));
+            return static_cast<u64>(value);
+        }
+
+        /// @brief Hashes `bytes`, 16 at a time, in the style of wyhash
+        [[nodiscard]] inline auto
+        hash_bytes(std::span<const std::byte> bytes, u64 seed = 0_u64) noexcept -> u64 {
+            const auto size = bytes.size();
+            seed ^= hash_mix(seed ^ hash_secret0, hash_secret1);
+
+            auto first = 0_u64;
+            auto second = 0_u64;
+            if(size <= 16_usize) {
+                if(size >= 4_usize) {
+                    const auto offset = (size >> 3_u32) << 2_u32;
+                    first = (hash_read<u32>(bytes, 0_usize) << 32_u32)
+                            | hash_read<u32>(bytes, offset);
+                    second = (hash_read<u32>(bytes, size - 4_usize) << 32_u32)
+                             | hash_read<u32>(bytes, size - 4_usize - offset);
+                }
+                else if(size > 0_usize) {
+                    first = (hash_read<u8>(bytes, 0_usize) << 16_u32)
+                            | (hash_read<u8>(bytes, size >> 1_u32) << 8_u32)
+                            | hash_read<u8>(bytes, size - 1_usize);
+                }
+            }
+            else {
+                auto offset = 0_usize;
+                auto remaining = size;
+                if(remaining > 48_usize) {
+                    auto lane1 = seed;
+                    auto lane2 = seed;
+                    do {
+                        seed = hash_mix(hash_read<u64>(bytes, offset) ^ hash_secret1,
+                                        hash_read<u64>(bytes, offset + 8_usize) ^ seed);
+                        lane1 = hash_mix(hash_read<u64>(bytes, offset + 16_usize) ^ hash_secret2,
+                                         hash_read<u64>(bytes, offset + 24_usize) ^ lane1);
+                        lane2 = hash_mix(hash_read<u64>(bytes, offset + 32_usize) ^ hash_secret3,
+                                         hash_read<u64>(bytes, offset + 40_usize) ^ lane2);
+                        offset += 48_usize;
+                        remaining -= 48_usize;
+                    } while(remaining > 48_usize);
+                    seed ^= lane1 ^ lane2;
+                }
+
+                while(remaining > 16_usize) {
+                    seed = hash_mix(hash_read<u64>(bytes, offset) ^ hash_secret1,
+                                    hash_read<u64>(bytes, offset + 8_usize) ^ seed);
+                    offset += 16_usize;
+                    remaining -= 16_usize;
+                }
+
+                first = hash_read<u64>(bytes, size - 16_usize);
+                second = hash_read<u64>(bytes, size - 8_usize);
+            }
+
+            return hash_mix(hash_secret1 ^ static_cast<u64>(size),
+                            hash_mix(first ^ hash_secret1, second ^ seed));
+        }
+
+        /// @brief Hashes the bytes of `value`
+        template<typename TType>
+        [[nodiscard]] inline auto hash_object(const TType& value, u64 seed = 0_u64) noexcept
+            -> u64 {
+            return hash_bytes(std::as_bytes(std::span{&value, 1_usize}), seed);
+        }
+
+        template<typename TType>
+        concept std_hashable = requires(const TType& value) {
+            { std::hash<TType>{}(value) } -> std::convertible_to<usize>;
+        };
+
+        template<typename TField>
+        concept aggregate_hashable_field
+            = (decltype_<TField>().has_unique_object_representations().value)
+              || std_hashable<TField>;
+
+        /// @brief Whether the fields `TMembers` cover every byte of their aggregate, and that
+        /// aggregate's value is fully determined by its bytes
+        template<auto... TMembers>
+        static inline constexpr auto is_bytewise_aggregate
+            = decltype_<field_aggregate_t<first_field<TMembers...>>>()
+                  .has_unique_object_representations()
+                  .value
+              && (decltype_<field_t<TMembers>>().sizeof_() + ...)
+                     == decltype_<field_aggregate_t<first_field<TMembers...>>>().sizeof_();
+    } // namespace detail
+
+    /// @brief `aggregate_equal` is a function object comparing two aggregates for equality,
+    /// generated from a `List` of `Value`s of pointers to the aggregate's fields.
+    ///
+    /// If the listed fields cover every byte of the aggregate and the aggregate has unique
+    /// object representations, two aggregates are compared with a single `std::memcmp`.
+    /// Otherwise, they are compared field by field with `==`, in the order of the `List`.
+    ///
+    /// # Requirements
+    /// - `TFields` must be an `mpl::List` of `mpl::Value`s of pointers to data members of the
+    /// same class
+    /// - Each field must be equality comparable
+    /// - Each field must be listed at most once
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// struct key {
+    ///     u32 first;
+    ///     u32 second;
+    /// };
+    ///
+    /// using key_equal = aggregate_equal<List<Value<&key::first>, Value<&key::second>>>;
+    /// static_assert(key_equal::is_bytewise);
+    ///
+    /// // `equal` is `true`
+    /// auto equal = key_equal{}(key{1, 2}, key{1, 2});
+    /// @endcode
+    ///
+    /// @tparam TFields The `List` of fields to compare
+    /// @ingroup aggregate_hash
+    /// @headerfile hyperion/mpl/aggregate_hash.h
+    template<typename TFields>
+    struct aggregate_equal;
+
+    template<auto... TMembers, typename... TTypes>
+        requires detail::field_pointers<TMembers...>
+                 && (std::equality_comparable<detail::field_t<TMembers>> && ...)
+    struct aggregate_equal<List<Value<TMembers, TTypes>...>> {
+        /// @brief The type of the aggregates compared by this `aggregate_equal`
+        using aggregate_type = detail::field_aggregate_t<detail::first_field<TMembers...>>;
+
+        /// @brief Whether this `aggregate_equal` compares aggregates with a single
+        /// `std::memcmp`
+        static inline constexpr auto is_bytewise = detail::is_bytewise_aggregate<TMembers...>;
+
+        /// @brief Returns whether `lhs` and `rhs` are equal
+        ///
+        /// @param lhs The left-hand aggregate to compare
+        /// @param rhs The right-hand aggregate to compare
+        /// @return whether every listed field of `lhs` is equal to that of `rhs`
+        [[nodiscard]] auto
+        operator()(const aggregate_type& lhs, const aggregate_type& rhs) const noexcept -> bool {
+            if constexpr(is_bytewise) {
+                return std::memcmp(&lhs, &rhs, sizeof(aggregate_type)) == 0;
+            }
+            else {
+                return ((lhs.*TMembers == rhs.*TMembers) && ...);
+            }
+        }
+    };
+
+    /// @brief `aggregate_hash` is a function object hashing an aggregate, generated from a
+    /// `List` of `Value`s of pointers to the aggregate's fields.
+    ///
+    /// If the listed fields cover every byte of the aggregate and the aggregate has unique
+    /// object representations, the aggregate is hashed with a single pass of a wide,
+    /// multiply-mix byte hash over the object. Otherwise, each field is hashed in the order
+    /// of the `List` and combined: fields with unique object representations are hashed
+    /// bytewise, and any other fields with `std::hash`.
+    ///
+    /// `aggregate_hash<TFields>` is consistent with `aggregate_equal<TFields>`.
+    ///
+    /// # Requirements
+    /// - `TFields` must be an `mpl::List` of `mpl::Value`s of pointers to data members of the
+    /// same class
+    /// - Each field must either have unique object representations, or be hashable with
+    /// `std::hash`
+    /// - Each field must be listed at most once
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// struct key {
+    ///     u32 first;
+    ///     float second;
+    /// };
+    ///
+    /// using key_hash = aggregate_hash<List<Value<&key::first>, Value<&key::second>>>;
+    /// // `float` does not have unique object representations
+    /// static_assert(not key_hash::is_bytewise);
+    ///
+    /// auto hash = key_hash{}(key{1, 2.0F});
+    /// @endcode
+    ///
+    /// @tparam TFields The `List` of fields to hash
+    /// @ingroup aggregate_hash
+    /// @headerfile hyperion/mpl/aggregate_hash.h
+    template<typename TFields>
+    struct aggregate_hash;
+
+    template<auto... TMembers, typename... TTypes>
+        requires detail::field_pointers<TMembers...>
+                 && (detail::aggregate_hashable_field<detail::field_t<TMembers>> && ...)
+    struct aggregate_hash<List<Value<TMembers, TTypes>...>> {
+        /// @brief The type of the aggregates hashed by this `aggregate_hash`
+        using aggregate_type = detail::field_aggregate_t<detail::first_field<TMembers...>>;
+
+        /// @brief Whether this `aggregate_hash` hashes aggregates with a single pass over
+        /// their bytes
+        static inline constexpr auto is_bytewise = detail::is_bytewise_aggregate<TMembers...>;
+
+        /// @brief Returns the hash of `value`
+        ///
+        /// @param value The aggregate to hash
+        /// @return the hash of the listed fields of `value`
+        [[nodiscard]] auto operator()(const aggregate_type& value) const noexcept -> usize {
+            if constexpr(is_bytewise) {
+                return static_cast<usize>(detail::hash_object(value));
+            }
+            else {
+                auto seed = 0_u64;
+                ((seed = hash_field(value.*TMembers, seed)), ...);
+                return static_cast<usize>(seed);
+            }
+        }
+
+      private:
+        template<typename TField>
+        [[nodiscard]] static auto hash_field(const TField& field, u64 seed) noexcept -> u64 {
+            if constexpr(decltype_<TField>().has_unique_object_representations()) {
+                return detail::hash_object(field, seed);
+            }
+            else {
+                const auto hash = static_cast<u64>(std::hash<TField>{}(field));
+                return detail::hash_mix(seed ^ detail::hash_secret0, hash ^ detail::hash_secret1);
+            }
+        }
+    };
+
+    namespace _test::aggregate_hash {
+        struct packed {
+            u64 first;
+            u32 second;
+            u32 third;
+        };
+
+        struct padded {
+            u8 first;
+            u32 second;
+        };
+
+        struct with_float {
+            u32 first;
+            float second;
+        };
+
+        using packed_fields
+            = List<Value<&packed::first>, Value<&packed::second>, Value<&packed::third>>;
+        using partial_fields = List<Value<&packed::first>, Value<&packed::second>>;
+        using padded_fields = List<Value<&padded::first>, Value<&padded::second>>;
+        using with_float_fields = List<Value<&with_float::first>, Value<&with_float::second>>;
+
+        template<typename TFields>
+        concept valid_fields = requires {
+            typename mpl::aggregate_equal<TFields>::aggregate_type;
+            typename mpl::aggregate_hash<TFields>::aggregate_type;
+        };
+
+        static_assert(mpl::aggregate_equal<packed_fields>::is_bytewise,
+                      "hyperion::mpl::aggregate_equal test case 1 (failing)");
+        static_assert(not mpl::aggregate_equal<partial_fields>::is_bytewise,
+                      "hyperion::mpl::aggregate_equal test case 2 (failing)");
+        static_assert(not mpl::aggregate_equal<padded_fields>::is_bytewise,
+                      "hyperion::mpl::aggregate_equal test case 3 (failing)");
+        static_assert(not mpl::aggregate_equal<with_float_fields>::is_bytewise,
+                      "hyperion::mpl::aggregate_equal test case 4 (failing)");
+
+        static_assert(mpl::aggregate_hash<packed_fields>::is_bytewise,
+                      "hyperion::mpl::aggregate_hash test case 1 (failing)");
+        static_assert(not mpl::aggregate_hash<with_float_fields>::is_bytewise,
+                      "hyperion::mpl::aggregate_hash test case 2 (failing)");
+
+        static_assert(valid_fields<packed_fields>,
+                      "hyperion::mpl::aggregate_hash requirements test case 1 (failing)");
+        static_assert(not valid_fields<List<>>,
+                      "hyperion::mpl::aggregate_hash requirements test case 2 (failing)");
+        static_assert(not valid_fields<List<int, double>>,
+                      "hyperion::mpl::aggregate_hash requirements test case 3 (failing)");
+        static_assert(
+            not valid_fields<List<Value<&packed::first>, Value<&padded::first>>>,
+            "hyperion::mpl::aggregate_hash requirements test case 4 (failing)");
+        // the sizes of `first`, `second` and `second` sum to the size of `packed`, but
+        // `third` is not covered
+        static_assert(
+            not valid_fields<
+                List<Value<&packed::first>, Value<&packed::second>, Value<&packed::second>>>,
+            "hyperion::mpl::aggregate_hash requirements test case 5 (failing)");
+    } // namespace _test::aggregate_hash
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_AGGREGATE_HASH_H
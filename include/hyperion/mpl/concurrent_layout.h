@@ -0,0 +1,424 @@
+/// @file concurrent_layout.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Cache-line interference sizes and false-sharing-free struct layouts
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/metatypes.h>
+#include <hyperion/mpl/pair.h>
+#include <hyperion/mpl/record.h>
+#include <hyperion/mpl/value.h>
+
+#include <array>
+#include <atomic>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup concurrent_layout Concurrent Layouts
+/// Hyperion provides `mpl::hardware_destructive_interference_size` and
+/// `mpl::hardware_constructive_interference_size` as stable, portable equivalents of the
+/// similarly named `std` constants, and `mpl::concurrent_layout` for generating a struct
+/// whose members are written by different groups of threads without false sharing.
+///
+/// A `concurrent_layout` is described by an `mpl::List` of `mpl::Pair`s of member types and
+/// `mpl::Value`s naming the writer group of each member. Members of the same writer group are
+/// packed tightly together, and each writer group is placed on its own cache line(s), so that
+/// writes from one group never invalidate the lines read or written by another.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/concurrent_layout.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// using stats = concurrent_layout<List<Pair<std::atomic<u64>, Value<0>>,  // producer
+///                                      Pair<std::atomic<u64>, Value<1>>,  // consumer
+///                                      Pair<u64, Value<0>>>>;             // producer
+///
+/// auto counters = stats{};
+/// counters.get<0>().fetch_add(1, std::memory_order_relaxed);
+/// counters.get<1>().fetch_add(1, std::memory_order_relaxed);
+/// static_assert(stats::group_count() == 2);
+/// @endcode
+/// @headerfile hyperion/mpl/concurrent_layout.h
+/// @}
+
+#ifndef HYPERION_MPL_CONCURRENT_LAYOUT_H
+    #define HYPERION_MPL_CONCURRENT_LAYOUT_H
+
+namespace hyperion::mpl {
+
+    /// @brief The minimum offset between two objects required to avoid false sharing.
+    ///
+    /// Unlike `std::hardware_destructive_interference_size`, this is fixed per target
+    /// architecture rather than per compiler invocation, so it is safe to use in ABI-visible
+    /// layouts. On x86-64 and AArch64 it is two cache lines, because the adjacent-line
+    /// (or spatial) prefetchers on those architectures fetch cache lines in pairs.
+    /// @ingroup concurrent_layout
+    /// @headerfile hyperion/mpl/concurrent_layout.h
+    #if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(_M_ARM64)
+    static inline constexpr auto hardware_destructive_interference_size = 128_usize;
+    #else
+    static inline constexpr auto hardware_destructive_interference_size = 64_usize;
+    #endif
+
+    /// @brief The maximum size of contiguous memory that is guaranteed to share a cache line.
+    ///
+    /// Unlike `std::hardware_constructive_interference_size`, this is fixed per target
+    /// architecture rather than per compiler invocation, so it is safe to use in ABI-visible
+    /// layouts.
+    /// @ingroup concurrent_layout
+    /// @headerfile hyperion/mpl/concurrent_layout.h
+    #if HYPERION_PLATFORM_IS_APPLE && (defined(__aarch64__) || defined(_M_ARM64))
+    static inline constexpr auto hardware_constructive_interference_size = 128_usize;
+    #else
+    static inline constexpr auto hardware_constructive_interference_size = 64_usize;
+    #endif
+
+    namespace detail {
+        /// @brief Wraps `TType` so that it begins on, and is padded to, a boundary of
+        /// `hardware_destructive_interference_size`
+        template<typename TType>
+        struct alignas(hardware_destructive_interference_size) interference_padded {
+            TType value;
+        };
+
+        /// @brief The mapping between the members of a `concurrent_layout` and their
+        /// positions in its writer groups
+        template<usize TSize>
+        struct concurrent_layout_plan {
+            /// @brief The (dense) writer group of each member
+            std::array<usize, TSize> group = {};
+            /// @brief The index of each member within its group
+            std::array<usize, TSize> group_index = {};
+            /// @brief The members, ordered by group
+            std::array<usize, TSize> order = {};
+            /// @brief The index in `order` of the first member of each group
+            std::array<usize, TSize + 1> group_begin = {};
+            usize group_count = 0_usize;
+        };
+
+        /// @brief Computes the layout of a `concurrent_layout`.
+        /// Groups are numbered in order of their first member, and within each group members
+        /// are ordered by decreasing alignment (and otherwise in their listed order), so that
+        /// each group needs as little padding as possible
+        ///
+        /// @param first_of_group The index of the first member in the same group as each member
+        /// @param aligns The alignment of each member
+        template<usize TSize>
+        [[nodiscard]] constexpr auto
+        make_concurrent_layout_plan(const std::array<usize, TSize>& first_of_group,
+                                    const std::array<usize, TSize>& aligns)
+            -> concurrent_layout_plan<TSize> {
+            auto plan = concurrent_layout_plan<TSize>{};
+
+            for(auto member = 0_usize; member < TSize; ++member) {
+                // NOLINTBEGIN(*-pro-bounds-constant-array-index)
+                const auto first = first_of_group[member];
+                plan.group[member] = first == member ? plan.group_count++ : plan.group[first];
+                // NOLINTEND(*-pro-bounds-constant-array-index)
+            }
+
+            auto next = 0_usize;
+            for(auto group = 0_usize; group < plan.group_count; ++group) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                plan.group_begin[group] = next;
+                for(auto member = 0_usize; member < TSize; ++member) {
+                    // NOLINTBEGIN(*-pro-bounds-constant-array-index)
+                    if(plan.group[member] != group) {
+                        continue;
+                    }
+
+                    auto position = next++;
+                    while(position > plan.group_begin[group]
+                          && aligns[plan.order[position - 1_usize]] < aligns[member])
+                    {
+                        plan.order[position] = plan.order[position - 1_usize];
+                        --position;
+                    }
+                    plan.order[position] = member;
+                    // NOLINTEND(*-pro-bounds-constant-array-index)
+                }
+            }
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            plan.group_begin[plan.group_count] = next;
+
+            for(auto position = 0_usize; position < TSize; ++position) {
+                // NOLINTBEGIN(*-pro-bounds-constant-array-index)
+                const auto member = plan.order[position];
+                plan.group_index[member] = position - plan.group_begin[plan.group[member]];
+                // NOLINTEND(*-pro-bounds-constant-array-index)
+            }
+
+            return plan;
+        }
+
+        template<typename TTypes, auto TPlan, usize TGroup, typename TIndices>
+        struct concurrent_group;
+
+        template<typename... TTypes, auto TPlan, usize TGroup, usize... TIndices>
+        struct concurrent_group<std::tuple<TTypes...>,
+                                TPlan,
+                                TGroup,
+                                std::index_sequence<TIndices...>> {
+            using type = record<List<std::tuple_element_t<
+                TPlan.order[TPlan.group_begin[TGroup] + TIndices], // NOLINT
+                std::tuple<TTypes...>>...>>;
+        };
+
+        template<typename TTypes, auto TPlan, usize TGroup>
+        using concurrent_group_t = typename concurrent_group<
+            TTypes,
+            TPlan,
+            TGroup,
+            std::make_index_sequence<TPlan.group_begin[TGroup + 1] // NOLINT
+                                     - TPlan.group_begin[TGroup]>>::type; // NOLINT
+
+        template<typename TTypes, auto TPlan, typename TGroups>
+        struct concurrent_groups;
+
+        template<typename TTypes, auto TPlan, usize... TGroups>
+        struct concurrent_groups<TTypes, TPlan, std::index_sequence<TGroups...>> {
+            using type = record_fields<
+                std::index_sequence<TGroups...>,
+                interference_padded<concurrent_group_t<TTypes, TPlan, TGroups>>...>;
+        };
+
+        template<typename TTypes, typename TGroups>
+        struct concurrent_layout_traits;
+
+        template<typename... TTypes, typename... TGroups>
+        struct concurrent_layout_traits<std::tuple<TTypes...>, List<TGroups...>> {
+            static inline constexpr auto plan = make_concurrent_layout_plan(
+                std::array<usize, sizeof...(TTypes)>{
+                    decltype(List<TGroups...>{}.index_of(TGroups{}))::value...},
+                std::array<usize, sizeof...(TTypes)>{alignof(TTypes)...});
+
+            using base = typename concurrent_groups<std::tuple<TTypes...>,
+                                                    plan,
+                                                    std::make_index_sequence<plan.group_count>>::
+                type;
+        };
+
+        template<typename TType>
+        concept writer_group = MetaValue<TType>;
+    } // namespace detail
+
+    /// @brief `concurrent_layout` is a struct whose members are grouped by the threads that
+    /// write them, with each group on its own cache line(s).
+    ///
+    /// The members are described by `TMembers`, a `List` of `Pair`s of each member's type and
+    /// a `Value` naming its writer group. Members whose writer groups compare equal are packed
+    /// tightly together, ordered by decreasing alignment, into a `record`. Each group's
+    /// `record` is aligned to, and padded to a multiple of,
+    /// `hardware_destructive_interference_size`, so no two groups (and no object adjacent to
+    /// the `concurrent_layout`) share a cache line or an adjacent-line prefetch pair.
+    ///
+    /// Members are accessed by their index in `TMembers` with `get<I>()`.
+    ///
+    /// # Requirements
+    /// - `TMembers` must be a non-empty `mpl::List` of `mpl::Pair`s, whose first element is an
+    /// object type and whose second element is a `MetaValue`
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// using queue_state = concurrent_layout<List<Pair<std::atomic<usize>, Value<0>>,
+    ///                                            Pair<usize, Value<0>>,
+    ///                                            Pair<std::atomic<usize>, Value<1>>,
+    ///                                            Pair<usize, Value<1>>>>;
+    ///
+    /// static_assert(sizeof(queue_state) == 2 * hardware_destructive_interference_size);
+    /// @endcode
+    ///
+    /// @tparam TMembers The `List` of members and their writer groups
+    /// @ingroup concurrent_layout
+    /// @headerfile hyperion/mpl/concurrent_layout.h
+    template<typename TMembers>
+    class concurrent_layout;
+
+    template<typename... TTypes, typename... TGroups>
+        requires(sizeof...(TTypes) != 0)
+                && (std::is_object_v<detail::convert_to_raw_t<TTypes>> && ...)
+                && (detail::writer_group<detail::convert_to_raw_t<TGroups>> && ...)
+    class concurrent_layout<List<Pair<TTypes, TGroups>...>>
+        : private detail::concurrent_layout_traits<
+              std::tuple<detail::convert_to_raw_t<TTypes>...>,
+              List<detail::convert_to_raw_t<TGroups>...>>::base {
+      private:
+        using traits
+            = detail::concurrent_layout_traits<std::tuple<detail::convert_to_raw_t<TTypes>...>,
+                                               List<detail::convert_to_raw_t<TGroups>...>>;
+        using member_types = std::tuple<detail::convert_to_raw_t<TTypes>...>;
+        using base = typename traits::base;
+
+        static inline constexpr auto plan = traits::plan;
+
+      public:
+        /// @brief The type of the member at `TIndex`
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TTypes))
+        using member_type = std::tuple_element_t<TIndex, member_types>;
+
+        /// @brief The `record` type storing the members of the writer group `TGroup`
+        template<usize TGroup>
+            requires(TGroup < plan.group_count)
+        using group_type = detail::concurrent_group_t<member_types, plan, TGroup>;
+
+        /// @brief Returns the number of distinct writer groups
+        /// @return the number of writer groups
+        [[nodiscard]] static constexpr auto group_count() noexcept -> usize {
+            return plan.group_count;
+        }
+
+        /// @brief Returns the (dense) writer group of the member at `TIndex`. Groups are
+        /// numbered in the order their first members are listed
+        /// @return the writer group of the member at `TIndex`
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TTypes))
+        [[nodiscard]] static constexpr auto group_of() noexcept -> usize {
+            return std::get<TIndex>(plan.group);
+        }
+
+        /// @brief Default-initializes each member
+        constexpr concurrent_layout() noexcept = default;
+
+        /// @brief Initializes each member from the corresponding argument
+        /// @param values The values of the members, in the order of `TMembers`
+        template<typename... TValues>
+            requires(sizeof...(TValues) == sizeof...(TTypes))
+                    && (std::constructible_from<detail::convert_to_raw_t<TTypes>, TValues &&>
+                        && ...)
+        constexpr explicit(sizeof...(TTypes) == 1) concurrent_layout(TValues&&... values)
+            : concurrent_layout(std::make_index_sequence<plan.group_count>{},
+                                std::forward_as_tuple(std::forward<TValues>(values)...)) {
+        }
+
+        /// @brief Returns the member at `TIndex`
+        /// @return a reference to the member at `TIndex`
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TTypes))
+        [[nodiscard]] constexpr auto get() noexcept -> member_type<TIndex>& {
+            return static_cast<storage<group_of<TIndex>()>&>(*this)
+                .value.value.template get<std::get<TIndex>(plan.group_index)>();
+        }
+
+        /// @brief Returns the member at `TIndex`
+        /// @return a reference to the member at `TIndex`
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TTypes))
+        [[nodiscard]] constexpr auto get() const noexcept -> const member_type<TIndex>& {
+            return static_cast<const storage<group_of<TIndex>()>&>(*this)
+                .value.value.template get<std::get<TIndex>(plan.group_index)>();
+        }
+
+      private:
+        template<usize TGroup>
+        using storage = detail::record_field<TGroup,
+                                             detail::interference_padded<group_type<TGroup>>>;
+
+        template<usize TGroup, typename TArguments>
+        [[nodiscard]] static constexpr auto make_group(TArguments& arguments)
+            -> detail::interference_padded<group_type<TGroup>> {
+            return [&arguments]<usize... TIndices>(
+                       [[maybe_unused]] std::index_sequence<TIndices...> indices) {
+                return detail::interference_padded<group_type<TGroup>>{
+                    group_type<TGroup>{std::forward<std::tuple_element_t<
+                        plan.order[plan.group_begin[TGroup] + TIndices], // NOLINT
+                        TArguments>>(
+                        std::get<plan.order[plan.group_begin[TGroup] + TIndices]>( // NOLINT
+                            arguments))...}};
+            }(std::make_index_sequence<group_type<TGroup>::size()>{});
+        }
+
+        template<usize... TGroupIndices, typename TArguments>
+        constexpr explicit concurrent_layout(
+            [[maybe_unused]] std::index_sequence<TGroupIndices...> groups,
+            TArguments arguments)
+            : base{storage<TGroupIndices>{make_group<TGroupIndices>(arguments)}...} {
+        }
+
+        static_assert(alignof(base) == hardware_destructive_interference_size,
+                      "hyperion::mpl::concurrent_layout must be aligned to "
+                      "hardware_destructive_interference_size");
+        static_assert(sizeof(base) % hardware_destructive_interference_size == 0_usize,
+                      "hyperion::mpl::concurrent_layout must be padded to a multiple of "
+                      "hardware_destructive_interference_size");
+    };
+
+    namespace _test::concurrent_layout {
+        using stats = mpl::concurrent_layout<List<Pair<std::atomic<u64>, Value<0>>,
+                                                  Pair<u8, Value<1>>,
+                                                  Pair<std::atomic<u64>, Value<1>>,
+                                                  Pair<u32, Value<0>>,
+                                                  Pair<u64, Value<2>>>>;
+
+        static_assert(stats::group_count() == 3_usize,
+                      "hyperion::mpl::concurrent_layout test case 1 (failing)");
+        static_assert(stats::group_of<0>() == 0_usize && stats::group_of<1>() == 1_usize
+                          && stats::group_of<3>() == 0_usize && stats::group_of<4>() == 2_usize,
+                      "hyperion::mpl::concurrent_layout test case 2 (failing)");
+        static_assert(std::same_as<stats::group_type<1>, mpl::record<List<std::atomic<u64>, u8>>>,
+                      "hyperion::mpl::concurrent_layout test case 3 (failing)");
+        static_assert(sizeof(stats) == 3_usize * hardware_destructive_interference_size,
+                      "hyperion::mpl::concurrent_layout test case 4 (failing)");
+        static_assert(alignof(stats) == hardware_destructive_interference_size,
+                      "hyperion::mpl::concurrent_layout test case 5 (failing)");
+        static_assert(std::same_as<stats::member_type<3>, u32>,
+                      "hyperion::mpl::concurrent_layout test case 6 (failing)");
+
+        using grouped_by_value = mpl::concurrent_layout<
+            List<Pair<u32, Value<1>>, Pair<u32, Value<1_u32>>, Pair<u32, Value<2>>>>;
+
+        static_assert(grouped_by_value::group_count() == 2_usize,
+                      "hyperion::mpl::concurrent_layout test case 7 (failing)");
+
+        [[nodiscard]] constexpr auto test_get() noexcept -> bool {
+            auto value = grouped_by_value{1_u32, 2_u32, 3_u32};
+            value.get<1>() = 4_u32;
+            const auto& view = value;
+            return view.get<0>() == 1_u32 && view.get<1>() == 4_u32 && view.get<2>() == 3_u32;
+        }
+
+        static_assert(test_get(), "hyperion::mpl::concurrent_layout test case 8 (failing)");
+
+        template<typename TMembers>
+        concept valid_members = requires { sizeof(mpl::concurrent_layout<TMembers>); };
+
+        static_assert(valid_members<List<Pair<int, Value<0>>>>,
+                      "hyperion::mpl::concurrent_layout requirements test case 1 (failing)");
+        static_assert(not valid_members<List<>>,
+                      "hyperion::mpl::concurrent_layout requirements test case 2 (failing)");
+        static_assert(not valid_members<List<Pair<int, double>>>,
+                      "hyperion::mpl::concurrent_layout requirements test case 3 (failing)");
+    } // namespace _test::concurrent_layout
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_CONCURRENT_LAYOUT_H
@@ -0,0 +1,465 @@
+/// @file delta.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Delta encoding and patching of records
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/metatypes.h>
+#include <hyperion/mpl/record.h>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup delta Delta Encoding
+/// Hyperion provides `mpl::record_delta` for encoding the difference between two instances
+/// of an `mpl::record` as a compact patch, and applying such a patch to another instance.
+///
+/// A patch is a bitmap with one bit per field, marking the fields that changed, followed by
+/// the bytes of only the changed fields. Adjacent fields that can be compared bytewise, with
+/// no padding between them, are grouped into runs at compile time: unchanged runs are
+/// detected with a single `memcmp`, and fully changed runs are applied with a single `memcpy`.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/delta.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// using position = record<List<u64, double, double, u32>>;
+/// using delta = record_delta<List<u64, double, double, u32>>;
+///
+/// auto buffer = std::array<std::byte, delta::max_encoded_size()>{};
+/// const auto size = delta::encode(previous, current, buffer);
+/// send(std::span{buffer}.first(size));
+///
+/// // on the receiving side
+/// if(delta::apply(replica, received) == 0) {
+///     request_full_state();
+/// }
+/// @endcode
+/// @headerfile hyperion/mpl/delta.h
+/// @}
+
+#ifndef HYPERION_MPL_DELTA_H
+    #define HYPERION_MPL_DELTA_H
+
+namespace hyperion::mpl {
+
+    namespace detail {
+        /// @brief Whether two values of type `TType` are equal exactly when their bytes are.
+        /// Floating point values are compared bytewise too, so that changes between `-0.0`
+        /// and `0.0`, and between `NaN`s, are not lost
+        template<typename TType>
+        concept delta_bitwise
+            = std::has_unique_object_representations_v<TType> || std::floating_point<TType>;
+
+        /// @brief The memory layout of the fields of a `record`, and the runs of adjacent
+        /// fields that can be compared and copied together
+        template<usize TSize>
+        struct delta_layout {
+            /// @brief The offset of each field in the record
+            std::array<usize, TSize> offset = {};
+            /// @brief The index of the first field of each run, and of the end of the last run
+            std::array<usize, TSize + 1> run_begin = {};
+            /// @brief The number of runs
+            usize num_runs = 0_usize;
+            /// @brief The size of the record
+            usize size = 0_usize;
+        };
+
+        /// @brief Computes the layout of a record with fields of the given sizes and
+        /// alignments, laid out in order, and groups its fields into runs: maximal sequences
+        /// of adjacent bytewise-comparable fields with no padding between them
+        template<usize TSize>
+        [[nodiscard]] constexpr auto make_delta_layout(const std::array<usize, TSize>& sizes,
+                                                       const std::array<usize, TSize>& aligns,
+                                                       const std::array<bool, TSize>& bitwise)
+            -> delta_layout<TSize> {
+            auto layout = delta_layout<TSize>{};
+            auto alignment = 1_usize;
+            auto end = 0_usize;
+            for(auto index = 0_usize; index < TSize; ++index) {
+                // NOLINTBEGIN(*-pro-bounds-constant-array-index)
+                const auto offset = (end + aligns[index] - 1_usize) / aligns[index] * aligns[index];
+                const auto extends_run = index != 0_usize && offset == end && bitwise[index]
+                                         && bitwise[index - 1_usize];
+                if(not extends_run) {
+                    layout.run_begin[layout.num_runs++] = index;
+                }
+                layout.offset[index] = offset;
+                end = offset + sizes[index];
+                alignment = std::max(alignment, aligns[index]);
+                // NOLINTEND(*-pro-bounds-constant-array-index)
+            }
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            layout.run_begin[layout.num_runs] = TSize;
+            layout.size = (end + alignment - 1_usize) / alignment * alignment;
+            return layout;
+        }
+    } // namespace detail
+
+    /// @brief `record_delta` encodes the difference between two instances of
+    /// `record<TFields>` as a compact patch, and applies such patches.
+    ///
+    /// A patch consists of a bitmap of `(size of TFields + 7) / 8` bytes, in which bit
+    /// `i % 8` of byte `i / 8` is set if field `i` changed, followed by the bytes of each
+    /// changed field, in order. Fields are encoded in their in-memory representation, so
+    /// patches can only be applied by programs using the same representation of the fields
+    /// (e.g. replicas of the same binary).
+    ///
+    /// Adjacent fields that compare equal exactly when their bytes do, with no padding between
+    /// them, are grouped into runs at compile time. Encoding checks each run for changes with a
+    /// single `memcmp` before checking its individual fields, and applying a patch copies
+    /// runs whose fields all changed with a single `memcpy`. Other fields are compared with
+    /// `operator==` if they have one, and bytewise otherwise.
+    ///
+    /// # Requirements
+    /// - `TFields` must be a non-empty `mpl::List` of trivially copyable object types (or
+    /// `MetaType`s representing them)
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// using delta = record_delta<List<u64, double, u32>>;
+    /// using state = delta::record_type;
+    ///
+    /// auto previous = state{1_u64, 2.0, 3_u32};
+    /// auto current = state{1_u64, 2.5, 3_u32};
+    ///
+    /// auto patch = std::array<std::byte, delta::max_encoded_size()>{};
+    /// const auto size = delta::encode(previous, current, patch);
+    /// assert(size == 1 + sizeof(double));
+    ///
+    /// assert(delta::apply(previous, std::span{patch}.first(size)) == size);
+    /// assert(previous == current);
+    /// @endcode
+    ///
+    /// @tparam TFields The `List` of field types of the record
+    /// @ingroup delta
+    /// @headerfile hyperion/mpl/delta.h
+    template<typename TFields>
+    class record_delta;
+
+    template<typename... TFields>
+        requires(sizeof...(TFields) != 0)
+                && (std::is_object_v<detail::convert_to_raw_t<TFields>> && ...)
+                && (std::is_trivially_copyable_v<detail::convert_to_raw_t<TFields>> && ...)
+    class record_delta<List<TFields...>> {
+      public:
+        /// @brief The type of the records this `record_delta` encodes
+        using record_type = record<List<detail::convert_to_raw_t<TFields>...>>;
+
+      private:
+        static constexpr auto num_fields = sizeof...(TFields);
+        static constexpr auto bitmap_size = (num_fields + 7_usize) / 8_usize;
+        static constexpr auto sizes
+            = std::array<usize, num_fields>{sizeof(detail::convert_to_raw_t<TFields>)...};
+        static constexpr auto layout = detail::make_delta_layout(
+            sizes,
+            std::array<usize, num_fields>{alignof(detail::convert_to_raw_t<TFields>)...},
+            std::array<bool, num_fields>{
+                detail::delta_bitwise<detail::convert_to_raw_t<TFields>>...});
+
+        static_assert(layout.size == sizeof(record_type),
+                      "the layout of mpl::record differs from the layout of its fields");
+
+        /// @brief The total size of the fields flagged by each possible value of each byte of
+        /// a patch's bitmap
+        static constexpr auto patch_sizes = [] {
+            auto table = std::array<std::array<usize, 256_usize>, bitmap_size>{};
+            for(auto index = 0_usize; index < num_fields; ++index) {
+                for(auto bits = 0_usize; bits < 256_usize; ++bits) {
+                    if(((bits >> (index % 8_usize)) & 1_usize) != 0_usize) {
+                        // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                        table[index / 8_usize][bits] += sizes[index];
+                    }
+                }
+            }
+            return table;
+        }();
+
+        template<usize TIndex>
+        using field_type = typename record_type::template field_type<TIndex>;
+
+      public:
+        /// @brief Returns the size of the largest possible patch: the size of the bitmap plus
+        /// the size of every field
+        /// @return the maximum size of an encoded patch
+        [[nodiscard]] static constexpr auto max_encoded_size() noexcept -> usize {
+            return bitmap_size + (sizeof(detail::convert_to_raw_t<TFields>) + ...);
+        }
+
+        /// @brief Returns the number of runs of fields that are compared and copied together
+        /// @return the number of runs
+        [[nodiscard]] static constexpr auto num_runs() noexcept -> usize {
+            return layout.num_runs;
+        }
+
+        /// @brief Returns the offset of the field at `TIndex` within a `record_type`, as
+        /// computed from the sizes and alignments of the fields.
+        ///
+        /// Runs are compared and copied as the bytes spanning these offsets, so they must
+        /// match where `record_type::get` places each field.
+        /// @return the offset of the field at `TIndex`
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TFields))
+        [[nodiscard]] static constexpr auto offset_of() noexcept -> usize {
+            return std::get<TIndex>(layout.offset);
+        }
+
+        /// @brief Returns the index of the run that the field at `TIndex` belongs to
+        /// @return the run of the field at `TIndex`
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TFields))
+        [[nodiscard]] static constexpr auto run_of() noexcept -> usize {
+            return static_cast<usize>(
+                std::upper_bound(layout.run_begin.begin(),
+                                 std::next(layout.run_begin.begin(),
+                                           static_cast<isize>(layout.num_runs)),
+                                 TIndex)
+                - layout.run_begin.begin() - 1);
+        }
+
+        /// @brief Encodes the fields of `current` that differ from `previous` into `out`
+        /// @param previous The state the receiver of the patch already has
+        /// @param current The new state
+        /// @param out The buffer to write the patch to
+        /// @return The size of the patch, or `0` if `out` is smaller than
+        /// `max_encoded_size()`
+        [[nodiscard]] static auto encode(const record_type& previous,
+                                         const record_type& current,
+                                         std::span<std::byte> out) noexcept -> usize {
+            if(out.size() < max_encoded_size()) {
+                return 0_usize;
+            }
+
+            auto* const bitmap = out.data();
+            std::fill_n(bitmap, bitmap_size, std::byte{0});
+            auto* cursor = bitmap + bitmap_size;
+            [&]<usize... TRuns>([[maybe_unused]] std::index_sequence<TRuns...> runs) {
+                (encode_run<TRuns>(previous, current, bitmap, cursor), ...);
+            }(std::make_index_sequence<layout.num_runs>{});
+
+            return static_cast<usize>(cursor - out.data());
+        }
+
+        /// @brief Applies the patch `patch` to `target`
+        /// @param target The record to apply the patch to
+        /// @param patch The patch, as produced by `encode`
+        /// @return The size of the patch, or `0` if `patch` is truncated or malformed, in which
+        /// case `target` is left unchanged
+        [[nodiscard]] static auto
+        apply(record_type& target, std::span<const std::byte> patch) noexcept -> usize {
+            if(patch.size() < bitmap_size) {
+                return 0_usize;
+            }
+
+            const auto* const bitmap = patch.data();
+            auto size = bitmap_size;
+            for(auto byte = 0_usize; byte < bitmap_size; ++byte) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index, *-pointer-arithmetic)
+                size += patch_sizes[byte][std::to_integer<u8>(bitmap[byte])];
+            }
+            constexpr auto unused_bits = bitmap_size * 8_usize - num_fields;
+            if constexpr(unused_bits != 0_usize) {
+                // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                if(std::to_integer<u8>(bitmap[bitmap_size - 1_usize]) >> (8_usize - unused_bits)
+                   != 0_u8)
+                {
+                    return 0_usize;
+                }
+            }
+            if(patch.size() < size) {
+                return 0_usize;
+            }
+
+            const auto* cursor = bitmap + bitmap_size;
+            [&]<usize... TRuns>([[maybe_unused]] std::index_sequence<TRuns...> runs) {
+                (apply_run<TRuns>(target, bitmap, cursor), ...);
+            }(std::make_index_sequence<layout.num_runs>{});
+
+            return size;
+        }
+
+      private:
+        /// @brief Returns the bytes of the field at `TIndex` of `value`. Fields are always
+        /// addressed through `get`, so only the extents of runs depend on `layout.offset`
+        template<usize TIndex>
+        [[nodiscard]] static auto bytes_of(const record_type& value) noexcept
+            -> const std::byte* {
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            return reinterpret_cast<const std::byte*>(std::addressof(value.template get<TIndex>()));
+        }
+
+        template<usize TIndex>
+        [[nodiscard]] static auto bytes_of(record_type& value) noexcept -> std::byte* {
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            return reinterpret_cast<std::byte*>(std::addressof(value.template get<TIndex>()));
+        }
+
+        [[nodiscard]] static auto is_set(const std::byte* bitmap, usize index) noexcept -> bool {
+            // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+            return (std::to_integer<u8>(bitmap[index / 8_usize]) >> (index % 8_usize)) & 1U;
+        }
+
+        static auto set(std::byte* bitmap, usize index) noexcept -> void {
+            // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+            bitmap[index / 8_usize] |= std::byte{static_cast<u8>(1U << (index % 8_usize))};
+        }
+
+        template<usize TIndex>
+        [[nodiscard]] static auto
+        field_changed(const record_type& previous, const record_type& current) noexcept -> bool {
+            using type = field_type<TIndex>;
+            if constexpr(detail::delta_bitwise<type> || not std::equality_comparable<type>) {
+                return std::memcmp(
+                           bytes_of<TIndex>(previous), bytes_of<TIndex>(current), sizeof(type))
+                       != 0;
+            }
+            else {
+                return not(previous.template get<TIndex>() == current.template get<TIndex>());
+            }
+        }
+
+        template<usize TIndex>
+        static auto encode_field(const record_type& previous,
+                                 const record_type& current,
+                                 std::byte* bitmap,
+                                 std::byte*& cursor) noexcept -> void {
+            if(field_changed<TIndex>(previous, current)) {
+                set(bitmap, TIndex);
+                std::memcpy(cursor, bytes_of<TIndex>(current), sizeof(field_type<TIndex>));
+                cursor += sizeof(field_type<TIndex>);
+            }
+        }
+
+        template<usize TRun>
+        static auto encode_run(const record_type& previous,
+                               const record_type& current,
+                               std::byte* bitmap,
+                               std::byte*& cursor) noexcept -> void {
+            constexpr auto begin = std::get<TRun>(layout.run_begin);
+            constexpr auto end = std::get<TRun + 1_usize>(layout.run_begin);
+
+            if constexpr(end - begin == 1_usize) {
+                encode_field<begin>(previous, current, bitmap, cursor);
+            }
+            else {
+                constexpr auto size = std::get<end - 1_usize>(layout.offset)
+                                      + sizeof(field_type<end - 1_usize>)
+                                      - std::get<begin>(layout.offset);
+                if(std::memcmp(bytes_of<begin>(previous), bytes_of<begin>(current), size) == 0) {
+                    return;
+                }
+
+                [&]<usize... TIndices>([[maybe_unused]] std::index_sequence<TIndices...> indices) {
+                    (encode_field<begin + TIndices>(previous, current, bitmap, cursor), ...);
+                }(std::make_index_sequence<end - begin>{});
+            }
+        }
+
+        template<usize TIndex>
+        static auto
+        apply_field(record_type& target, const std::byte* bitmap, const std::byte*& cursor) noexcept
+            -> void {
+            if(is_set(bitmap, TIndex)) {
+                std::memcpy(bytes_of<TIndex>(target), cursor, sizeof(field_type<TIndex>));
+                cursor += sizeof(field_type<TIndex>);
+            }
+        }
+
+        template<usize TRun>
+        static auto
+        apply_run(record_type& target, const std::byte* bitmap, const std::byte*& cursor) noexcept
+            -> void {
+            constexpr auto begin = std::get<TRun>(layout.run_begin);
+            constexpr auto end = std::get<TRun + 1_usize>(layout.run_begin);
+
+            [&]<usize... TIndices>([[maybe_unused]] std::index_sequence<TIndices...> indices) {
+                if constexpr(end - begin > 1_usize) {
+                    if((is_set(bitmap, begin + TIndices) && ...)) {
+                        constexpr auto size = std::get<end - 1_usize>(layout.offset)
+                                              + sizeof(field_type<end - 1_usize>)
+                                              - std::get<begin>(layout.offset);
+                        std::memcpy(bytes_of<begin>(target), cursor, size);
+                        cursor += size;
+                        return;
+                    }
+                }
+                (apply_field<begin + TIndices>(target, bitmap, cursor), ...);
+            }(std::make_index_sequence<end - begin>{});
+        }
+    };
+
+    namespace _test::delta {
+        struct padded {
+            u8 tag;
+            u32 count;
+
+            friend constexpr auto operator==(const padded&, const padded&) noexcept -> bool
+                = default;
+        };
+
+        using quote = record_delta<List<u64, u32, u32, double, u8, u64, padded, i16, i16>>;
+
+        static_assert(quote::max_encoded_size()
+                          == 2_usize + 8_usize + 4_usize + 4_usize + 8_usize + 1_usize + 8_usize
+                                 + sizeof(padded) + 2_usize + 2_usize,
+                      "hyperion::mpl::record_delta test case 1 (failing)");
+        // the first five fields are contiguous, the sixth follows padding, the seventh has
+        // internal padding, and the last two are contiguous again
+        static_assert(quote::num_runs() == 4_usize,
+                      "hyperion::mpl::record_delta test case 2 (failing)");
+        static_assert(quote::run_of<0>() == 0_usize && quote::run_of<4>() == 0_usize
+                          && quote::run_of<5>() == 1_usize && quote::run_of<6>() == 2_usize
+                          && quote::run_of<7>() == 3_usize && quote::run_of<8>() == 3_usize,
+                      "hyperion::mpl::record_delta test case 3 (failing)");
+        static_assert(record_delta<List<u8>>::max_encoded_size() == 2_usize,
+                      "hyperion::mpl::record_delta test case 4 (failing)");
+
+        template<typename TFields>
+        concept valid_record_delta = requires { sizeof(record_delta<TFields>); };
+
+        static_assert(valid_record_delta<List<Type<u64>, double>>,
+                      "hyperion::mpl::record_delta requirements test case 1 (failing)");
+        static_assert(not valid_record_delta<List<>>,
+                      "hyperion::mpl::record_delta requirements test case 2 (failing)");
+        static_assert(not valid_record_delta<List<std::unique_ptr<int>>>,
+                      "hyperion::mpl::record_delta requirements test case 3 (failing)");
+    } // namespace _test::delta
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_DELTA_H
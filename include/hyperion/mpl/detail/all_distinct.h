@@ -0,0 +1,46 @@
+/// @file all_distinct.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Compile-time check that a pack of keys holds no duplicates, shared by the
+/// key-validated tables (`mpl::search_table` and `mpl::json_record`)
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <algorithm>
+#include <array>
+
+#ifndef HYPERION_MPL_DETAIL_ALL_DISTINCT_H
+    #define HYPERION_MPL_DETAIL_ALL_DISTINCT_H
+
+namespace hyperion::mpl::detail {
+
+    /// @brief Returns whether all of `keys` are distinct
+    template<typename TKey, typename... TKeys>
+    [[nodiscard]] constexpr auto all_distinct(TKeys... keys) noexcept -> bool {
+        auto sorted = std::array<TKey, sizeof...(TKeys)>{static_cast<TKey>(keys)...};
+        std::sort(sorted.begin(), sorted.end());
+        return std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end();
+    }
+} // namespace hyperion::mpl::detail
+
+#endif // HYPERION_MPL_DETAIL_ALL_DISTINCT_H
@@ -0,0 +1,157 @@
+/// @file perfect_hash.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Compile-time built perfect hash tables over string keys, shared by the
+/// string-keyed parsers (`mpl::options` and `mpl::json_record`)
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <string_view>
+
+#ifndef HYPERION_MPL_DETAIL_PERFECT_HASH_H
+    #define HYPERION_MPL_DETAIL_PERFECT_HASH_H
+
+namespace hyperion::mpl::detail {
+
+    /// @brief Hashes `key`, mixing in `seed`
+    [[nodiscard]] constexpr auto string_hash(std::string_view key, u64 seed) noexcept -> u64 {
+        // FNV-1a, followed by the MurmurHash3 finalizer so that the low bits used to
+        // index tables depend on every byte of `key`
+        auto hash = 0xcbf29ce484222325_u64 ^ seed;
+        for(const auto character : key) {
+            hash ^= static_cast<u8>(character);
+            hash *= 0x100000001b3_u64;
+        }
+        hash ^= hash >> 33U;
+        hash *= 0xff51afd7ed558ccd_u64;
+        hash ^= hash >> 33U;
+        return hash;
+    }
+
+    /// @brief A perfect hash table over `TSize` string keys, built with the
+    /// hash-and-displace algorithm.
+    ///
+    /// Each key is first hashed into one of `num_buckets` buckets. Each bucket then has
+    /// its own seed, chosen so that hashing each of the bucket's keys with it gives a
+    /// slot no other key occupies.
+    template<usize TSize>
+    struct perfect_hash_table {
+        static constexpr auto num_buckets = std::bit_ceil(TSize);
+        static constexpr auto num_slots = 2_usize * num_buckets;
+
+        /// @brief The seed of each bucket
+        std::array<u64, num_buckets> seeds = {};
+        /// @brief The index of the key that hashes to each slot, or `TSize`
+        std::array<usize, num_slots> slots = {};
+        /// @brief Whether a seed was found for every bucket
+        bool found = true;
+
+        [[nodiscard]] static constexpr auto bucket_of(std::string_view key) noexcept -> usize {
+            return static_cast<usize>(string_hash(key, 0_u64)) & (num_buckets - 1_usize);
+        }
+
+        [[nodiscard]] static constexpr auto slot_of(std::string_view key, u64 seed) noexcept
+            -> usize {
+            return static_cast<usize>(string_hash(key, seed)) & (num_slots - 1_usize);
+        }
+
+        /// @brief Returns the index of the only key that might be `key`, or `TSize`.
+        /// The key at the returned index must still be compared to `key`
+        [[nodiscard]] constexpr auto find(std::string_view key) const noexcept -> usize {
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            return slots[slot_of(key, seeds[bucket_of(key)])];
+        }
+    };
+
+    /// @brief Builds the perfect hash table over `keys`, which must be distinct
+    template<usize TSize>
+    [[nodiscard]] constexpr auto
+    make_perfect_hash_table(const std::array<std::string_view, TSize>& keys) noexcept
+        -> perfect_hash_table<TSize> {
+        using table_type = perfect_hash_table<TSize>;
+        constexpr auto max_seed = 1_u64 << 16U;
+
+        auto table = table_type{};
+        table.slots.fill(TSize);
+
+        auto bucket_sizes = std::array<usize, table_type::num_buckets>{};
+        for(const auto key : keys) {
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            ++bucket_sizes[table_type::bucket_of(key)];
+        }
+
+        // place the largest buckets first, while the table is still mostly empty
+        auto buckets = std::array<usize, table_type::num_buckets>{};
+        for(auto bucket = 0_usize; bucket < table_type::num_buckets; ++bucket) {
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            buckets[bucket] = bucket;
+        }
+        std::sort(buckets.begin(), buckets.end(), [&](usize lhs, usize rhs) {
+            // NOLINTBEGIN(*-pro-bounds-constant-array-index)
+            return bucket_sizes[lhs] > bucket_sizes[rhs]
+                   || (bucket_sizes[lhs] == bucket_sizes[rhs] && lhs < rhs);
+            // NOLINTEND(*-pro-bounds-constant-array-index)
+        });
+
+        for(const auto bucket : buckets) {
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            if(bucket_sizes[bucket] == 0_usize) {
+                break;
+            }
+
+            auto placed = false;
+            for(auto seed = 1_u64; seed < max_seed && not placed; ++seed) {
+                auto slots = table.slots;
+                placed = true;
+                for(auto index = 0_usize; index < TSize && placed; ++index) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    if(table_type::bucket_of(keys[index]) != bucket) {
+                        continue;
+                    }
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    const auto slot = table_type::slot_of(keys[index], seed);
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    placed = slots[slot] == TSize;
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    slots[slot] = index;
+                }
+
+                if(placed) {
+                    table.slots = slots;
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    table.seeds[bucket] = seed;
+                }
+            }
+            table.found = table.found && placed;
+        }
+
+        return table;
+    }
+} // namespace hyperion::mpl::detail
+
+#endif // HYPERION_MPL_DETAIL_PERFECT_HASH_H
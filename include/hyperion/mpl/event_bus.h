@@ -0,0 +1,381 @@
+/// @file event_bus.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Compile-time event bus with statically wired subscribers
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/metatypes.h>
+#include <hyperion/mpl/pair.h>
+#include <hyperion/mpl/record.h>
+#include <hyperion/mpl/type.h>
+#include <hyperion/mpl/value.h>
+
+#include <algorithm>
+#include <concepts>
+#include <deque>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup event_bus Event Bus
+/// Hyperion provides `mpl::event_bus` as an event bus whose subscriptions are declared at
+/// compile time, as an `mpl::List` of `mpl::Pair`s of event types and handler types.
+///
+/// Publishing an event expands to direct (and so inlinable) calls to exactly the handlers
+/// subscribed to that event, in the order they are listed, with no lookup and no type
+/// erasure. Optionally, a `List` of event types accepting additional subscribers at runtime
+/// can be provided; runtime subscribers to those events are invoked after the static ones.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/event_bus.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// struct order_filled { u64 id; };
+/// struct order_cancelled { u64 id; };
+///
+/// struct risk_handler {
+///     auto operator()(const order_filled& event) -> void;
+///     auto operator()(const order_cancelled& event) -> void;
+/// };
+///
+/// struct audit_handler {
+///     auto operator()(const order_filled& event) -> void;
+/// };
+///
+/// auto bus = event_bus<List<Pair<order_filled, risk_handler>,
+///                           Pair<order_cancelled, risk_handler>,
+///                           Pair<order_filled, audit_handler>>>{};
+/// // calls the first and third handlers, directly
+/// bus.publish(order_filled{1_u64});
+/// @endcode
+/// @headerfile hyperion/mpl/event_bus.h
+/// @}
+
+#ifndef HYPERION_MPL_EVENT_BUS_H
+    #define HYPERION_MPL_EVENT_BUS_H
+
+namespace hyperion::mpl {
+
+    namespace detail {
+        /// @brief Metapredicate checking whether a `Pair` of an event type and a subscriber
+        /// index is a subscription to `TEvent`
+        template<typename TEvent>
+        struct subscribes_to {
+            template<typename TSubscription>
+                requires MetaPair<TSubscription>
+            constexpr auto
+            operator()([[maybe_unused]] TSubscription subscription) const noexcept {
+                return Value<std::same_as<typename TSubscription::first, Type<TEvent>>>{};
+            }
+        };
+
+        template<typename TIndices, typename... TEvents>
+        struct indexed_subscriptions;
+
+        template<usize... TIndices, typename... TEvents>
+        struct indexed_subscriptions<std::index_sequence<TIndices...>, TEvents...> {
+            using type = List<Pair<TEvents, Value<TIndices>>...>;
+        };
+
+        /// @brief A runtime subscriber to `TEvent`, with the id it was subscribed under
+        template<typename TEvent>
+        struct runtime_subscriber {
+            u64 id;
+            std::function<void(const TEvent&)> invoke;
+        };
+
+        /// @brief The runtime subscribers to `TEvent`. A `std::deque`, so that subscribing
+        /// from within a subscriber doesn't move the subscribers being published to
+        template<typename TEvent>
+        using runtime_subscribers = std::deque<runtime_subscriber<TEvent>>;
+
+        /// @brief Stands in for the subscription id counter of an `event_bus` without
+        /// overflow events, which never hands out ids
+        struct no_subscription_ids { };
+    } // namespace detail
+
+    /// @brief `event_bus` is an event bus whose subscriptions are wired at compile time.
+    ///
+    /// `TSubscriptions` is a `List` of `Pair`s of an event type and a handler type. The bus
+    /// owns one instance of each listed handler type (the same handler type may be listed
+    /// once per event it handles; each listing is a separate instance). `publish(event)`
+    /// invokes, in listed order, exactly the handlers whose subscription's event type is the
+    /// type of `event`. The matching handlers are computed with `List::filter`, so publishing
+    /// is a sequence of direct calls, with no lookup or type erasure.
+    ///
+    /// Event types in `TOverflowEvents` additionally accept runtime subscribers via
+    /// `subscribe`, which are invoked (through `std::function`) after the static subscribers,
+    /// until removed with `unsubscribe`. Publishing events not in `TOverflowEvents` never
+    /// touches the runtime subscribers. Subscribers may `subscribe` while an event is being
+    /// published; the new subscribers receive only later events.
+    ///
+    /// # Requirements
+    /// - `TSubscriptions` must be an `mpl::List` of `mpl::Pair`s of an object type and an
+    /// object type invocable with a `const` reference to that object type
+    /// - `TOverflowEvents` must be an `mpl::List` of distinct object types
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// struct tick { double price; };
+    /// struct log_handler {
+    ///     auto operator()(const tick& event) -> void;
+    /// };
+    ///
+    /// auto bus = event_bus<List<Pair<tick, log_handler>>, List<tick>>{};
+    /// const auto id = bus.subscribe<tick>([](const tick& event) { record(event.price); });
+    /// // calls `log_handler` directly, then the runtime subscriber
+    /// bus.publish(tick{1.0});
+    /// bus.unsubscribe<tick>(id);
+    /// @endcode
+    ///
+    /// @tparam TSubscriptions The `List` of subscriptions
+    /// @tparam TOverflowEvents The `List` of events accepting runtime subscribers
+    /// @ingroup event_bus
+    /// @headerfile hyperion/mpl/event_bus.h
+    template<typename TSubscriptions, typename TOverflowEvents = List<>>
+    class event_bus;
+
+    template<typename... TEvents, typename... THandlers, typename... TOverflowEvents>
+        requires(std::is_object_v<detail::convert_to_raw_t<TEvents>> && ...)
+                && (std::is_object_v<detail::convert_to_raw_t<THandlers>> && ...)
+                && (std::invocable<detail::convert_to_raw_t<THandlers>&,
+                                   const detail::convert_to_raw_t<TEvents>&>
+                    && ...)
+                && (std::is_object_v<TOverflowEvents> && ...)
+                && detail::unique_types<TOverflowEvents...>
+    class event_bus<List<Pair<TEvents, THandlers>...>, List<TOverflowEvents...>> {
+      private:
+        using subscriptions = typename detail::indexed_subscriptions<
+            std::index_sequence_for<TEvents...>,
+            detail::convert_to_raw_t<TEvents>...>::type;
+
+        using handlers_type = record<List<detail::convert_to_raw_t<THandlers>...>>;
+
+      public:
+        /// @brief The type identifying a runtime subscriber, returned by `subscribe`
+        using subscription_id = u64;
+
+        /// @brief The type of the handler of the subscription at `TIndex`
+        template<usize TIndex>
+            requires(TIndex < sizeof...(THandlers))
+        using handler_type = typename handlers_type::template field_type<TIndex>;
+
+        /// @brief Default-initializes each handler
+        constexpr event_bus() = default;
+
+        /// @brief Initializes each handler from the corresponding argument
+        /// @param handlers The handlers, in the order of `TSubscriptions`
+        template<typename... TValues>
+            requires(sizeof...(TValues) == sizeof...(THandlers)) && (sizeof...(THandlers) != 0)
+                    && (std::constructible_from<detail::convert_to_raw_t<THandlers>, TValues &&>
+                        && ...)
+        constexpr explicit event_bus(TValues&&... handlers)
+            : m_handlers{std::forward<TValues>(handlers)...} {
+        }
+
+        /// @brief Returns the subscriptions to `TEvent`, as a `List` of `Pair`s of `TEvent`
+        /// and the index of each subscription in `TSubscriptions`
+        /// @return the static subscriptions to `TEvent`
+        template<typename TEvent>
+        [[nodiscard]] static constexpr auto subscriptions_to() noexcept {
+            return subscriptions{}.filter(detail::subscribes_to<TEvent>{});
+        }
+
+        /// @brief Returns the number of static subscriptions to `TEvent`
+        /// @return the number of static subscriptions to `TEvent`
+        template<typename TEvent>
+        [[nodiscard]] static constexpr auto subscriber_count() noexcept -> usize {
+            return decltype(subscriptions_to<TEvent>().size())::value;
+        }
+
+        /// @brief Returns whether `TEvent` accepts runtime subscribers
+        /// @return whether `TEvent` is in `TOverflowEvents`
+        template<typename TEvent>
+        [[nodiscard]] static constexpr auto accepts_runtime_subscribers() noexcept -> bool {
+            return detail::count_of_type<TEvent, TOverflowEvents...> != 0_usize;
+        }
+
+        /// @brief Returns the handler of the subscription at `TIndex`
+        /// @return a reference to the handler
+        template<usize TIndex>
+            requires(TIndex < sizeof...(THandlers))
+        [[nodiscard]] constexpr auto handler() noexcept -> handler_type<TIndex>& {
+            return m_handlers.template get<TIndex>();
+        }
+
+        /// @brief Returns the handler of the subscription at `TIndex`
+        /// @return a reference to the handler
+        template<usize TIndex>
+            requires(TIndex < sizeof...(THandlers))
+        [[nodiscard]] constexpr auto handler() const noexcept -> const handler_type<TIndex>& {
+            return m_handlers.template get<TIndex>();
+        }
+
+        /// @brief Adds a runtime subscriber to `TEvent`. May be called while publishing
+        /// `TEvent`, in which case `subscriber` is not invoked for the event being published
+        /// @param subscriber The subscriber to add
+        /// @return the id of the subscriber, to remove it with `unsubscribe`
+        template<typename TEvent>
+            requires(accepts_runtime_subscribers<TEvent>())
+        auto subscribe(std::function<void(const TEvent&)> subscriber) -> subscription_id {
+            const auto id = m_next_id++;
+            runtime_subscribers_of<TEvent>().push_back({id, std::move(subscriber)});
+            return id;
+        }
+
+        /// @brief Removes the runtime subscriber to `TEvent` with the id `id`, keeping the
+        /// order of the remaining subscribers. Must not be called while publishing `TEvent`
+        /// @param id The id returned by `subscribe` when the subscriber was added
+        /// @return whether a subscriber was removed
+        template<typename TEvent>
+            requires(accepts_runtime_subscribers<TEvent>())
+        auto unsubscribe(subscription_id id) -> bool {
+            auto& subscribers = runtime_subscribers_of<TEvent>();
+            const auto found = std::find_if(subscribers.begin(),
+                                            subscribers.end(),
+                                            [id](const auto& subscriber) noexcept {
+                                                return subscriber.id == id;
+                                            });
+            if(found == subscribers.end()) {
+                return false;
+            }
+            subscribers.erase(found);
+            return true;
+        }
+
+        /// @brief Publishes `event` to every subscriber of its type: first each static
+        /// subscriber in listed order, then, if its type accepts runtime subscribers, each
+        /// runtime subscriber in order of subscription
+        /// @param event The event to publish
+        template<typename TEvent>
+        constexpr auto publish(const TEvent& event) -> void {
+            invoke_subscribers(event, subscriptions_to<TEvent>());
+
+            if constexpr(accepts_runtime_subscribers<TEvent>()) {
+                // a subscriber may `subscribe`, so only the subscribers present when
+                // publishing began are invoked
+                auto& subscribers = runtime_subscribers_of<TEvent>();
+                const auto count = subscribers.size();
+                for(auto index = 0_usize; index < count; ++index) {
+                    subscribers[index].invoke(event);
+                }
+            }
+        }
+
+      private:
+        // only buses with overflow events pay for the id counter
+        using next_id_type = std::conditional_t<sizeof...(TOverflowEvents) == 0,
+                                                detail::no_subscription_ids,
+                                                subscription_id>;
+
+        handlers_type m_handlers;
+        [[no_unique_address]] std::tuple<detail::runtime_subscribers<TOverflowEvents>...>
+            m_overflow;
+        [[no_unique_address]] next_id_type m_next_id = {};
+
+        template<typename TEvent>
+        constexpr auto
+        runtime_subscribers_of() noexcept -> detail::runtime_subscribers<TEvent>& {
+            return std::get<detail::index_of_type<TEvent, TOverflowEvents...>>(m_overflow);
+        }
+
+        template<typename TEvent, typename... TSubscriptions>
+        constexpr auto invoke_subscribers(const TEvent& event,
+                                          [[maybe_unused]] List<TSubscriptions...> matching)
+            -> void {
+            (std::invoke(m_handlers.template get<TSubscriptions::second::value>(), event), ...);
+        }
+    };
+
+    namespace _test::event_bus {
+        struct filled {
+            u64 id;
+        };
+        struct cancelled {
+            u64 id;
+        };
+        struct unsubscribed { };
+
+        struct counter {
+            u64 total = 0_u64;
+
+            constexpr auto operator()(const filled& event) noexcept -> void {
+                total += event.id;
+            }
+            constexpr auto operator()(const cancelled& event) noexcept -> void {
+                total += 100_u64 * event.id;
+            }
+        };
+
+        using bus = mpl::event_bus<List<Pair<filled, counter>,
+                                        Pair<cancelled, counter>,
+                                        Pair<filled, counter>>>;
+
+        static_assert(bus::subscriber_count<filled>() == 2_usize,
+                      "hyperion::mpl::event_bus test case 1 (failing)");
+        static_assert(bus::subscriber_count<unsubscribed>() == 0_usize,
+                      "hyperion::mpl::event_bus test case 2 (failing)");
+        static_assert(bus::subscriptions_to<filled>()
+                          == List<Pair<filled, Value<0_usize>>, Pair<filled, Value<2_usize>>>{},
+                      "hyperion::mpl::event_bus test case 3 (failing)");
+        static_assert(not bus::accepts_runtime_subscribers<filled>(),
+                      "hyperion::mpl::event_bus test case 4 (failing)");
+
+        [[nodiscard]] constexpr auto test_publish() noexcept -> bool {
+            auto value = bus{};
+            value.publish(filled{1_u64});
+            value.publish(cancelled{2_u64});
+            value.publish(filled{3_u64});
+            value.publish(unsubscribed{});
+            return value.handler<0>().total == 4_u64 && value.handler<1>().total == 200_u64
+                   && value.handler<2>().total == 4_u64;
+        }
+
+        static_assert(test_publish(), "hyperion::mpl::event_bus test case 5 (failing)");
+        static_assert(sizeof(bus) == sizeof(mpl::record<List<counter, counter, counter>>),
+                      "hyperion::mpl::event_bus test case 6 (failing)");
+
+        template<typename TSubscriptions, typename TOverflowEvents = List<>>
+        concept valid_bus
+            = requires { sizeof(mpl::event_bus<TSubscriptions, TOverflowEvents>); };
+
+        static_assert(valid_bus<List<Pair<filled, counter>>, List<filled>>,
+                      "hyperion::mpl::event_bus requirements test case 1 (failing)");
+        static_assert(not valid_bus<List<Pair<unsubscribed, counter>>>,
+                      "hyperion::mpl::event_bus requirements test case 2 (failing)");
+        static_assert(not valid_bus<List<Pair<filled, counter>>, List<filled, filled>>,
+                      "hyperion::mpl::event_bus requirements test case 3 (failing)");
+    } // namespace _test::event_bus
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_EVENT_BUS_H
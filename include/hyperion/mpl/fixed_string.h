@@ -0,0 +1,169 @@
+/// @file fixed_string.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Fixed-width, trivially copyable string type
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <compare>
+#include <string_view>
+#include <type_traits>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup fixed_string Fixed-Width Strings
+/// Hyperion provides `mpl::fixed_string` as a fixed-width, trivially copyable string, usable
+/// as a field of plain-old-data records, as a component of radix sort keys, and as a
+/// non-type template parameter.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/fixed_string.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// constexpr auto name = fixed_string{"hyperion"};
+/// static_assert(name.size() == 8);
+/// static_assert(name.view() == "hyperion");
+///
+/// // shorter strings are padded with `'\0'`
+/// constexpr auto padded = fixed_string<8>{"mpl"};
+/// static_assert(padded.view() == "mpl");
+/// @endcode
+/// @headerfile hyperion/mpl/fixed_string.h
+/// @}
+
+#ifndef HYPERION_MPL_FIXED_STRING_H
+    #define HYPERION_MPL_FIXED_STRING_H
+
+namespace hyperion::mpl {
+
+    /// @brief `fixed_string` is a string of exactly `TSize` `char`s, stored inline.
+    ///
+    /// Strings shorter than `TSize` are padded with `'\0'`. Comparisons compare all `TSize`
+    /// characters as `unsigned char`s, so the ordering of `fixed_string`s is the
+    /// lexicographical ordering of their bytes.
+    ///
+    /// `fixed_string` is a structural type, so it can be used as a non-type template parameter.
+    ///
+    /// @tparam TSize The number of characters in the string
+    /// @ingroup fixed_string
+    /// @headerfile hyperion/mpl/fixed_string.h
+    template<usize TSize>
+    struct fixed_string {
+        /// @brief The characters of the string, padded with `'\0'`
+        std::array<char, TSize> chars = {};
+
+        /// @brief Constructs a `fixed_string` of `TSize` `'\0'`s
+        constexpr fixed_string() noexcept = default;
+
+        /// @brief Constructs a `fixed_string` from the string literal `str`
+        /// @param str The string literal to copy
+        // NOLINTNEXTLINE(*-explicit-*, *-avoid-c-arrays)
+        constexpr fixed_string(const char (&str)[TSize + 1]) noexcept {
+            for(auto index = 0_usize; index < TSize; ++index) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                chars[index] = str[index];
+            }
+        }
+
+        /// @brief Constructs a `fixed_string` from the first `TSize` characters of `str`,
+        /// padding with `'\0'` if `str` is shorter than `TSize`
+        /// @param str The string to copy
+        constexpr explicit fixed_string(std::string_view str) noexcept {
+            for(auto index = 0_usize; index < TSize && index < str.size(); ++index) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                chars[index] = str[index];
+            }
+        }
+
+        /// @brief Returns the width of this `fixed_string`, including any padding
+        /// @return `TSize`
+        [[nodiscard]] static constexpr auto size() noexcept -> usize {
+            return TSize;
+        }
+
+        /// @brief Returns a view of this string, up to the first `'\0'`
+        /// @return a view of this string, excluding any padding
+        [[nodiscard]] constexpr auto view() const noexcept -> std::string_view {
+            auto length = 0_usize;
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            while(length < TSize && chars[length] != '\0') {
+                ++length;
+            }
+            return std::string_view{chars.data(), length};
+        }
+
+        /// @brief Compares two `fixed_string`s lexicographically, byte by byte
+        [[nodiscard]] friend constexpr auto
+        operator<=>(const fixed_string& lhs, const fixed_string& rhs) noexcept
+            -> std::strong_ordering {
+            return std::string_view{lhs.chars.data(), TSize}
+                   <=> std::string_view{rhs.chars.data(), TSize};
+        }
+
+        [[nodiscard]] friend constexpr auto
+        operator==(const fixed_string& lhs, const fixed_string& rhs) noexcept -> bool = default;
+    };
+
+    template<usize TSize>
+    // NOLINTNEXTLINE(*-avoid-c-arrays)
+    fixed_string(const char (&str)[TSize]) -> fixed_string<TSize - 1>;
+
+    namespace detail {
+        template<typename TType>
+        struct is_fixed_string : std::false_type { };
+
+        template<usize TSize>
+        struct is_fixed_string<fixed_string<TSize>> : std::true_type { };
+    } // namespace detail
+
+    namespace _test::fixed_string {
+        static_assert(mpl::fixed_string{"hyperion"}.size() == 8_usize,
+                      "hyperion::mpl::fixed_string test case 1 (failing)");
+        static_assert(mpl::fixed_string{"hyperion"}.view() == "hyperion",
+                      "hyperion::mpl::fixed_string test case 2 (failing)");
+        static_assert(mpl::fixed_string<8>{std::string_view{"mpl"}}.view() == "mpl",
+                      "hyperion::mpl::fixed_string test case 3 (failing)");
+        static_assert(mpl::fixed_string<2>{std::string_view{"mpl"}}.view() == "mp",
+                      "hyperion::mpl::fixed_string test case 4 (failing)");
+        static_assert(mpl::fixed_string{"abc"} < mpl::fixed_string{"abd"},
+                      "hyperion::mpl::fixed_string test case 5 (failing)");
+        static_assert(mpl::fixed_string<3>{std::string_view{"ab"}} < mpl::fixed_string{"ab\x80"},
+                      "hyperion::mpl::fixed_string test case 6 (failing)");
+        static_assert(mpl::fixed_string{"abc"} == mpl::fixed_string{"abc"},
+                      "hyperion::mpl::fixed_string test case 7 (failing)");
+
+        template<mpl::fixed_string TString>
+        static inline constexpr auto template_parameter = TString.size();
+
+        static_assert(template_parameter<"hyperion"> == 8_usize,
+                      "hyperion::mpl::fixed_string test case 8 (failing)");
+    } // namespace _test::fixed_string
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_FIXED_STRING_H
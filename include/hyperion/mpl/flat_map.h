@@ -0,0 +1,772 @@
+/// @file flat_map.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Fixed-capacity, `constexpr` sorted associative containers
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/static_vector.h>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup flat_map Flat Maps
+/// Hyperion provides `mpl::flat_map` and `mpl::flat_set` as fixed-capacity, sorted
+/// associative containers usable both during constant evaluation and at runtime.
+/// Lookups are binary searches over a contiguous array of keys, so a table computed at
+/// compile time can be stored in a `constexpr` variable (and so in read-only data) and
+/// queried at runtime without any initialization.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/flat_map.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// constexpr auto http_status = flat_map<int, std::string_view, 4>{
+///     {404, "Not Found"},
+///     {200, "OK"},
+///     {500, "Internal Server Error"},
+/// };
+///
+/// static_assert(http_status.at(200) == "OK");
+/// static_assert(not http_status.contains(418));
+/// @endcode
+/// @headerfile hyperion/mpl/flat_map.h
+/// @}
+
+#ifndef HYPERION_MPL_FLAT_MAP_H
+    #define HYPERION_MPL_FLAT_MAP_H
+
+namespace hyperion::mpl {
+
+    /// @brief Tag type indicating that the input to a `flat_map` or `flat_set` is already
+    /// sorted and free of duplicate keys
+    /// @ingroup flat_map
+    /// @headerfile hyperion/mpl/flat_map.h
+    struct sorted_unique_t {
+        explicit sorted_unique_t() = default;
+    };
+
+    /// @brief Tag value indicating that the input to a `flat_map` or `flat_set` is already
+    /// sorted and free of duplicate keys
+    /// @ingroup flat_map
+    /// @headerfile hyperion/mpl/flat_map.h
+    inline constexpr auto sorted_unique = sorted_unique_t{};
+
+    namespace detail {
+        /// @brief Returns the indices of the first occurrence of each distinct key in the
+        /// range `[0, count)`, in sorted key order
+        ///
+        /// @param count The number of keys
+        /// @param key_at Returns the key at a given index
+        /// @param compare The key comparison
+        /// @return the sorted indices of the distinct keys
+        template<usize TCapacity>
+        constexpr auto sorted_unique_indices(usize count, auto key_at, auto compare) {
+            auto order = std::array<usize, TCapacity>{};
+            const auto first = order.begin();
+            const auto last = std::next(first, static_cast<std::ptrdiff_t>(count));
+            std::iota(first, last, 0_usize);
+
+            // GCC 12 can't see that `count <= TCapacity`, and warns that the unrolled part
+            // of `std::sort`'s final insertion sort reads past the end of small arrays
+    #if HYPERION_PLATFORM_COMPILER_IS_GCC
+            _Pragma("GCC diagnostic push");
+            _Pragma("GCC diagnostic ignored \"-Warray-bounds\"");
+    #endif // HYPERION_PLATFORM_COMPILER_IS_GCC
+
+            // order equal keys by their index, so the first occurrence is kept
+            std::sort(first, last, [&](usize lhs, usize rhs) {
+                if(compare(key_at(lhs), key_at(rhs))) {
+                    return true;
+                }
+                return !compare(key_at(rhs), key_at(lhs)) && lhs < rhs;
+            });
+
+    #if HYPERION_PLATFORM_COMPILER_IS_GCC
+            _Pragma("GCC diagnostic pop");
+    #endif // HYPERION_PLATFORM_COMPILER_IS_GCC
+
+            const auto unique_last = std::unique(first, last, [&](usize lhs, usize rhs) {
+                return !compare(key_at(lhs), key_at(rhs));
+            });
+
+            auto indices = mpl::static_vector<usize, TCapacity>{};
+            for(auto index = first; index != unique_last; ++index) {
+                indices.push_back(*index);
+            }
+            return indices;
+        }
+
+        /// @brief Throws `std::invalid_argument` if the keys in `[0, count)` are not sorted
+        /// in strictly increasing order
+        constexpr auto check_sorted_unique(usize count, auto key_at, auto compare) -> void {
+            for(auto index = 1_usize; index < count; ++index) {
+                if(!compare(key_at(index - 1_usize), key_at(index))) {
+                    throw std::invalid_argument{
+                        "hyperion::mpl::flat_map keys are not sorted and unique"};
+                }
+            }
+        }
+
+        /// @brief Whether `TRange` is a sized input range whose elements convert to
+        /// `TElement`, and so can be bulk-loaded into a `flat_set` or `flat_map`
+        template<typename TRange, typename TElement>
+        concept sized_input_range_of
+            = std::ranges::input_range<TRange> && std::ranges::sized_range<TRange>
+              && std::convertible_to<std::ranges::range_reference_t<TRange>, TElement>;
+
+        /// @brief Whether `TLookup` can be used to look up a key in a sorted container
+        /// keyed by `TKey` and ordered by `TCompare`
+        template<typename TLookup, typename TKey, typename TCompare>
+        concept flat_lookup = std::same_as<std::remove_cvref_t<TLookup>, TKey>
+                              || requires { typename TCompare::is_transparent; };
+    } // namespace detail
+
+    /// @brief `flat_set` is a set of up to `TCapacity` distinct keys, stored inline in
+    /// sorted order.
+    ///
+    /// Lookups are binary searches, and insertions and erasures shift the following keys.
+    /// `flat_set` is usable in `constexpr` contexts. If `TKey` is trivially copyable and
+    /// assignable, and `noexcept` default constructible, `flat_set` is also trivially
+    /// copyable and can be stored in a `constexpr` variable.
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// constexpr auto primes = flat_set<int, 8>{7, 2, 5, 3, 2};
+    /// static_assert(primes.size() == 4);
+    /// static_assert(primes.contains(5));
+    /// static_assert(primes.keys()[0] == 2);
+    /// @endcode
+    ///
+    /// @tparam TKey The type of the keys
+    /// @tparam TCapacity The maximum number of keys
+    /// @tparam TCompare The strict weak ordering of keys
+    /// @ingroup flat_map
+    /// @headerfile hyperion/mpl/flat_map.h
+    template<typename TKey, usize TCapacity, typename TCompare = std::less<>>
+        requires std::strict_weak_order<TCompare, const TKey&, const TKey&>
+    class flat_set {
+      public:
+        using key_type = TKey;
+        using value_type = TKey;
+        using key_compare = TCompare;
+        using size_type = typename mpl::static_vector<TKey, TCapacity>::size_type;
+        using const_iterator = typename mpl::static_vector<TKey, TCapacity>::const_iterator;
+        using iterator = const_iterator;
+
+        /// @brief Constructs an empty `flat_set`
+        constexpr flat_set() noexcept = default;
+
+        /// @brief Constructs a `flat_set` containing the distinct keys in `keys`
+        /// @param keys The keys, in any order. Only the first of each equivalent key is kept
+        /// @throws std::length_error if there are more than `TCapacity` keys
+        constexpr flat_set(std::initializer_list<TKey> keys) {
+            const auto indices = detail::sorted_unique_indices<TCapacity>(
+                check_count(keys.size()),
+                [&keys](usize index) -> const TKey& { return keys.begin()[index]; },
+                TCompare{});
+            for(const auto index : indices) {
+                m_keys.push_back(keys.begin()[index]);
+            }
+        }
+
+        /// @brief Constructs a `flat_set` from keys that are already sorted and distinct,
+        /// in linear time
+        /// @param keys The keys, in sorted order
+        /// @throws std::length_error if there are more than `TCapacity` keys
+        /// @throws std::invalid_argument if `keys` are not sorted and distinct
+        constexpr flat_set([[maybe_unused]] sorted_unique_t tag,
+                           std::initializer_list<TKey> keys) {
+            detail::check_sorted_unique(
+                check_count(keys.size()),
+                [&keys](usize index) -> const TKey& { return keys.begin()[index]; },
+                TCompare{});
+            for(const auto& key : keys) {
+                m_keys.push_back(key);
+            }
+        }
+
+        /// @brief Constructs a `flat_set` containing the distinct keys in `keys`.
+        /// Unlike the `std::initializer_list` constructor, `keys` may be computed, e.g. a
+        /// `std::array` or `std::span` produced by another `constexpr` algorithm
+        /// @param keys The keys, in any order. Only the first of each equivalent key is kept
+        /// @throws std::length_error if there are more than `TCapacity` keys
+        template<typename TRange>
+            requires detail::sized_input_range_of<TRange, TKey>
+                     && (!std::same_as<std::remove_cvref_t<TRange>, flat_set>)
+        constexpr explicit flat_set(TRange&& keys) {
+            append(std::forward<TRange>(keys));
+            const auto indices = detail::sorted_unique_indices<TCapacity>(
+                m_keys.size(),
+                [this](usize index) -> const TKey& { return m_keys[index]; },
+                TCompare{});
+            auto sorted = mpl::static_vector<TKey, TCapacity>{};
+            for(const auto index : indices) {
+                sorted.push_back(std::move(m_keys[index]));
+            }
+            m_keys = std::move(sorted);
+        }
+
+        /// @brief Constructs a `flat_set` from a range of keys that are already sorted and
+        /// distinct, in linear time
+        /// @param keys The keys, in sorted order
+        /// @throws std::length_error if there are more than `TCapacity` keys
+        /// @throws std::invalid_argument if `keys` are not sorted and distinct
+        template<typename TRange>
+            requires detail::sized_input_range_of<TRange, TKey>
+        constexpr flat_set([[maybe_unused]] sorted_unique_t tag, TRange&& keys) {
+            append(std::forward<TRange>(keys));
+            detail::check_sorted_unique(
+                m_keys.size(),
+                [this](usize index) -> const TKey& { return m_keys[index]; },
+                TCompare{});
+        }
+
+        [[nodiscard]] static constexpr auto capacity() noexcept -> size_type {
+            return mpl::static_vector<TKey, TCapacity>::capacity();
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> size_type {
+            return m_keys.size();
+        }
+
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+            return m_keys.empty();
+        }
+
+        [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator {
+            return m_keys.begin();
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept -> const_iterator {
+            return m_keys.end();
+        }
+
+        /// @brief Returns the keys, in sorted order
+        /// @return the keys
+        [[nodiscard]] constexpr auto keys() const noexcept -> std::span<const TKey> {
+            return {m_keys.data(), m_keys.size()};
+        }
+
+        /// @brief Returns the index of the first key not ordered before `key`
+        /// @param key The key to search for
+        /// @return the index of the lower bound of `key`
+        template<typename TLookup>
+            requires detail::flat_lookup<TLookup, TKey, TCompare>
+        [[nodiscard]] constexpr auto lower_bound(const TLookup& key) const noexcept -> usize {
+            return static_cast<usize>(std::lower_bound(begin(), end(), key, TCompare{})
+                                      - begin());
+        }
+
+        /// @brief Returns the index of `key`, or `size()` if it is not in this set
+        /// @param key The key to search for
+        /// @return the index of `key`
+        template<typename TLookup>
+            requires detail::flat_lookup<TLookup, TKey, TCompare>
+        [[nodiscard]] constexpr auto index_of(const TLookup& key) const noexcept -> usize {
+            const auto index = lower_bound(key);
+            if(index != size() && !TCompare{}(key, m_keys[index])) {
+                return index;
+            }
+            return size();
+        }
+
+        /// @brief Returns whether `key` is in this set
+        /// @param key The key to search for
+        /// @return whether `key` is in this set
+        template<typename TLookup>
+            requires detail::flat_lookup<TLookup, TKey, TCompare>
+        [[nodiscard]] constexpr auto contains(const TLookup& key) const noexcept -> bool {
+            return index_of(key) != size();
+        }
+
+        /// @brief Inserts `key`, if it is not already in this set
+        /// @param key The key to insert
+        /// @return whether `key` was inserted
+        /// @throws std::length_error if `key` is not in this set and this set is full
+        constexpr auto insert(const TKey& key) -> bool {
+            const auto index = lower_bound(key);
+            if(index != size() && !TCompare{}(key, m_keys[index])) {
+                return false;
+            }
+            m_keys.insert(m_keys.begin() + index, key);
+            return true;
+        }
+
+        /// @brief Removes `key`, if it is in this set
+        /// @param key The key to remove
+        /// @return whether `key` was removed
+        template<typename TLookup>
+            requires detail::flat_lookup<TLookup, TKey, TCompare>
+        constexpr auto erase(const TLookup& key) -> bool {
+            const auto index = index_of(key);
+            if(index == size()) {
+                return false;
+            }
+            m_keys.erase(m_keys.begin() + index);
+            return true;
+        }
+
+        constexpr auto clear() noexcept -> void {
+            m_keys.clear();
+        }
+
+        [[nodiscard]] friend constexpr auto
+        operator==(const flat_set& lhs, const flat_set& rhs) noexcept -> bool
+            requires std::equality_comparable<TKey>
+        {
+            return lhs.m_keys == rhs.m_keys;
+        }
+
+      private:
+        mpl::static_vector<TKey, TCapacity> m_keys;
+
+        static constexpr auto check_count(usize count) -> usize {
+            if(count > TCapacity) {
+                throw std::length_error{"hyperion::mpl::flat_set capacity exceeded"};
+            }
+            return count;
+        }
+
+        /// @brief Appends the keys in `keys`, unsorted, to the (empty) keys of this set
+        template<typename TRange>
+        constexpr auto append(TRange&& keys) -> void {
+            check_count(static_cast<usize>(std::ranges::size(keys)));
+            for(auto&& key : std::forward<TRange>(keys)) {
+                m_keys.push_back(static_cast<TKey>(std::forward<decltype(key)>(key)));
+            }
+        }
+    };
+
+    /// @brief `flat_map` is a map of up to `TCapacity` distinct keys to values, stored
+    /// inline in sorted key order.
+    ///
+    /// Keys and values are stored in separate contiguous arrays, so lookups binary search
+    /// a dense array of keys only. Insertions and erasures shift the following entries.
+    /// `flat_map` is usable in `constexpr` contexts. If `TKey` and `TValue` are trivially
+    /// copyable and assignable, and `noexcept` default constructible, `flat_map` is also
+    /// trivially copyable and can be stored in a `constexpr` variable.
+    ///
+    /// # Requirements
+    /// - `TKey` and `TValue` must be `noexcept` move constructible and move assignable, so
+    /// that an insertion either inserts both the key and the value, or neither
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// constexpr auto ports = flat_map<std::string_view, u16, 4>{
+    ///     {"https", 443},
+    ///     {"http", 80},
+    /// };
+    /// static_assert(ports.at("http") == 80);
+    /// static_assert(ports.find("ftp") == nullptr);
+    /// @endcode
+    ///
+    /// @tparam TKey The type of the keys
+    /// @tparam TValue The type of the values
+    /// @tparam TCapacity The maximum number of entries
+    /// @tparam TCompare The strict weak ordering of keys
+    /// @ingroup flat_map
+    /// @headerfile hyperion/mpl/flat_map.h
+    template<typename TKey, typename TValue, usize TCapacity, typename TCompare = std::less<>>
+        requires std::strict_weak_order<TCompare, const TKey&, const TKey&>
+    class flat_map {
+      public:
+        using key_type = TKey;
+        using mapped_type = TValue;
+        using key_compare = TCompare;
+        using size_type = typename mpl::static_vector<TKey, TCapacity>::size_type;
+
+        /// @brief Constructs an empty `flat_map`
+        constexpr flat_map() noexcept = default;
+
+        /// @brief Constructs a `flat_map` containing the given entries
+        /// @param entries The entries, in any order. Only the first entry with each
+        /// equivalent key is kept
+        /// @throws std::length_error if there are more than `TCapacity` entries
+        constexpr flat_map(std::initializer_list<std::pair<TKey, TValue>> entries) {
+            const auto indices = detail::sorted_unique_indices<TCapacity>(
+                check_count(entries.size()),
+                [&entries](usize index) -> const TKey& { return entries.begin()[index].first; },
+                TCompare{});
+            for(const auto index : indices) {
+                m_keys.push_back(entries.begin()[index].first);
+                m_values.push_back(entries.begin()[index].second);
+            }
+        }
+
+        /// @brief Constructs a `flat_map` from entries whose keys are already sorted and
+        /// distinct, in linear time
+        /// @param entries The entries, in sorted key order
+        /// @throws std::length_error if there are more than `TCapacity` entries
+        /// @throws std::invalid_argument if the keys of `entries` are not sorted and distinct
+        constexpr flat_map([[maybe_unused]] sorted_unique_t tag,
+                           std::initializer_list<std::pair<TKey, TValue>> entries) {
+            detail::check_sorted_unique(
+                check_count(entries.size()),
+                [&entries](usize index) -> const TKey& { return entries.begin()[index].first; },
+                TCompare{});
+            for(const auto& entry : entries) {
+                m_keys.push_back(entry.first);
+                m_values.push_back(entry.second);
+            }
+        }
+
+        /// @brief Constructs a `flat_map` containing the entries in `entries`.
+        /// Unlike the `std::initializer_list` constructor, `entries` may be computed, e.g. a
+        /// `std::array` or `std::span` produced by another `constexpr` algorithm
+        /// @param entries The entries, in any order. Only the first entry with each
+        /// equivalent key is kept
+        /// @throws std::length_error if there are more than `TCapacity` entries
+        template<typename TRange>
+            requires detail::sized_input_range_of<TRange, std::pair<TKey, TValue>>
+        constexpr explicit flat_map(TRange&& entries) {
+            append(std::forward<TRange>(entries));
+            const auto indices = detail::sorted_unique_indices<TCapacity>(
+                m_keys.size(),
+                [this](usize index) -> const TKey& { return m_keys[index]; },
+                TCompare{});
+            auto sorted_keys = mpl::static_vector<TKey, TCapacity>{};
+            auto sorted_values = mpl::static_vector<TValue, TCapacity>{};
+            for(const auto index : indices) {
+                sorted_keys.push_back(std::move(m_keys[index]));
+                sorted_values.push_back(std::move(m_values[index]));
+            }
+            m_keys = std::move(sorted_keys);
+            m_values = std::move(sorted_values);
+        }
+
+        /// @brief Constructs a `flat_map` from a range of entries whose keys are already
+        /// sorted and distinct, in linear time
+        /// @param entries The entries, in sorted key order
+        /// @throws std::length_error if there are more than `TCapacity` entries
+        /// @throws std::invalid_argument if the keys of `entries` are not sorted and distinct
+        template<typename TRange>
+            requires detail::sized_input_range_of<TRange, std::pair<TKey, TValue>>
+        constexpr flat_map([[maybe_unused]] sorted_unique_t tag, TRange&& entries) {
+            append(std::forward<TRange>(entries));
+            detail::check_sorted_unique(
+                m_keys.size(),
+                [this](usize index) -> const TKey& { return m_keys[index]; },
+                TCompare{});
+        }
+
+        [[nodiscard]] static constexpr auto capacity() noexcept -> size_type {
+            return mpl::static_vector<TKey, TCapacity>::capacity();
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> size_type {
+            return m_keys.size();
+        }
+
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+            return m_keys.empty();
+        }
+
+        /// @brief Returns the keys, in sorted order
+        /// @return the keys
+        [[nodiscard]] constexpr auto keys() const noexcept -> std::span<const TKey> {
+            return {m_keys.data(), m_keys.size()};
+        }
+
+        /// @brief Returns the values, in the sorted order of their keys
+        /// @return the values
+        [[nodiscard]] constexpr auto values() noexcept -> std::span<TValue> {
+            return {m_values.data(), m_values.size()};
+        }
+
+        /// @brief Returns the values, in the sorted order of their keys
+        /// @return the values
+        [[nodiscard]] constexpr auto values() const noexcept -> std::span<const TValue> {
+            return {m_values.data(), m_values.size()};
+        }
+
+        /// @brief Returns the index of the first key not ordered before `key`
+        /// @param key The key to search for
+        /// @return the index of the lower bound of `key`
+        template<typename TLookup>
+            requires detail::flat_lookup<TLookup, TKey, TCompare>
+        [[nodiscard]] constexpr auto lower_bound(const TLookup& key) const noexcept -> usize {
+            return static_cast<usize>(
+                std::lower_bound(m_keys.begin(), m_keys.end(), key, TCompare{})
+                - m_keys.begin());
+        }
+
+        /// @brief Returns the index of the entry for `key`, or `size()` if there is none
+        /// @param key The key to search for
+        /// @return the index of the entry for `key`
+        template<typename TLookup>
+            requires detail::flat_lookup<TLookup, TKey, TCompare>
+        [[nodiscard]] constexpr auto index_of(const TLookup& key) const noexcept -> usize {
+            const auto index = lower_bound(key);
+            if(index != size() && !TCompare{}(key, m_keys[index])) {
+                return index;
+            }
+            return size();
+        }
+
+        /// @brief Returns whether there is an entry for `key`
+        /// @param key The key to search for
+        /// @return whether there is an entry for `key`
+        template<typename TLookup>
+            requires detail::flat_lookup<TLookup, TKey, TCompare>
+        [[nodiscard]] constexpr auto contains(const TLookup& key) const noexcept -> bool {
+            return index_of(key) != size();
+        }
+
+        /// @brief Returns a pointer to the value for `key`, or `nullptr` if there is none
+        /// @param key The key to search for
+        /// @return a pointer to the value for `key`
+        template<typename TLookup>
+            requires detail::flat_lookup<TLookup, TKey, TCompare>
+        [[nodiscard]] constexpr auto find(const TLookup& key) noexcept -> TValue* {
+            const auto index = index_of(key);
+            return index == size() ? nullptr : m_values.data() + index;
+        }
+
+        /// @brief Returns a pointer to the value for `key`, or `nullptr` if there is none
+        /// @param key The key to search for
+        /// @return a pointer to the value for `key`
+        template<typename TLookup>
+            requires detail::flat_lookup<TLookup, TKey, TCompare>
+        [[nodiscard]] constexpr auto find(const TLookup& key) const noexcept -> const TValue* {
+            const auto index = index_of(key);
+            return index == size() ? nullptr : m_values.data() + index;
+        }
+
+        /// @brief Returns the value for `key`
+        /// @param key The key to search for
+        /// @return a reference to the value for `key`
+        /// @throws std::out_of_range if there is no entry for `key`
+        template<typename TLookup>
+            requires detail::flat_lookup<TLookup, TKey, TCompare>
+        [[nodiscard]] constexpr auto at(const TLookup& key) -> TValue& {
+            return m_values[checked_index_of(key)];
+        }
+
+        /// @brief Returns the value for `key`
+        /// @param key The key to search for
+        /// @return a reference to the value for `key`
+        /// @throws std::out_of_range if there is no entry for `key`
+        template<typename TLookup>
+            requires detail::flat_lookup<TLookup, TKey, TCompare>
+        [[nodiscard]] constexpr auto at(const TLookup& key) const -> const TValue& {
+            return m_values[checked_index_of(key)];
+        }
+
+        /// @brief Inserts an entry mapping `key` to a value constructed from `args`, if
+        /// there is no entry for `key`
+        /// @param key The key to insert
+        /// @param args The arguments to construct the value from
+        /// @return whether the entry was inserted
+        /// @throws std::length_error if there is no entry for `key` and this map is full
+        /// @note If constructing the value or copying `key` throws, this map is unchanged
+        template<typename... TArgs>
+            requires std::constructible_from<TValue, TArgs&&...>
+                     && std::is_nothrow_move_constructible_v<TValue>
+                     && std::is_nothrow_move_assignable_v<TValue>
+        constexpr auto try_emplace(const TKey& key, TArgs&&... args) -> bool {
+            const auto index = lower_bound(key);
+            if(index != size() && !TCompare{}(key, m_keys[index])) {
+                return false;
+            }
+            // construct the value before inserting the key, so that if it throws the keys
+            // and values stay in step. Inserting the key is all-or-nothing, and then
+            // inserting the value can't throw
+            auto value = TValue(std::forward<TArgs>(args)...);
+            m_keys.insert(m_keys.begin() + index, key);
+            m_values.insert(m_values.begin() + index, std::move(value));
+            return true;
+        }
+
+        /// @brief Maps `key` to `value`, replacing the existing value if there is one
+        /// @param key The key to insert
+        /// @param value The value to map `key` to
+        /// @return whether a new entry was inserted
+        /// @throws std::length_error if there is no entry for `key` and this map is full
+        template<typename TArg>
+            requires std::assignable_from<TValue&, TArg&&>
+                     && std::constructible_from<TValue, TArg&&>
+        constexpr auto insert_or_assign(const TKey& key, TArg&& value) -> bool {
+            if(auto* existing = find(key); existing != nullptr) {
+                *existing = std::forward<TArg>(value);
+                return false;
+            }
+            return try_emplace(key, std::forward<TArg>(value));
+        }
+
+        /// @brief Removes the entry for `key`, if there is one
+        /// @param key The key to remove
+        /// @return whether an entry was removed
+        template<typename TLookup>
+            requires detail::flat_lookup<TLookup, TKey, TCompare>
+        constexpr auto erase(const TLookup& key) -> bool {
+            const auto index = index_of(key);
+            if(index == size()) {
+                return false;
+            }
+            m_keys.erase(m_keys.begin() + index);
+            m_values.erase(m_values.begin() + index);
+            return true;
+        }
+
+        constexpr auto clear() noexcept -> void {
+            m_keys.clear();
+            m_values.clear();
+        }
+
+        [[nodiscard]] friend constexpr auto
+        operator==(const flat_map& lhs, const flat_map& rhs) noexcept -> bool
+            requires std::equality_comparable<TKey> && std::equality_comparable<TValue>
+        {
+            return lhs.m_keys == rhs.m_keys && lhs.m_values == rhs.m_values;
+        }
+
+      private:
+        mpl::static_vector<TKey, TCapacity> m_keys;
+        mpl::static_vector<TValue, TCapacity> m_values;
+
+        static constexpr auto check_count(usize count) -> usize {
+            if(count > TCapacity) {
+                throw std::length_error{"hyperion::mpl::flat_map capacity exceeded"};
+            }
+            return count;
+        }
+
+        /// @brief Appends the entries in `entries`, unsorted, to the (empty) keys and values
+        /// of this map
+        template<typename TRange>
+        constexpr auto append(TRange&& entries) -> void {
+            check_count(static_cast<usize>(std::ranges::size(entries)));
+            for(auto&& element : std::forward<TRange>(entries)) {
+                auto entry = static_cast<std::pair<TKey, TValue>>(
+                    std::forward<decltype(element)>(element));
+                m_keys.push_back(std::move(entry.first));
+                m_values.push_back(std::move(entry.second));
+            }
+        }
+
+        template<typename TLookup>
+        constexpr auto checked_index_of(const TLookup& key) const -> usize {
+            const auto index = index_of(key);
+            if(index == size()) {
+                throw std::out_of_range{"hyperion::mpl::flat_map key not found"};
+            }
+            return index;
+        }
+    };
+
+    namespace _test::flat_map {
+        inline constexpr auto primes = mpl::flat_set<int, 8>{7, 2, 5, 3, 2};
+
+        static_assert(primes.size() == 4 && primes.keys()[0] == 2 && primes.keys()[3] == 7,
+                      "hyperion::mpl::flat_set test case 1 (failing)");
+        static_assert(primes.contains(5) && not primes.contains(4),
+                      "hyperion::mpl::flat_set test case 2 (failing)");
+        static_assert(primes.index_of(7) == 3_usize && primes.index_of(8) == 4_usize,
+                      "hyperion::mpl::flat_set test case 3 (failing)");
+        static_assert(primes == mpl::flat_set<int, 8>{sorted_unique, {2, 3, 5, 7}},
+                      "hyperion::mpl::flat_set test case 4 (failing)");
+
+        inline constexpr auto squares = mpl::flat_map<int, int, 4>{
+            {3, 9},
+            {1, 1},
+            {2, 4},
+            {1, -1},
+        };
+
+        static_assert(squares.size() == 3 && squares.at(1) == 1 && squares.at(3) == 9,
+                      "hyperion::mpl::flat_map test case 1 (failing)");
+        static_assert(squares.find(4) == nullptr,
+                      "hyperion::mpl::flat_map test case 2 (failing)");
+        static_assert(std::is_trivially_copyable_v<mpl::flat_map<int, int, 4>>,
+                      "hyperion::mpl::flat_map test case 3 (failing)");
+
+        [[nodiscard]] constexpr auto test_modifiers() -> bool {
+            auto map = mpl::flat_map<int, int, 4>{};
+            auto result = map.try_emplace(2, 20);
+            result = result && map.try_emplace(1, 10);
+            result = result && not map.try_emplace(2, 0);
+            result = result && not map.insert_or_assign(2, 22);
+            result = result && map.erase(1) && not map.erase(1);
+            return result && map == mpl::flat_map<int, int, 4>{sorted_unique, {{2, 22}}};
+        }
+
+        static_assert(test_modifiers(), "hyperion::mpl::flat_map test case 4 (failing)");
+
+        /// @brief Returns the first `TCount` squares, largest first, as a stand-in for the
+        /// output of another `constexpr` algorithm
+        template<usize TCount>
+        [[nodiscard]] constexpr auto descending_squares()
+            -> std::array<std::pair<int, int>, TCount> {
+            auto entries = std::array<std::pair<int, int>, TCount>{};
+            for(auto index = 0_usize; index < TCount; ++index) {
+                const auto root = static_cast<int>(TCount - index);
+                entries[index] = {root, root * root};
+            }
+            return entries;
+        }
+
+        inline constexpr auto computed_squares
+            = mpl::flat_map<int, int, 4>{descending_squares<3>()};
+
+        static_assert(computed_squares.keys()[0] == 1 && computed_squares.at(3) == 9
+                          && computed_squares
+                                 == mpl::flat_map<int, int, 4>{sorted_unique,
+                                                               {{1, 1}, {2, 4}, {3, 9}}},
+                      "hyperion::mpl::flat_map test case 5 (failing)");
+
+        inline constexpr auto prime_array = std::array{7, 2, 5, 3, 2};
+
+        static_assert(mpl::flat_set<int, 8>{prime_array} == primes
+                          && mpl::flat_set<int, 8>{sorted_unique, std::span{primes.keys()}}
+                                 == primes,
+                      "hyperion::mpl::flat_set test case 5 (failing)");
+
+        template<typename TLookup>
+        concept can_look_up = requires(const mpl::flat_set<int, 4, std::less<int>>& set) {
+            set.contains(TLookup{});
+        };
+
+        static_assert(can_look_up<int> && not can_look_up<long>,
+                      "hyperion::mpl::flat_map requirements test case 1 (failing)");
+    } // namespace _test::flat_map
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_FLAT_MAP_H
@@ -0,0 +1,445 @@
+/// @file hot_cold.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Arrays of records split into separately stored hot and cold fields
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/metatypes.h>
+#include <hyperion/mpl/pair.h>
+#include <hyperion/mpl/record.h>
+#include <hyperion/mpl/value.h>
+
+#include <array>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup hot_cold Hot/Cold Field Splitting
+/// Hyperion provides `mpl::hot_cold_array` for storing an array of records whose fields are
+/// split into a dense block of frequently accessed ("hot") fields and a parallel block of
+/// rarely accessed ("cold") fields.
+///
+/// The record is described as an `mpl::List` of `mpl::Pair`s of field types and `mpl::Value`s
+/// marking whether each field is hot. Scans over only the hot fields then touch only the hot
+/// block, so they load as few cache lines as the hot fields alone require.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/hot_cold.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// using order_fields = List<Pair<u64, Value<false>>,        // id
+///                           Pair<i64, Value<true>>,         // price
+///                           Pair<u32, Value<true>>,         // quantity
+///                           Pair<fixed_string<16>, Value<false>>>; // client
+///
+/// auto orders = hot_cold_array<order_fields>{};
+/// orders.push_back(1_u64, 100_i64, 10_u32, fixed_string<16>{"client"});
+///
+/// auto notional = 0_i64;
+/// for(const auto& hot : orders.hot()) {
+///     notional += decltype(orders)::get<1>(hot) * decltype(orders)::get<2>(hot);
+/// }
+/// @endcode
+/// @headerfile hyperion/mpl/hot_cold.h
+/// @}
+
+#ifndef HYPERION_MPL_HOT_COLD_H
+    #define HYPERION_MPL_HOT_COLD_H
+
+namespace hyperion::mpl {
+
+    namespace detail {
+        /// @brief The mapping between the fields of a record and their positions in its hot
+        /// and cold blocks
+        template<usize TSize>
+        struct hot_cold_layout {
+            /// @brief Whether each field is hot
+            std::array<bool, TSize> is_hot = {};
+            /// @brief The index of each field within its block
+            std::array<usize, TSize> block_index = {};
+            /// @brief The field stored at each index of the hot block
+            std::array<usize, TSize> hot_order = {};
+            /// @brief The field stored at each index of the cold block
+            std::array<usize, TSize> cold_order = {};
+            usize hot_count = 0_usize;
+            usize cold_count = 0_usize;
+        };
+
+        /// @brief Computes the layout of a record split into hot and cold blocks.
+        /// Within each block, fields are ordered by decreasing alignment (and otherwise in
+        /// their listed order), so that the blocks need as little padding as possible
+        template<usize TSize>
+        [[nodiscard]] constexpr auto make_hot_cold_layout(const std::array<bool, TSize>& is_hot,
+                                                          const std::array<usize, TSize>& aligns)
+            -> hot_cold_layout<TSize> {
+            auto layout = hot_cold_layout<TSize>{};
+            layout.is_hot = is_hot;
+
+            const auto insert = [&aligns](std::array<usize, TSize>& order,
+                                          usize count,
+                                          usize field) {
+                auto position = count;
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                while(position > 0_usize && aligns[order[position - 1_usize]] < aligns[field]) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    order[position] = order[position - 1_usize];
+                    --position;
+                }
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                order[position] = field;
+            };
+
+            for(auto field = 0_usize; field < TSize; ++field) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                if(is_hot[field]) {
+                    insert(layout.hot_order, layout.hot_count++, field);
+                }
+                else {
+                    insert(layout.cold_order, layout.cold_count++, field);
+                }
+            }
+
+            for(auto index = 0_usize; index < layout.hot_count; ++index) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                layout.block_index[layout.hot_order[index]] = index;
+            }
+            for(auto index = 0_usize; index < layout.cold_count; ++index) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                layout.block_index[layout.cold_order[index]] = index;
+            }
+
+            return layout;
+        }
+
+        template<typename TTypes, auto TOrder, typename TIndices>
+        struct block_record;
+
+        template<typename... TTypes, auto TOrder, usize... TIndices>
+        struct block_record<std::tuple<TTypes...>, TOrder, std::index_sequence<TIndices...>> {
+            using type = record<List<std::tuple_element_t<TOrder[TIndices], // NOLINT
+                                                          std::tuple<TTypes...>>...>>;
+        };
+
+        template<typename TTypes, auto TOrder, usize TCount>
+        using block_record_t =
+            typename block_record<TTypes, TOrder, std::make_index_sequence<TCount>>::type;
+
+        template<typename TType>
+        concept hotness = MetaValue<TType>
+                          && std::convertible_to<decltype(TType::value), bool>;
+    } // namespace detail
+
+    /// @brief `hot_cold_array` is a dynamic array of records, stored as two parallel arrays:
+    /// one of the record's hot fields and one of its cold fields.
+    ///
+    /// The record is described by `TFields`, a `List` of `Pair`s of each field's type and a
+    /// `Value` that is truthy if the field is hot. The hot fields of each record are stored
+    /// together as a `hot_type` in one contiguous array, and the cold fields as a `cold_type` in
+    /// another. Within each block, fields are ordered by decreasing alignment to minimize
+    /// padding.
+    ///
+    /// Fields are accessed by their index in `TFields` with `get<I>(index)`, which routes to the
+    /// correct block, or directly from an element of `hot()` or `cold()` with the static
+    /// `get<I>(block)`.
+    ///
+    /// # Requirements
+    /// - `TFields` must be an `mpl::List` of `mpl::Pair`s, whose first element is an object type
+    /// and whose second element is a `MetaValue` convertible to `bool`
+    /// - Each field type must be default constructible
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// using fields = List<Pair<u64, Value<false>>, Pair<double, Value<true>>>;
+    /// auto values = hot_cold_array<fields>{};
+    /// values.push_back(1_u64, 2.0);
+    ///
+    /// values.get<1>(0) += 1.0;
+    /// // `price` is `3.0`
+    /// auto price = decltype(values)::get<1>(values.hot()[0]);
+    /// @endcode
+    ///
+    /// @tparam TFields The `List` of fields of the records
+    /// @ingroup hot_cold
+    /// @headerfile hyperion/mpl/hot_cold.h
+    template<typename TFields>
+    class hot_cold_array;
+
+    template<typename... TTypes, typename... THotness>
+        requires(sizeof...(TTypes) != 0)
+                && (std::is_object_v<detail::convert_to_raw_t<TTypes>> && ...)
+                && (std::default_initializable<detail::convert_to_raw_t<TTypes>> && ...)
+                && (detail::hotness<detail::convert_to_raw_t<THotness>> && ...)
+    class hot_cold_array<List<Pair<TTypes, THotness>...>> {
+      private:
+        using field_types = std::tuple<detail::convert_to_raw_t<TTypes>...>;
+
+        static inline constexpr auto layout = detail::make_hot_cold_layout(
+            std::array<bool, sizeof...(TTypes)>{
+                static_cast<bool>(detail::convert_to_raw_t<THotness>::value)...},
+            std::array<usize, sizeof...(TTypes)>{alignof(detail::convert_to_raw_t<TTypes>)...});
+
+      public:
+        /// @brief The type of the field at `TIndex`
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TTypes))
+        using field_type = std::tuple_element_t<TIndex, field_types>;
+
+        /// @brief The `record` type storing the hot fields of one record
+        using hot_type = detail::block_record_t<field_types, layout.hot_order, layout.hot_count>;
+
+        /// @brief The `record` type storing the cold fields of one record
+        using cold_type
+            = detail::block_record_t<field_types, layout.cold_order, layout.cold_count>;
+
+        /// @brief Returns whether the field at `TIndex` is stored in the hot block
+        /// @return whether the field at `TIndex` is hot
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TTypes))
+        [[nodiscard]] static constexpr auto is_hot() noexcept -> bool {
+            return std::get<TIndex>(layout.is_hot);
+        }
+
+        /// @brief Returns the number of records in this array
+        /// @return the number of records
+        [[nodiscard]] auto size() const noexcept -> usize {
+            return m_hot.size();
+        }
+
+        /// @brief Returns whether this array is empty
+        /// @return whether this array is empty
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return m_hot.empty();
+        }
+
+        /// @brief Reserves storage for at least `capacity` records in both blocks
+        /// @param capacity The number of records to reserve storage for
+        auto reserve(usize capacity) -> void {
+            m_hot.reserve(capacity);
+            if constexpr(has_cold) {
+                m_cold.reserve(capacity);
+            }
+        }
+
+        /// @brief Resizes this array to `count` records, value-initializing any new records
+        /// @param count The new number of records
+        auto resize(usize count) -> void {
+            const auto old_size = m_hot.size();
+            m_hot.resize(count);
+            if constexpr(has_cold) {
+                // keep both blocks the same size if growing the cold block throws
+                try {
+                    m_cold.resize(count);
+                }
+                catch(...) {
+                    m_hot.resize(old_size);
+                    throw;
+                }
+            }
+        }
+
+        /// @brief Removes every record from this array
+        auto clear() noexcept -> void {
+            m_hot.clear();
+            m_cold.clear();
+        }
+
+        /// @brief Appends a record with the given field values
+        /// @param values The values of the fields, in the order of `TFields`
+        template<typename... TValues>
+            requires(sizeof...(TValues) == sizeof...(TTypes))
+                    && (std::constructible_from<detail::convert_to_raw_t<TTypes>, TValues &&>
+                        && ...)
+        auto push_back(TValues&&... values) -> void {
+            auto arguments = std::forward_as_tuple(std::forward<TValues>(values)...);
+            auto hot = make_block<hot_type, layout.hot_order>(
+                arguments,
+                std::make_index_sequence<layout.hot_count>{});
+            if constexpr(has_cold) {
+                // build both blocks before growing either, and keep both blocks the same
+                // size if appending to the cold block throws
+                auto cold = make_block<cold_type, layout.cold_order>(
+                    arguments,
+                    std::make_index_sequence<layout.cold_count>{});
+                m_hot.push_back(std::move(hot));
+                try {
+                    m_cold.push_back(std::move(cold));
+                }
+                catch(...) {
+                    m_hot.pop_back();
+                    throw;
+                }
+            }
+            else {
+                m_hot.push_back(std::move(hot));
+            }
+        }
+
+        /// @brief Returns the field at `TIndex` of the record at `index`
+        ///
+        /// # Requirements
+        /// - `index` must be less than `size()`
+        ///
+        /// @param index The index of the record
+        /// @return a reference to the field
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TTypes))
+        [[nodiscard]] auto get(usize index) noexcept -> field_type<TIndex>& {
+            if constexpr(is_hot<TIndex>()) {
+                return get<TIndex>(m_hot[index]);
+            }
+            else {
+                return get<TIndex>(m_cold[index]);
+            }
+        }
+
+        /// @brief Returns the field at `TIndex` of the record at `index`
+        ///
+        /// # Requirements
+        /// - `index` must be less than `size()`
+        ///
+        /// @param index The index of the record
+        /// @return a reference to the field
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TTypes))
+        [[nodiscard]] auto get(usize index) const noexcept -> const field_type<TIndex>& {
+            if constexpr(is_hot<TIndex>()) {
+                return get<TIndex>(m_hot[index]);
+            }
+            else {
+                return get<TIndex>(m_cold[index]);
+            }
+        }
+
+        /// @brief Returns the field at `TIndex` from the block of a record that stores it
+        ///
+        /// @param block The hot or cold block of a record, as appropriate for `TIndex`
+        /// @return a reference to the field
+        template<usize TIndex, typename TBlock>
+            requires(TIndex < sizeof...(TTypes))
+                    && std::same_as<std::remove_const_t<TBlock>,
+                                    std::conditional_t<is_hot<TIndex>(), hot_type, cold_type>>
+        [[nodiscard]] static constexpr auto get(TBlock& block) noexcept -> auto& {
+            return block.template get<std::get<TIndex>(layout.block_index)>();
+        }
+
+        /// @brief Returns the hot blocks of the records in this array
+        /// @return the hot blocks
+        [[nodiscard]] auto hot() noexcept -> std::span<hot_type> {
+            return m_hot;
+        }
+
+        /// @brief Returns the hot blocks of the records in this array
+        /// @return the hot blocks
+        [[nodiscard]] auto hot() const noexcept -> std::span<const hot_type> {
+            return m_hot;
+        }
+
+        /// @brief Returns the cold blocks of the records in this array.
+        /// Empty if no field is cold
+        /// @return the cold blocks
+        [[nodiscard]] auto cold() noexcept -> std::span<cold_type> {
+            return m_cold;
+        }
+
+        /// @brief Returns the cold blocks of the records in this array.
+        /// Empty if no field is cold
+        /// @return the cold blocks
+        [[nodiscard]] auto cold() const noexcept -> std::span<const cold_type> {
+            return m_cold;
+        }
+
+      private:
+        static inline constexpr auto has_cold = layout.cold_count != 0_usize;
+
+        std::vector<hot_type> m_hot;
+        std::vector<cold_type> m_cold;
+
+        template<typename TBlock, auto TOrder, typename TArguments, usize... TIndices>
+        [[nodiscard]] static auto
+        make_block(TArguments& arguments,
+                   [[maybe_unused]] std::index_sequence<TIndices...> indices) -> TBlock {
+            if constexpr(sizeof...(TIndices) == 0) {
+                return TBlock{};
+            }
+            else {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                return TBlock{std::forward<std::tuple_element_t<TOrder[TIndices], TArguments>>(
+                    std::get<TOrder[TIndices]>(arguments))...};
+            }
+        }
+    };
+
+    namespace _test::hot_cold {
+        using order_fields = List<Pair<u8, Value<false>>,
+                                  Pair<i64, Value<true>>,
+                                  Pair<u64, Value<false>>,
+                                  Pair<u32, Value<true>>,
+                                  Pair<u16, Value<false>>,
+                                  Pair<u8, Value<true>>>;
+        using orders = hot_cold_array<order_fields>;
+
+        static_assert(std::same_as<orders::hot_type, mpl::record<List<i64, u32, u8>>>,
+                      "hyperion::mpl::hot_cold_array test case 1 (failing)");
+        static_assert(std::same_as<orders::cold_type, mpl::record<List<u64, u16, u8>>>,
+                      "hyperion::mpl::hot_cold_array test case 2 (failing)");
+        static_assert(sizeof(orders::hot_type) == 16_usize,
+                      "hyperion::mpl::hot_cold_array test case 3 (failing)");
+        static_assert(orders::is_hot<1>() && not orders::is_hot<2>(),
+                      "hyperion::mpl::hot_cold_array test case 4 (failing)");
+        static_assert(std::same_as<orders::field_type<4>, u16>,
+                      "hyperion::mpl::hot_cold_array test case 5 (failing)");
+
+        [[nodiscard]] constexpr auto test_block_get() noexcept -> bool {
+            auto hot = orders::hot_type{1_i64, 2_u32, 3_u8};
+            auto cold = orders::cold_type{4_u64, 5_u16, 6_u8};
+            return orders::get<1>(hot) == 1_i64 && orders::get<3>(hot) == 2_u32
+                   && orders::get<5>(hot) == 3_u8 && orders::get<2>(cold) == 4_u64
+                   && orders::get<4>(cold) == 5_u16 && orders::get<0>(cold) == 6_u8;
+        }
+
+        static_assert(test_block_get(), "hyperion::mpl::hot_cold_array test case 6 (failing)");
+
+        template<typename TFields>
+        concept valid_fields = requires { typename hot_cold_array<TFields>::hot_type; };
+
+        static_assert(valid_fields<List<Pair<int, Value<1>>>>,
+                      "hyperion::mpl::hot_cold_array requirements test case 1 (failing)");
+        static_assert(not valid_fields<List<>>,
+                      "hyperion::mpl::hot_cold_array requirements test case 2 (failing)");
+        static_assert(not valid_fields<List<Pair<int, double>>>,
+                      "hyperion::mpl::hot_cold_array requirements test case 3 (failing)");
+    } // namespace _test::hot_cold
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_HOT_COLD_H
@@ -0,0 +1,761 @@
+/// @file injector.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Dependency injection container whose object graph is resolved at compile time
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/metatypes.h>
+#include <hyperion/mpl/type.h>
+#include <hyperion/mpl/value.h>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup injector Dependency Injection
+/// Hyperion provides `mpl::injector` as a dependency injection container whose object graph
+/// is resolved entirely at compile time.
+///
+/// The components are given as an `mpl::List`. The constructor dependencies of each component
+/// are deduced from its constructors (with `Type::is_constructible_from`), the components are
+/// ordered so that every component is constructed after its dependencies, and they are laid
+/// out in a single contiguous block with no padding between them. At runtime, constructing
+/// the `injector` only runs the components' constructors (optionally in parallel, where they
+/// are independent), and `get<T>()` is a fixed offset into the block.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/injector.h>
+/// #include <hyperion/mpl/thread_pool.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// struct config { /** ... **/ };
+/// struct database {
+///     explicit database(const config& cfg);
+/// };
+/// struct order_service {
+///     order_service(database& db, const config& cfg);
+/// };
+///
+/// auto pool = work_stealing_pool{};
+/// // constructs `config`, then `database`, then `order_service`
+/// auto services = injector<List<order_service, database, config>>{pool};
+/// auto& orders = services.get<order_service>();
+/// @endcode
+/// @headerfile hyperion/mpl/injector.h
+/// @}
+
+#ifndef HYPERION_MPL_INJECTOR_H
+    #define HYPERION_MPL_INJECTOR_H
+
+namespace hyperion::mpl {
+
+    namespace detail {
+        template<usize TIndex, typename TType>
+        using indexed_as = TType;
+
+        /// @brief Placeholder constructor argument, convertible to an lvalue reference to
+        /// any of `TComponents` other than `TSelf`.
+        /// Used to find the number of dependencies `TSelf`'s constructor takes.
+        template<typename TSelf, typename... TComponents>
+        struct any_component {
+            template<typename TType>
+                requires(!std::same_as<std::remove_cv_t<TType>, TSelf>)
+                        && (std::same_as<std::remove_cv_t<TType>, TComponents> || ...)
+            operator TType&() const noexcept; // NOLINT(*-explicit-*)
+        };
+
+        /// @brief Placeholder constructor argument, convertible only to an lvalue reference
+        /// to `TComponent`.
+        /// Used to find which component a constructor takes at a given position.
+        template<typename TComponent>
+        struct exact_component {
+            template<typename TType>
+                requires std::same_as<std::remove_cv_t<TType>, TComponent>
+            operator TType&() const noexcept; // NOLINT(*-explicit-*)
+        };
+
+        /// @brief The constructor dependencies of `TSelf`, among `TComponents`.
+        ///
+        /// The number of dependencies is the largest number of `any_component`s `TSelf`
+        /// is constructible from. The dependency at each position is then the unique
+        /// component that can be passed at that position (as an `exact_component`) while
+        /// every other position takes an `any_component`.
+        ///
+        /// @tparam TSelf the component to resolve the dependencies of
+        /// @tparam TComponents all of the components in the container
+        template<typename TSelf, typename... TComponents>
+        struct constructor_resolution {
+          private:
+            using any = any_component<TSelf, TComponents...>;
+
+            template<usize... TPositions>
+            static constexpr auto
+            constructible_with([[maybe_unused]] std::index_sequence<TPositions...> positions)
+                -> bool {
+                return decltype_<TSelf>().is_constructible_from(
+                    List<indexed_as<TPositions, any>...>{});
+            }
+
+            template<usize... TArities>
+            static constexpr auto
+            find_arity([[maybe_unused]] std::index_sequence<TArities...> arities) -> usize {
+                auto arity = std::numeric_limits<usize>::max();
+                static_cast<void>(
+                    ((constructible_with(std::make_index_sequence<TArities>{}) ? (arity = TArities)
+                                                                               : arity),
+                     ...));
+                return arity;
+            }
+
+          public:
+            /// @brief The number of dependencies `TSelf`'s constructor takes, or the maximum
+            /// `usize` if it can not be constructed from the other components
+            static constexpr auto arity
+                = find_arity(std::make_index_sequence<sizeof...(TComponents)>{});
+
+            /// @brief Whether `TSelf` is constructible from some number of the other components
+            static constexpr auto resolved = arity != std::numeric_limits<usize>::max();
+
+          private:
+            template<usize TPosition, typename TCandidate, usize... TPositions>
+            static constexpr auto
+            constructible_at([[maybe_unused]] std::index_sequence<TPositions...> positions)
+                -> bool {
+                if constexpr(std::same_as<TCandidate, TSelf>) {
+                    return false;
+                }
+                else {
+                    return decltype_<TSelf>().is_constructible_from(
+                        List<std::conditional_t<TPositions == TPosition,
+                                                exact_component<TCandidate>,
+                                                any>...>{});
+                }
+            }
+
+            template<usize TPosition>
+            static constexpr auto candidates_at = std::array<bool, sizeof...(TComponents)>{
+                constructible_at<TPosition, TComponents>(std::make_index_sequence<arity>{})...};
+
+            template<usize... TPositions>
+            static constexpr auto
+            find_dependencies([[maybe_unused]] std::index_sequence<TPositions...> positions)
+                -> std::array<usize, sizeof...(TPositions)> {
+                return {index_of_first_true(candidates_at<TPositions>)...};
+            }
+
+            template<usize... TPositions>
+            static constexpr auto
+            find_unambiguous([[maybe_unused]] std::index_sequence<TPositions...> positions)
+                -> bool {
+                return ((std::count(candidates_at<TPositions>.begin(),
+                                    candidates_at<TPositions>.end(),
+                                    true)
+                         == 1)
+                        && ...);
+            }
+
+            using positions = std::make_index_sequence<resolved ? arity : 0_usize>;
+
+          public:
+            /// @brief The indices in `TComponents` of the dependencies of `TSelf`, in the order
+            /// its constructor takes them
+            static constexpr auto dependencies = find_dependencies(positions{});
+
+            /// @brief Whether the dependency at each position is a single, unique component
+            static constexpr auto unambiguous = find_unambiguous(positions{});
+        };
+
+        /// @brief The construction order and memory layout of the components of an `injector`
+        template<usize TSize>
+        struct injection_plan {
+            /// @brief The component indices, in construction order
+            std::array<usize, TSize> order = {};
+            /// @brief The index in `order` of the first component of each level, and of the end
+            /// of the last level
+            std::array<usize, TSize + 1> level_begin = {};
+            /// @brief The level of each component: the components in level `N` depend only on
+            /// components in levels less than `N`
+            std::array<usize, TSize> level = {};
+            /// @brief The number of levels
+            usize num_levels = 0_usize;
+            /// @brief Whether the dependency graph has no cycles
+            bool acyclic = true;
+            /// @brief The offset of each component in the storage block
+            std::array<usize, TSize> offset = {};
+            /// @brief The total size of the storage block
+            usize size = 0_usize;
+        };
+
+        /// @brief Computes the construction order and memory layout of the components of an
+        /// `injector`.
+        ///
+        /// Components are grouped into levels: each level contains every not yet constructed
+        /// component whose dependencies are all in earlier levels, so the components within a
+        /// level are independent of each other. In the storage block, components are ordered
+        /// by decreasing alignment, so that no padding is needed between them.
+        ///
+        /// @param depends_on whether each component depends on each other component
+        /// @param sizes the size of each component
+        /// @param aligns the alignment of each component
+        /// @return the plan for constructing and storing the components
+        template<usize TSize>
+        [[nodiscard]] constexpr auto
+        make_injection_plan(const std::array<std::array<bool, TSize>, TSize>& depends_on,
+                            const std::array<usize, TSize>& sizes,
+                            const std::array<usize, TSize>& aligns) -> injection_plan<TSize> {
+            auto plan = injection_plan<TSize>{};
+
+            auto placed = std::array<bool, TSize>{};
+            auto count = 0_usize;
+            while(count < TSize) {
+                auto ready = std::array<bool, TSize>{};
+                for(auto component = 0_usize; component < TSize; ++component) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    if(placed[component]) {
+                        continue;
+                    }
+                    auto dependencies_placed = true;
+                    for(auto dependency = 0_usize; dependency < TSize; ++dependency) {
+                        // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                        if(depends_on[component][dependency] && not placed[dependency]) {
+                            dependencies_placed = false;
+                        }
+                    }
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    ready[component] = dependencies_placed;
+                }
+
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                plan.level_begin[plan.num_levels] = count;
+                for(auto component = 0_usize; component < TSize; ++component) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    if(ready[component]) {
+                        // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                        placed[component] = true;
+                        // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                        plan.level[component] = plan.num_levels;
+                        // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                        plan.order[count++] = component;
+                    }
+                }
+
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                if(count == plan.level_begin[plan.num_levels]) {
+                    plan.acyclic = false;
+                    break;
+                }
+                ++plan.num_levels;
+            }
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            plan.level_begin[plan.num_levels] = count;
+
+            auto by_alignment = std::array<usize, TSize>{};
+            for(auto component = 0_usize; component < TSize; ++component) {
+                auto position = component;
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                while(position > 0_usize
+                      && aligns[by_alignment[position - 1_usize]] < aligns[component])
+                {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    by_alignment[position] = by_alignment[position - 1_usize];
+                    --position;
+                }
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                by_alignment[position] = component;
+            }
+
+            for(const auto component : by_alignment) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                plan.offset[component] = plan.size;
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                plan.size += sizes[component];
+            }
+
+            return plan;
+        }
+
+        /// @brief The dependency graph of `TComponents`
+        template<typename... TComponents>
+        struct injection_graph {
+          private:
+            template<typename TComponent>
+            static constexpr auto row() -> std::array<bool, sizeof...(TComponents)> {
+                auto depends_on = std::array<bool, sizeof...(TComponents)>{};
+                for(const auto dependency :
+                    constructor_resolution<TComponent, TComponents...>::dependencies)
+                {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    depends_on[dependency] = true;
+                }
+                return depends_on;
+            }
+
+          public:
+            /// @brief The plan for constructing and storing `TComponents`
+            static constexpr auto plan = make_injection_plan(
+                std::array<std::array<bool, sizeof...(TComponents)>, sizeof...(TComponents)>{
+                    row<TComponents>()...},
+                std::array<usize, sizeof...(TComponents)>{sizeof(TComponents)...},
+                std::array<usize, sizeof...(TComponents)>{alignof(TComponents)...});
+        };
+
+        /// @brief Whether the components `TComponents` can be managed by an `injector`:
+        /// each is constructible from a unique combination of the others, and no component
+        /// (transitively) depends on itself
+        template<typename... TComponents>
+        concept injectable = (sizeof...(TComponents) != 0)
+                             && (std::is_object_v<TComponents> && ...)
+                             && (std::is_destructible_v<TComponents> && ...)
+                             && unique_types<TComponents...>
+                             && (constructor_resolution<TComponents, TComponents...>::resolved
+                                 && ...)
+                             && (constructor_resolution<TComponents, TComponents...>::unambiguous
+                                 && ...)
+                             && injection_graph<TComponents...>::plan.acyclic;
+
+        /// @brief Executor running each job on the calling thread, in order.
+        /// Used by `injector`s constructed without an executor.
+        struct inline_executor {
+            struct job {
+                void (*invoke)(void* context) noexcept;
+                void* context;
+            };
+
+            auto execute(std::span<const job> jobs) const noexcept -> void {
+                for(const auto& current : jobs) {
+                    current.invoke(current.context);
+                }
+            }
+        };
+    } // namespace detail
+
+    /// @brief `injector` is a dependency injection container whose object graph is resolved
+    /// at compile time.
+    ///
+    /// `TComponents` is a `List` of the component types. The `injector` owns exactly one
+    /// instance of each. Each component is constructed by passing lvalue references to the
+    /// other components it depends on to its constructor (or, for aggregates, to its
+    /// aggregate initialization). Which components those are is deduced at compile time:
+    /// the constructor with the most parameters that can all be satisfied by other components
+    /// is used, and its parameter at each position must accept exactly one component.
+    ///
+    /// Components are constructed in dependency order, level by level: the components in each
+    /// level depend only on those in earlier levels. When an executor is given, the components
+    /// in each level are constructed in parallel on it. They are destroyed in the reverse of
+    /// the order they were constructed in. If a constructor throws, the components that were
+    /// already constructed are destroyed, and the (first, in construction order) exception is
+    /// rethrown. The same happens if the executor itself throws.
+    ///
+    /// The components are stored in a single contiguous block, ordered by decreasing
+    /// alignment so that there is no padding between them, and `get<T>()` is a fixed offset
+    /// into that block.
+    ///
+    /// # Requirements
+    /// - `TComponents` must be a non-empty `mpl::List` of distinct object types
+    /// - Each component must be constructible from lvalue references to some of the other
+    /// components, with each parameter accepting exactly one of them. Dependencies must be
+    /// taken as (possibly `const`) lvalue references, or by value, of the exact component type
+    /// - The components must not (transitively) depend on themselves
+    /// - When constructed with an executor, the components' constructors in each level must be
+    /// safe to run concurrently
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// struct config { u32 pool_size = 4_u32; };
+    /// struct database {
+    ///     explicit database(const config& cfg);
+    /// };
+    /// struct order_service {
+    ///     database& db;
+    ///     const config& cfg;
+    /// };
+    ///
+    /// using services = injector<List<order_service, database, config>>;
+    /// static_assert(services::dependencies_of<order_service>() == List<database, config>{});
+    /// static_assert(services::construction_order() == List<config, database, order_service>{});
+    ///
+    /// auto container = services{};
+    /// auto& orders = container.get<order_service>();
+    /// @endcode
+    ///
+    /// @tparam TComponents The `List` of component types
+    /// @ingroup injector
+    /// @headerfile hyperion/mpl/injector.h
+    template<typename TComponents>
+    class injector;
+
+    template<typename... TComponents>
+        requires detail::injectable<detail::convert_to_raw_t<TComponents>...>
+    class injector<List<TComponents...>> {
+      private:
+        using components = std::tuple<detail::convert_to_raw_t<TComponents>...>;
+        using graph = detail::injection_graph<detail::convert_to_raw_t<TComponents>...>;
+
+        static constexpr auto num_components = sizeof...(TComponents);
+        static constexpr auto plan = graph::plan;
+
+        template<typename TComponent>
+        static constexpr auto index_of
+            = detail::index_of_type<TComponent, detail::convert_to_raw_t<TComponents>...>;
+
+        template<typename TComponent>
+        static constexpr auto contains
+            = detail::count_of_type<TComponent, detail::convert_to_raw_t<TComponents>...>
+              == 1_usize;
+
+      public:
+        /// @brief The type of the component at `TIndex` in `TComponents`
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TComponents))
+        using component_type = std::tuple_element_t<TIndex, components>;
+
+        /// @brief Constructs every component, in dependency order, on the calling thread
+        injector() {
+            auto executor = detail::inline_executor{};
+            construct_all(executor);
+        }
+
+        /// @brief Constructs every component, in dependency order, constructing the
+        /// components in each level in parallel on `executor`
+        /// @param executor The executor to construct the components on
+        template<detail::job_executor TExecutor>
+        explicit injector(TExecutor& executor) {
+            construct_all(executor);
+        }
+
+        injector(const injector&) = delete;
+        injector(injector&&) = delete;
+        auto operator=(const injector&) -> injector& = delete;
+        auto operator=(injector&&) -> injector& = delete;
+
+        /// @brief Destroys every component, in the reverse of the order they were constructed in
+        ~injector() noexcept {
+            for(auto index = num_components; index > 0_usize; --index) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                destructors[plan.order[index - 1_usize]](this);
+            }
+        }
+
+        /// @brief Returns the component of type `TComponent`
+        /// @return a reference to the component
+        template<typename TComponent>
+            requires contains<TComponent>
+        [[nodiscard]] auto get() noexcept -> TComponent& {
+            return *std::launder(pointer_to<index_of<TComponent>>());
+        }
+
+        /// @brief Returns the component of type `TComponent`
+        /// @return a reference to the component
+        template<typename TComponent>
+            requires contains<TComponent>
+        [[nodiscard]] auto get() const noexcept -> const TComponent& {
+            return *std::launder(pointer_to<index_of<TComponent>>());
+        }
+
+        /// @brief Returns the components `TComponent`'s constructor takes, in order
+        /// @return the dependencies of `TComponent`, as a `List`
+        template<typename TComponent>
+            requires contains<TComponent>
+        [[nodiscard]] static constexpr auto dependencies_of() noexcept {
+            constexpr auto dependencies
+                = detail::constructor_resolution<TComponent,
+                                                 detail::convert_to_raw_t<TComponents>...>::
+                    dependencies;
+            return typename detail::select_indices<dependencies,
+                                                   std::make_index_sequence<dependencies.size()>,
+                                                   Type<detail::convert_to_raw_t<TComponents>>...>::
+                type{};
+        }
+
+        /// @brief Returns the components, in the order they are constructed in
+        /// @return the components in construction order, as a `List`
+        [[nodiscard]] static constexpr auto construction_order() noexcept {
+            return typename detail::select_indices<plan.order,
+                                                   std::make_index_sequence<num_components>,
+                                                   Type<detail::convert_to_raw_t<TComponents>>...>::
+                type{};
+        }
+
+        /// @brief Returns the level `TComponent` is constructed in: it depends only on
+        /// components in earlier levels, and is constructed concurrently with the other
+        /// components in its level
+        /// @return the construction level of `TComponent`
+        template<typename TComponent>
+            requires contains<TComponent>
+        [[nodiscard]] static constexpr auto level_of() noexcept -> usize {
+            return std::get<index_of<TComponent>>(plan.level);
+        }
+
+        /// @brief Returns the number of construction levels
+        /// @return the number of construction levels
+        [[nodiscard]] static constexpr auto num_levels() noexcept -> usize {
+            return plan.num_levels;
+        }
+
+        /// @brief Returns the offset of `TComponent` in the storage block
+        /// @return the offset of `TComponent`
+        template<typename TComponent>
+            requires contains<TComponent>
+        [[nodiscard]] static constexpr auto offset_of() noexcept -> usize {
+            return std::get<index_of<TComponent>>(plan.offset);
+        }
+
+        /// @brief Returns the size of the storage block holding the components
+        /// @return the size of the storage block
+        [[nodiscard]] static constexpr auto storage_size() noexcept -> usize {
+            return plan.size;
+        }
+
+      private:
+        alignas(detail::convert_to_raw_t<TComponents>...) std::array<std::byte, plan.size>
+            m_storage;
+
+        /// @brief The progress of constructing the components
+        struct construction {
+            injector* self;
+            std::array<bool, num_components> constructed = {};
+            std::array<std::exception_ptr, num_components> errors = {};
+        };
+
+        template<usize TIndex>
+        [[nodiscard]] auto pointer_to() const noexcept -> component_type<TIndex>* {
+            // NOLINTNEXTLINE(*-reinterpret-cast, *-const-cast)
+            return reinterpret_cast<component_type<TIndex>*>(const_cast<std::byte*>(
+                m_storage.data() + std::get<TIndex>(plan.offset)));
+        }
+
+        template<usize TIndex, usize... TPositions>
+        auto construct([[maybe_unused]] std::index_sequence<TPositions...> positions) -> void {
+            constexpr auto& dependencies
+                = detail::constructor_resolution<component_type<TIndex>,
+                                                 detail::convert_to_raw_t<TComponents>...>::
+                    dependencies;
+            std::construct_at(
+                pointer_to<TIndex>(),
+                *std::launder(pointer_to<std::get<TPositions>(dependencies)>())...);
+        }
+
+        template<usize TIndex>
+        static auto construct_job(void* context) noexcept -> void {
+            auto& state = *static_cast<construction*>(context);
+            try {
+                state.self->template construct<TIndex>(std::make_index_sequence<
+                    detail::constructor_resolution<component_type<TIndex>,
+                                                   detail::convert_to_raw_t<TComponents>...>::
+                        arity>{});
+                std::get<TIndex>(state.constructed) = true;
+            }
+            catch(...) {
+                std::get<TIndex>(state.errors) = std::current_exception();
+            }
+        }
+
+        template<usize TIndex>
+        static auto destroy(injector* self) noexcept -> void {
+            std::destroy_at(std::launder(self->template pointer_to<TIndex>()));
+        }
+
+        template<usize... TIndices>
+        static constexpr auto
+        make_constructors([[maybe_unused]] std::index_sequence<TIndices...> indices) noexcept {
+            return std::array<void (*)(void*) noexcept, num_components>{
+                &construct_job<TIndices>...};
+        }
+
+        template<usize... TIndices>
+        static constexpr auto
+        make_destructors([[maybe_unused]] std::index_sequence<TIndices...> indices) noexcept {
+            return std::array<void (*)(injector*) noexcept, num_components>{
+                &destroy<TIndices>...};
+        }
+
+        static constexpr auto constructors
+            = make_constructors(std::make_index_sequence<num_components>{});
+        static constexpr auto destructors
+            = make_destructors(std::make_index_sequence<num_components>{});
+
+        template<typename TJob, usize... TIndices>
+        static auto make_jobs(construction& state,
+                              [[maybe_unused]] std::index_sequence<TIndices...> indices) noexcept
+            -> std::array<TJob, num_components> {
+            return {TJob{constructors[plan.order[TIndices]], &state}...};
+        }
+
+        template<typename TExecutor>
+        auto construct_all(TExecutor& executor) -> void {
+            using job = typename TExecutor::job;
+
+            auto state = construction{this};
+            const auto jobs
+                = make_jobs<job>(state, std::make_index_sequence<num_components>{});
+            const auto all_jobs = std::span<const job>{jobs};
+
+            for(auto level = 0_usize; level < plan.num_levels; ++level) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                const auto begin = plan.level_begin[level];
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                const auto end = plan.level_begin[level + 1_usize];
+                try {
+                    executor.execute(all_jobs.subspan(begin, end - begin));
+                }
+                catch(...) {
+                    destroy_constructed(state, end);
+                    throw;
+                }
+
+                for(auto index = begin; index < end; ++index) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    if(state.errors[plan.order[index]] != nullptr) {
+                        destroy_constructed(state, end);
+                        // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                        std::rethrow_exception(state.errors[plan.order[index]]);
+                    }
+                }
+            }
+        }
+
+        /// @brief Destroys the components among the first `end` in construction order that
+        /// `state` records as constructed, in the reverse of that order
+        auto destroy_constructed(const construction& state, usize end) noexcept -> void {
+            for(auto constructed = end; constructed > 0_usize; --constructed) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                const auto component = plan.order[constructed - 1_usize];
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                if(state.constructed[component]) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    destructors[component](this);
+                }
+            }
+        }
+    };
+
+    namespace _test::injector {
+        struct config {
+            u32 pool_size = 1_u32;
+        };
+
+        struct database {
+            explicit database(const config& cfg) noexcept : connections{cfg.pool_size} {
+            }
+            u64 connections;
+        };
+
+        struct metrics {
+            u8 samples = 0_u8;
+        };
+
+        struct cache {
+            cache(database& database_ref, metrics& metrics_ref) noexcept
+                : db{&database_ref}, stats{&metrics_ref} {
+            }
+            database* db;
+            metrics* stats;
+        };
+
+        struct order_service {
+            cache& orders;
+            database& db;
+            const config& cfg;
+        };
+
+        using services = mpl::injector<List<order_service, cache, metrics, database, config>>;
+
+        static_assert(services::dependencies_of<config>() == List<>{},
+                      "hyperion::mpl::injector test case 1 (failing)");
+        static_assert(services::dependencies_of<database>() == List<config>{},
+                      "hyperion::mpl::injector test case 2 (failing)");
+        static_assert(services::dependencies_of<cache>() == List<database, metrics>{},
+                      "hyperion::mpl::injector test case 3 (failing)");
+        static_assert(services::dependencies_of<order_service>()
+                          == List<cache, database, config>{},
+                      "hyperion::mpl::injector test case 4 (failing)");
+        static_assert(services::construction_order()
+                          == List<metrics, config, database, cache, order_service>{},
+                      "hyperion::mpl::injector test case 5 (failing)");
+        static_assert(services::num_levels() == 4_usize
+                          && services::level_of<metrics>() == services::level_of<config>()
+                          && services::level_of<cache>() == 2_usize,
+                      "hyperion::mpl::injector test case 6 (failing)");
+        static_assert(services::storage_size()
+                          == sizeof(order_service) + sizeof(cache) + sizeof(metrics)
+                                 + sizeof(database) + sizeof(config),
+                      "hyperion::mpl::injector test case 7 (failing)");
+        static_assert(services::offset_of<metrics>() == services::storage_size() - sizeof(metrics),
+                      "hyperion::mpl::injector test case 8 (failing)");
+
+        struct cycle_second;
+        struct cycle_first {
+            explicit cycle_first(cycle_second& second) noexcept;
+        };
+        struct cycle_second {
+            explicit cycle_second(cycle_first& first) noexcept;
+        };
+
+        struct unresolvable {
+            explicit unresolvable(int value) noexcept;
+        };
+
+        struct ambiguous {
+            explicit ambiguous(const metrics& stats) noexcept;
+            explicit ambiguous(const config& cfg) noexcept;
+        };
+
+        template<typename TComponents>
+        concept valid_injector = requires { sizeof(mpl::injector<TComponents>); };
+
+        static_assert(valid_injector<List<database, config>>,
+                      "hyperion::mpl::injector requirements test case 1 (failing)");
+        static_assert(not valid_injector<List<database>>,
+                      "hyperion::mpl::injector requirements test case 2 (failing)");
+        static_assert(not valid_injector<List<cycle_first, cycle_second>>,
+                      "hyperion::mpl::injector requirements test case 3 (failing)");
+        static_assert(not valid_injector<List<unresolvable, config>>,
+                      "hyperion::mpl::injector requirements test case 4 (failing)");
+        static_assert(not valid_injector<List<ambiguous, metrics, config>>,
+                      "hyperion::mpl::injector requirements test case 5 (failing)");
+        static_assert(not valid_injector<List<config, config>>,
+                      "hyperion::mpl::injector requirements test case 6 (failing)");
+        static_assert(not valid_injector<List<>>,
+                      "hyperion::mpl::injector requirements test case 7 (failing)");
+    } // namespace _test::injector
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_INJECTOR_H
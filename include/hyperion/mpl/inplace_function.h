@@ -0,0 +1,415 @@
+/// @file inplace_function.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Type-erased callable with inline storage sized from a `List` of callable types
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/list.h>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup inplace_function Inplace Functions
+/// Hyperion provides `mpl::inplace_function` as a type-erased callable wrapper, like
+/// `std::function`, that stores its callable inline and never allocates.
+///
+/// The size and alignment of its inline buffer are computed at compile time from an
+/// `mpl::List` of the callable types it must be able to hold. It can hold any copyable
+/// callable that fits in that buffer.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/inplace_function.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// auto scale = 2.0;
+/// auto offset = 1.0;
+/// auto affine = [scale, offset](double value) { return value * scale + offset; };
+/// auto square = [](double value) { return value * value; };
+///
+/// using transform = inplace_function<double(double), List<decltype(affine),
+///                                                         decltype(square)>>;
+///
+/// auto func = transform{affine};
+/// // `result` is `7.0`
+/// auto result = func(3.0);
+/// func = square;
+/// @endcode
+/// @headerfile hyperion/mpl/inplace_function.h
+/// @}
+
+#ifndef HYPERION_MPL_INPLACE_FUNCTION_H
+    #define HYPERION_MPL_INPLACE_FUNCTION_H
+
+namespace hyperion::mpl {
+
+    namespace detail {
+        /// @brief The operations of the callable held by an `inplace_function`.
+        ///
+        /// `copy`, `move`, and `destroy` are `nullptr` when the callable is trivially
+        /// copyable, in which case the storage is copied with `std::memcpy` and never
+        /// destroyed.
+        template<typename TReturn, typename... TArgs>
+        struct inplace_function_vtable {
+            TReturn (*invoke)(std::byte* storage, TArgs&&... args);
+            void (*copy)(const std::byte* source, std::byte* destination);
+            void (*move)(std::byte* source, std::byte* destination) noexcept;
+            void (*destroy)(std::byte* storage) noexcept;
+        };
+
+        template<typename TCallable, typename TReturn, typename... TArgs>
+        auto inplace_invoke(std::byte* storage, TArgs&&... args) -> TReturn {
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            auto& callable = *std::launder(reinterpret_cast<TCallable*>(storage));
+            if constexpr(std::is_void_v<TReturn>) {
+                std::invoke(callable, std::forward<TArgs>(args)...);
+            }
+            else {
+                return std::invoke(callable, std::forward<TArgs>(args)...);
+            }
+        }
+
+        template<typename TCallable>
+        auto inplace_copy(const std::byte* source, std::byte* destination) -> void {
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            std::construct_at(reinterpret_cast<TCallable*>(destination),
+                              // NOLINTNEXTLINE(*-reinterpret-cast)
+                              *std::launder(reinterpret_cast<const TCallable*>(source)));
+        }
+
+        template<typename TCallable>
+        auto inplace_move(std::byte* source, std::byte* destination) noexcept -> void {
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            std::construct_at(reinterpret_cast<TCallable*>(destination),
+                              // NOLINTNEXTLINE(*-reinterpret-cast)
+                              std::move(*std::launder(reinterpret_cast<TCallable*>(source))));
+        }
+
+        template<typename TCallable>
+        auto inplace_destroy(std::byte* storage) noexcept -> void {
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            std::destroy_at(std::launder(reinterpret_cast<TCallable*>(storage)));
+        }
+
+        template<typename TReturn, typename... TArgs>
+        [[noreturn]] auto inplace_invoke_empty([[maybe_unused]] std::byte* storage,
+                                               [[maybe_unused]] TArgs&&... args) -> TReturn {
+            throw std::bad_function_call{};
+        }
+
+        /// @brief The single vtable shared by every `inplace_function` holding a `TCallable`.
+        /// Not `static`, so that there is one instance across all translation units
+        template<typename TCallable, typename TReturn, typename... TArgs>
+        inline constexpr auto inplace_vtable_for = [] {
+            if constexpr(std::is_trivially_copyable_v<TCallable>) {
+                return inplace_function_vtable<TReturn, TArgs...>{
+                    &inplace_invoke<TCallable, TReturn, TArgs...>,
+                    nullptr,
+                    nullptr,
+                    nullptr};
+            }
+            else {
+                return inplace_function_vtable<TReturn, TArgs...>{
+                    &inplace_invoke<TCallable, TReturn, TArgs...>,
+                    &inplace_copy<TCallable>,
+                    &inplace_move<TCallable>,
+                    &inplace_destroy<TCallable>};
+            }
+        }();
+
+        /// @brief The vtable of an empty `inplace_function`, whose invocation throws
+        /// `std::bad_function_call`. Not `static`, so that emptiness can be checked by address
+        /// across translation units
+        template<typename TReturn, typename... TArgs>
+        inline constexpr auto inplace_empty_vtable
+            = inplace_function_vtable<TReturn, TArgs...>{&inplace_invoke_empty<TReturn, TArgs...>,
+                                                         nullptr,
+                                                         nullptr,
+                                                         nullptr};
+    } // namespace detail
+
+    /// @brief `inplace_function` is a type-erased, copyable callable wrapper with inline
+    /// storage, sized and aligned for the largest of the callable types in `TCallables`.
+    ///
+    /// Like `std::function<TSignature>`, an `inplace_function` can hold any copyable
+    /// callable invocable with the signature `TSignature`, but it stores the callable in an
+    /// inline buffer instead of allocating, so it can only hold callables whose size and
+    /// alignment are no greater than those of the largest callable in `TCallables`. Each
+    /// callable type has a single static vtable, shared by every `inplace_function` holding
+    /// it. Copying, moving, and destroying trivially copyable callables bypasses the vtable
+    /// entirely: the buffer is copied with `std::memcpy` and never destroyed.
+    ///
+    /// Invoking an empty `inplace_function` throws `std::bad_function_call`.
+    ///
+    /// # Requirements
+    /// - `TSignature` must be a function type, `TReturn(TArgs...)`
+    /// - `TCallables` must be a non-empty `mpl::List` of object types
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// auto count = 0;
+    /// auto increment = [&count](int amount) { count += amount; };
+    ///
+    /// auto func = inplace_function<void(int), List<decltype(increment)>>{increment};
+    /// func(2);
+    /// // `count` is `2`
+    /// @endcode
+    ///
+    /// @tparam TSignature The signature the held callable must be invocable with
+    /// @tparam TCallables The `List` of callable types the buffer is sized for
+    /// @ingroup inplace_function
+    /// @headerfile hyperion/mpl/inplace_function.h
+    template<typename TSignature, typename TCallables>
+    class inplace_function;
+
+    template<typename TReturn, typename... TArgs, typename... TCallables>
+        requires(sizeof...(TCallables) != 0)
+                && (std::is_object_v<detail::convert_to_raw_t<TCallables>> && ...)
+    class inplace_function<TReturn(TArgs...), List<TCallables...>> {
+      private:
+        using vtable = detail::inplace_function_vtable<TReturn, TArgs...>;
+
+        static inline constexpr auto storage_size
+            = decltype(List<detail::convert_to_raw_t<TCallables>...>{}.max_sizeof())::value;
+        static inline constexpr auto storage_alignment
+            = decltype(List<detail::convert_to_raw_t<TCallables>...>{}.max_alignof())::value;
+
+      public:
+        /// @brief Returns the size of the inline buffer
+        /// @return the largest `sizeof` of the types in `TCallables`
+        [[nodiscard]] static constexpr auto capacity() noexcept -> usize {
+            return storage_size;
+        }
+
+        /// @brief Returns the alignment of the inline buffer
+        /// @return the largest `alignof` of the types in `TCallables`
+        [[nodiscard]] static constexpr auto alignment() noexcept -> usize {
+            return storage_alignment;
+        }
+
+        /// @brief Returns whether a `TCallable` can be stored in an `inplace_function`
+        /// of this type
+        /// @return whether `TCallable` fits in the inline buffer, is copyable and nothrow
+        /// movable, and is invocable with `TArgs` returning a type convertible to `TReturn`
+        template<typename TCallable>
+        [[nodiscard]] static constexpr auto can_hold() noexcept -> bool {
+            return sizeof(TCallable) <= storage_size && alignof(TCallable) <= storage_alignment
+                   && std::copy_constructible<TCallable>
+                   && std::is_nothrow_move_constructible_v<TCallable>
+                   && std::is_invocable_r_v<TReturn, TCallable&, TArgs...>;
+        }
+
+        /// @brief Constructs an empty `inplace_function`
+        inplace_function() noexcept = default;
+
+        /// @brief Constructs an empty `inplace_function`
+        inplace_function(std::nullptr_t) noexcept { // NOLINT(*-explicit-*)
+        }
+
+        /// @brief Constructs an `inplace_function` holding a copy of `callable`
+        /// @param callable The callable to hold
+        template<typename TCallable>
+            requires(!std::same_as<std::remove_cvref_t<TCallable>, inplace_function>)
+                    && (can_hold<std::remove_cvref_t<TCallable>>())
+        inplace_function(TCallable&& callable) // NOLINT(*-explicit-*)
+            noexcept(std::is_nothrow_constructible_v<std::remove_cvref_t<TCallable>, TCallable&&>)
+            : m_vtable{&detail::inplace_vtable_for<std::remove_cvref_t<TCallable>,
+                                                   TReturn,
+                                                   TArgs...>} {
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            std::construct_at(reinterpret_cast<std::remove_cvref_t<TCallable>*>(m_storage.data()),
+                              std::forward<TCallable>(callable));
+        }
+
+        inplace_function(const inplace_function& other) : m_vtable{other.m_vtable} {
+            if(m_vtable->copy == nullptr) {
+                std::memcpy(m_storage.data(), other.m_storage.data(), storage_size);
+            }
+            else {
+                m_vtable->copy(other.m_storage.data(), m_storage.data());
+            }
+        }
+
+        /// @brief Moves the callable held by `other` into this `inplace_function`, leaving
+        /// `other` empty
+        inplace_function(inplace_function&& other) noexcept : m_vtable{other.m_vtable} {
+            take(other);
+        }
+
+        ~inplace_function() noexcept {
+            reset();
+        }
+
+        auto operator=(const inplace_function& other) -> inplace_function& {
+            if(this != &other) {
+                auto copy = inplace_function{other};
+                reset();
+                m_vtable = copy.m_vtable;
+                take(copy);
+            }
+            return *this;
+        }
+
+        /// @brief Moves the callable held by `other` into this `inplace_function`, leaving
+        /// `other` empty
+        auto operator=(inplace_function&& other) noexcept -> inplace_function& {
+            if(this != &other) {
+                reset();
+                m_vtable = other.m_vtable;
+                take(other);
+            }
+            return *this;
+        }
+
+        /// @brief Destroys the held callable, leaving this `inplace_function` empty
+        auto operator=(std::nullptr_t) noexcept -> inplace_function& {
+            reset();
+            return *this;
+        }
+
+        /// @brief Replaces the held callable with a copy of `callable`
+        /// @param callable The callable to hold
+        template<typename TCallable>
+            requires(!std::same_as<std::remove_cvref_t<TCallable>, inplace_function>)
+                    && (can_hold<std::remove_cvref_t<TCallable>>())
+        auto operator=(TCallable&& callable) noexcept(
+            std::is_nothrow_constructible_v<std::remove_cvref_t<TCallable>, TCallable&&>)
+            -> inplace_function& {
+            reset();
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            std::construct_at(reinterpret_cast<std::remove_cvref_t<TCallable>*>(m_storage.data()),
+                              std::forward<TCallable>(callable));
+            m_vtable = &detail::inplace_vtable_for<std::remove_cvref_t<TCallable>,
+                                                   TReturn,
+                                                   TArgs...>;
+            return *this;
+        }
+
+        /// @brief Invokes the held callable with `args`
+        ///
+        /// @param args The arguments to invoke the callable with
+        /// @return the result of the invocation
+        /// @throws std::bad_function_call if this `inplace_function` is empty
+        auto operator()(TArgs... args) const -> TReturn {
+            return m_vtable->invoke(m_storage.data(), std::forward<TArgs>(args)...);
+        }
+
+        /// @brief Returns whether this `inplace_function` holds a callable
+        /// @return whether this is non-empty
+        [[nodiscard]] explicit operator bool() const noexcept {
+            return m_vtable != &detail::inplace_empty_vtable<TReturn, TArgs...>;
+        }
+
+        [[nodiscard]] friend auto
+        operator==(const inplace_function& func, [[maybe_unused]] std::nullptr_t null) noexcept
+            -> bool {
+            return !static_cast<bool>(func);
+        }
+
+      private:
+        const vtable* m_vtable = &detail::inplace_empty_vtable<TReturn, TArgs...>;
+        alignas(storage_alignment) mutable std::array<std::byte, storage_size> m_storage;
+
+        /// @brief Destroys the held callable, if any, and makes this empty
+        auto reset() noexcept -> void {
+            if(m_vtable->destroy != nullptr) {
+                m_vtable->destroy(m_storage.data());
+            }
+            m_vtable = &detail::inplace_empty_vtable<TReturn, TArgs...>;
+        }
+
+        /// @brief Moves the callable held by `other` into this, whose vtable has already
+        /// been set to `other`'s, and makes `other` empty
+        auto take(inplace_function& other) noexcept -> void {
+            if(m_vtable->move == nullptr) {
+                std::memcpy(m_storage.data(), other.m_storage.data(), storage_size);
+            }
+            else {
+                m_vtable->move(other.m_storage.data(), m_storage.data());
+            }
+            other.reset();
+        }
+    };
+
+    namespace _test::inplace_function {
+        using small = std::array<i32, 2>;
+        using large = std::array<i64, 4>;
+
+        struct small_callable {
+            small values;
+
+            [[nodiscard]] auto operator()(i32 value) const noexcept -> i32 {
+                return value + values[0];
+            }
+        };
+
+        struct large_callable {
+            large values;
+
+            [[nodiscard]] auto operator()(i32 value) const noexcept -> i32 {
+                return value + static_cast<i32>(values[0]);
+            }
+        };
+
+        struct huge_callable {
+            std::array<large, 2> values;
+
+            [[nodiscard]] auto operator()(i32 value) const noexcept -> i32 {
+                return value;
+            }
+        };
+
+        using function = mpl::inplace_function<i32(i32), List<small_callable, large_callable>>;
+
+        static_assert(function::capacity() == sizeof(large),
+                      "hyperion::mpl::inplace_function test case 1 (failing)");
+        static_assert(function::alignment() == alignof(i64),
+                      "hyperion::mpl::inplace_function test case 2 (failing)");
+        static_assert(sizeof(function) == sizeof(large) + sizeof(void*),
+                      "hyperion::mpl::inplace_function test case 3 (failing)");
+        static_assert(std::constructible_from<function, small_callable>,
+                      "hyperion::mpl::inplace_function test case 4 (failing)");
+        static_assert(not std::constructible_from<function, huge_callable>,
+                      "hyperion::mpl::inplace_function test case 5 (failing)");
+        static_assert(not function::can_hold<small>(),
+                      "hyperion::mpl::inplace_function test case 6 (failing)");
+        static_assert(std::copyable<function>,
+                      "hyperion::mpl::inplace_function test case 7 (failing)");
+    } // namespace _test::inplace_function
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_INPLACE_FUNCTION_H
@@ -0,0 +1,849 @@
+/// @file json.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Single-pass JSON decoder specialised for a fixed schema of fields
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/detail/all_distinct.h>
+#include <hyperion/mpl/detail/perfect_hash.h>
+#include <hyperion/mpl/fixed_string.h>
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/metatypes.h>
+#include <hyperion/mpl/pair.h>
+#include <hyperion/mpl/record.h>
+#include <hyperion/mpl/type.h>
+#include <hyperion/mpl/value.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstring>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup json JSON Decoding
+/// Hyperion provides `mpl::json_record` for decoding JSON objects with a known schema
+/// directly into a record generated from an `mpl::List` of `mpl::Pair`s of field names and
+/// field types.
+///
+/// Decoding is a single pass over the input, without building a document tree: keys are
+/// dispatched to their fields through a perfect hash table built at compile time, numbers
+/// are parsed with `std::from_chars` directly into their fields, and whitespace and string
+/// contents are scanned eight bytes at a time. Keys that are not in the schema have their
+/// values skipped without being parsed.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/json.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// using trade = json_record<List<Pair<Value<fixed_string{"id"}>, Type<u64>>,
+///                                Pair<Value<fixed_string{"price"}>, Type<double>>,
+///                                Pair<Value<fixed_string{"symbol"}>, Type<fixed_string<8>>>>>;
+///
+/// auto value = trade{};
+/// if(value.decode(R"({"id": 42, "venue": "XNAS", "price": 101.5, "symbol": "ABC"})")) {
+///     process(value.get<"id">(), value.get<"price">(), value.get<"symbol">());
+/// }
+/// @endcode
+/// @headerfile hyperion/mpl/json.h
+/// @}
+
+#ifndef HYPERION_MPL_JSON_H
+    #define HYPERION_MPL_JSON_H
+
+namespace hyperion::mpl {
+
+    /// @brief The errors that can occur when decoding JSON
+    /// @ingroup json
+    /// @headerfile hyperion/mpl/json.h
+    enum class json_errc : u8 {
+        /// @brief Decoding succeeded
+        none,
+        /// @brief The input is not a valid JSON object
+        syntax_error,
+        /// @brief The input ended before the end of the JSON object
+        unexpected_end,
+        /// @brief A field's value is not a valid value of the field's type
+        invalid_value,
+    };
+
+    /// @brief The result of decoding JSON with `mpl::json_record`
+    /// @ingroup json
+    /// @headerfile hyperion/mpl/json.h
+    struct json_result {
+        /// @brief The error that stopped decoding, if any
+        json_errc error = json_errc::none;
+        /// @brief The offset in the input at which decoding stopped
+        usize offset = 0_usize;
+
+        /// @brief Returns whether decoding succeeded
+        [[nodiscard]] constexpr explicit operator bool() const noexcept {
+            return error == json_errc::none;
+        }
+    };
+
+    namespace detail {
+        /// @brief Whether numbers can be parsed into a `TType` with `std::from_chars`.
+        /// Excludes the character types, such as `char16_t`, which are integral but have no
+        /// `std::from_chars` overload
+        template<typename TType>
+        concept json_number = (std::integral<TType> || std::floating_point<TType>)
+                              && requires(const char* chars, TType& value) {
+                                     std::from_chars(chars, chars, value);
+                                 };
+
+        /// @brief Whether fields of type `TType` can be decoded
+        template<typename TType>
+        concept json_value = std::same_as<TType, bool> || json_number<TType>
+                             || std::same_as<TType, std::string_view>
+                             || is_fixed_string<TType>::value;
+
+        /// @brief Whether `TPair` is a `Pair` of a `Value` holding a `fixed_string` and the
+        /// type of a field that can be decoded
+        template<typename TPair>
+        concept json_field
+            = MetaPair<TPair> && MetaValue<typename TPair::first>
+              && is_fixed_string<std::remove_cvref_t<decltype(TPair::first::value)>>::value
+              && json_value<convert_to_raw_t<typename TPair::second>>;
+
+        template<typename TPair>
+        using json_field_t = convert_to_raw_t<typename TPair::second>;
+
+        static inline constexpr auto json_swar_ones = 0x0101010101010101_u64;
+        static inline constexpr auto json_swar_high = 0x8080808080808080_u64;
+
+        /// @brief Returns a mask with the high bit of each byte of `word` that equals `byte`
+        /// set, and all other bits clear
+        [[nodiscard]] constexpr auto json_bytes_equal(u64 word, char byte) noexcept -> u64 {
+            const auto diff = word ^ (json_swar_ones * static_cast<u8>(byte));
+            return ~(((diff & ~json_swar_high) + ~json_swar_high) | diff) & json_swar_high;
+        }
+
+        /// @brief Returns the index of the first byte (in memory order) flagged in `mask`
+        [[nodiscard]] constexpr auto json_first_byte(u64 mask) noexcept -> usize {
+            if constexpr(std::endian::native == std::endian::little) {
+                return static_cast<usize>(std::countr_zero(mask)) / 8_usize;
+            }
+            else {
+                return static_cast<usize>(std::countl_zero(mask)) / 8_usize;
+            }
+        }
+
+        [[nodiscard]] inline auto json_load(const char* data) noexcept -> u64 {
+            auto word = 0_u64;
+            std::memcpy(&word, data, sizeof(word));
+            return word;
+        }
+
+        /// @brief Returns a pointer to the first of `TChars` in `[first, last)`, or `last`.
+        /// Scans eight bytes at a time
+        template<char... TChars>
+        [[nodiscard]] inline auto json_find_first_of(const char* first, const char* last) noexcept
+            -> const char* {
+            while(last - first >= static_cast<isize>(sizeof(u64))) {
+                const auto word = json_load(first);
+                const auto mask = (json_bytes_equal(word, TChars) | ...);
+                if(mask != 0_u64) {
+                    return first + json_first_byte(mask);
+                }
+                first += sizeof(u64);
+            }
+            while(first != last && ((*first != TChars) && ...)) {
+                ++first;
+            }
+            return first;
+        }
+
+        [[nodiscard]] constexpr auto json_is_whitespace(char character) noexcept -> bool {
+            return character == ' ' || character == '\n' || character == '\r'
+                   || character == '\t';
+        }
+
+        /// @brief Returns a pointer to the first non-whitespace character in `[first, last)`,
+        /// or `last`. Scans eight bytes at a time
+        [[nodiscard]] inline auto json_skip_whitespace(const char* first, const char* last) noexcept
+            -> const char* {
+            // most tokens are separated by at most one whitespace character
+            if(first == last || not json_is_whitespace(*first)) {
+                return first;
+            }
+            ++first;
+            while(last - first >= static_cast<isize>(sizeof(u64))) {
+                const auto word = json_load(first);
+                const auto whitespace = json_bytes_equal(word, ' ') | json_bytes_equal(word, '\n')
+                                        | json_bytes_equal(word, '\r')
+                                        | json_bytes_equal(word, '\t');
+                const auto mask = ~whitespace & json_swar_high;
+                if(mask != 0_u64) {
+                    return first + json_first_byte(mask);
+                }
+                first += sizeof(u64);
+            }
+            while(first != last && json_is_whitespace(*first)) {
+                ++first;
+            }
+            return first;
+        }
+
+        [[nodiscard]] constexpr auto json_hex_digit(char character) noexcept -> i32 {
+            if(character >= '0' && character <= '9') {
+                return character - '0';
+            }
+            if(character >= 'a' && character <= 'f') {
+                return character - 'a' + 10;
+            }
+            if(character >= 'A' && character <= 'F') {
+                return character - 'A' + 10;
+            }
+            return -1;
+        }
+
+        [[nodiscard]] constexpr auto json_is_digit(char character) noexcept -> bool {
+            return character >= '0' && character <= '9';
+        }
+
+        /// @brief Returns the end of the JSON number at the start of `text`, or `npos` if
+        /// `text` does not start with one.
+        /// Unlike `std::from_chars`, this rejects `nan`, `inf`, leading `+`s, leading zeros,
+        /// and `.`s without digits on both sides
+        [[nodiscard]] constexpr auto json_number_length(std::string_view text) noexcept -> usize {
+            auto index = 0_usize;
+            const auto digits = [&]() noexcept -> bool {
+                const auto begin = index;
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                while(index < text.size() && json_is_digit(text[index])) {
+                    ++index;
+                }
+                return index != begin;
+            };
+            const auto next_is = [&](char character) noexcept -> bool {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                if(index < text.size() && text[index] == character) {
+                    ++index;
+                    return true;
+                }
+                return false;
+            };
+
+            static_cast<void>(next_is('-'));
+            if(not next_is('0') && not digits()) {
+                return std::string_view::npos;
+            }
+            if(next_is('.') && not digits()) {
+                return std::string_view::npos;
+            }
+            if(next_is('e') || next_is('E')) {
+                if(not next_is('+')) {
+                    static_cast<void>(next_is('-'));
+                }
+                if(not digits()) {
+                    return std::string_view::npos;
+                }
+            }
+            return index;
+        }
+
+        /// @brief Unescapes the raw contents of a JSON string into `out`
+        /// @return The length of the unescaped string, or `npos` if `raw` contains an invalid
+        /// escape sequence or its unescaped length is greater than `out.size()`
+        template<usize TSize>
+        [[nodiscard]] constexpr auto
+        json_unescape(std::string_view raw, std::array<char, TSize>& out) noexcept -> usize {
+            constexpr auto npos = std::string_view::npos;
+            auto length = 0_usize;
+            const auto append = [&](u32 character) noexcept -> bool {
+                if(length == TSize) {
+                    return false;
+                }
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                out[length++] = static_cast<char>(character);
+                return true;
+            };
+
+            auto index = 0_usize;
+            while(index < raw.size()) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                const auto character = raw[index++];
+                if(character != '\\') {
+                    if(not append(static_cast<u8>(character))) {
+                        return npos;
+                    }
+                    continue;
+                }
+                if(index == raw.size()) {
+                    return npos;
+                }
+
+                auto code_point = 0_u32;
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                switch(raw[index++]) {
+                    case '"': code_point = '"'; break;
+                    case '\\': code_point = '\\'; break;
+                    case '/': code_point = '/'; break;
+                    case 'b': code_point = '\b'; break;
+                    case 'f': code_point = '\f'; break;
+                    case 'n': code_point = '\n'; break;
+                    case 'r': code_point = '\r'; break;
+                    case 't': code_point = '\t'; break;
+                    case 'u': {
+                        const auto read_hex = [&]() noexcept -> i64 {
+                            if(raw.size() - index < 4_usize) {
+                                return -1;
+                            }
+                            auto value = 0_i64;
+                            for(auto digit = 0_usize; digit < 4_usize; ++digit) {
+                                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                                const auto nibble = json_hex_digit(raw[index++]);
+                                if(nibble < 0) {
+                                    return -1;
+                                }
+                                value = value * 16 + nibble;
+                            }
+                            return value;
+                        };
+
+                        const auto high = read_hex();
+                        if(high < 0) {
+                            return npos;
+                        }
+                        code_point = static_cast<u32>(high);
+                        if(code_point >= 0xD800_u32 && code_point <= 0xDBFF_u32) {
+                            if(raw.substr(index, 2_usize) != "\\u") {
+                                return npos;
+                            }
+                            index += 2_usize;
+                            const auto low = read_hex();
+                            if(low < 0xDC00 || low > 0xDFFF) {
+                                return npos;
+                            }
+                            code_point = 0x10000_u32 + ((code_point - 0xD800_u32) << 10U)
+                                         + (static_cast<u32>(low) - 0xDC00_u32);
+                        }
+                        else if(code_point >= 0xDC00_u32 && code_point <= 0xDFFF_u32) {
+                            return npos;
+                        }
+                        break;
+                    }
+                    default: return npos;
+                }
+
+                // encode as UTF-8
+                auto encoded = true;
+                if(code_point < 0x80_u32) {
+                    encoded = append(code_point);
+                }
+                else if(code_point < 0x800_u32) {
+                    encoded = append(0xC0_u32 | (code_point >> 6U))
+                              && append(0x80_u32 | (code_point & 0x3F_u32));
+                }
+                else if(code_point < 0x10000_u32) {
+                    encoded = append(0xE0_u32 | (code_point >> 12U))
+                              && append(0x80_u32 | ((code_point >> 6U) & 0x3F_u32))
+                              && append(0x80_u32 | (code_point & 0x3F_u32));
+                }
+                else {
+                    encoded = append(0xF0_u32 | (code_point >> 18U))
+                              && append(0x80_u32 | ((code_point >> 12U) & 0x3F_u32))
+                              && append(0x80_u32 | ((code_point >> 6U) & 0x3F_u32))
+                              && append(0x80_u32 | (code_point & 0x3F_u32));
+                }
+                if(not encoded) {
+                    return npos;
+                }
+            }
+
+            return length;
+        }
+
+        /// @brief Cursor over the JSON input being decoded
+        struct json_reader {
+            const char* first;
+            const char* last;
+
+            auto skip_whitespace() noexcept -> void {
+                first = json_skip_whitespace(first, last);
+            }
+
+            /// @brief Skips whitespace, then consumes `character` if it is next
+            /// @return whether `character` was consumed
+            auto consume(char character) noexcept -> bool {
+                skip_whitespace();
+                if(first != last && *first == character) {
+                    ++first;
+                    return true;
+                }
+                return false;
+            }
+
+            /// @brief Consumes `literal` if it is next
+            /// @return whether `literal` was consumed
+            auto consume_literal(std::string_view literal) noexcept -> bool {
+                if(static_cast<usize>(last - first) >= literal.size()
+                   && std::string_view{first, literal.size()} == literal)
+                {
+                    first += literal.size();
+                    return true;
+                }
+                return false;
+            }
+
+            /// @brief Returns whether the next character ends a value
+            [[nodiscard]] auto at_value_end() const noexcept -> bool {
+                return first == last || *first == ',' || *first == '}' || *first == ']'
+                       || json_is_whitespace(*first);
+            }
+
+            /// @brief Reads the string starting at the next character, which must be `'"'`
+            /// @param raw Set to the contents of the string, with escape sequences intact
+            /// @return whether a complete string was read
+            auto read_string(std::string_view& raw) noexcept -> bool {
+                if(first == last || *first != '"') {
+                    return false;
+                }
+                ++first;
+                const auto* const begin = first;
+                while(true) {
+                    first = json_find_first_of<'"', '\\'>(first, last);
+                    if(first == last) {
+                        return false;
+                    }
+                    if(*first == '"') {
+                        raw = std::string_view{begin, static_cast<usize>(first - begin)};
+                        ++first;
+                        return true;
+                    }
+                    // skip the escaped character
+                    if(last - first < 2) {
+                        first = last;
+                        return false;
+                    }
+                    first += 2;
+                }
+            }
+
+            /// @brief Skips the value starting at the next character, without parsing it.
+            /// Only the nesting of objects and arrays, and the ends of strings, are checked
+            /// @return whether a complete value was skipped
+            auto skip_value() noexcept -> bool {
+                if(first == last) {
+                    return false;
+                }
+                if(*first != '{' && *first != '[') {
+                    if(*first == '"') {
+                        auto raw = std::string_view{};
+                        return read_string(raw);
+                    }
+                    const auto* const begin = first;
+                    while(not at_value_end()) {
+                        ++first;
+                    }
+                    return first != begin;
+                }
+
+                auto depth = 0_usize;
+                do {
+                    first = json_find_first_of<'"', '{', '}', '[', ']'>(first, last);
+                    if(first == last) {
+                        return false;
+                    }
+                    switch(*first) {
+                        case '"': {
+                            auto raw = std::string_view{};
+                            if(not read_string(raw)) {
+                                return false;
+                            }
+                            break;
+                        }
+                        case '{': [[fallthrough]];
+                        case '[':
+                            ++depth;
+                            ++first;
+                            break;
+                        default:
+                            --depth;
+                            ++first;
+                            break;
+                    }
+                } while(depth != 0_usize);
+
+                return true;
+            }
+
+            /// @brief Returns the error for a value that could not be read as the type of
+            /// its field: `invalid_value` if the next character starts a JSON value of another
+            /// type, and `syntax_error` if it does not start a JSON value at all
+            [[nodiscard]] auto mismatched_value() const noexcept -> json_errc {
+                if(first == last) {
+                    return json_errc::syntax_error;
+                }
+                const auto rest = std::string_view{first, static_cast<usize>(last - first)};
+                const auto starts_value
+                    = *first == '"' || *first == '{' || *first == '[' || rest.starts_with("true")
+                      || rest.starts_with("false")
+                      || json_number_length(rest) != std::string_view::npos;
+                return starts_value ? json_errc::invalid_value : json_errc::syntax_error;
+            }
+
+            /// @brief Reads the value starting at the next character into `value`
+            /// @return `json_errc::syntax_error` if the next characters are not a JSON value,
+            /// `json_errc::invalid_value` if they are not a valid value of type `TType`, and
+            /// `json_errc::none` otherwise
+            template<typename TType>
+            auto read_value(TType& value) noexcept -> json_errc {
+                if constexpr(std::same_as<TType, bool>) {
+                    const auto parsed = consume_literal("true");
+                    if(not parsed && not consume_literal("false")) {
+                        return mismatched_value();
+                    }
+                    if(not at_value_end()) {
+                        return json_errc::syntax_error;
+                    }
+                    value = parsed;
+                    return json_errc::none;
+                }
+                else if constexpr(std::same_as<TType, std::string_view>) {
+                    if(first == last || *first != '"') {
+                        return mismatched_value();
+                    }
+                    return read_string(value) ? json_errc::none : json_errc::syntax_error;
+                }
+                else if constexpr(is_fixed_string<TType>::value) {
+                    if(first == last || *first != '"') {
+                        return mismatched_value();
+                    }
+                    auto raw = std::string_view{};
+                    if(not read_string(raw)) {
+                        return json_errc::syntax_error;
+                    }
+                    auto unescaped = TType{};
+                    if(json_unescape(raw, unescaped.chars) == std::string_view::npos) {
+                        return json_errc::invalid_value;
+                    }
+                    value = unescaped;
+                    return json_errc::none;
+                }
+                else {
+                    const auto length = json_number_length(
+                        std::string_view{first, static_cast<usize>(last - first)});
+                    if(length == std::string_view::npos) {
+                        return mismatched_value();
+                    }
+                    const auto* const end = first + length;
+                    auto parsed = TType{};
+                    const auto [parsed_end, error] = std::from_chars(first, end, parsed);
+                    first = end;
+                    if(not at_value_end()) {
+                        return json_errc::syntax_error;
+                    }
+                    if(error != std::errc{} || parsed_end != end) {
+                        return json_errc::invalid_value;
+                    }
+                    value = parsed;
+                    return json_errc::none;
+                }
+            }
+        };
+    } // namespace detail
+
+    /// @brief `json_record` is a record with one field for each of the `Pair`s of field
+    /// names and field types in the `List` `TFields`, along with a decoder that reads a JSON
+    /// object directly into those fields.
+    ///
+    /// The decoder makes a single pass over the input, without building a document tree:
+    /// - Keys are matched to fields through a perfect hash table built at compile time: a
+    /// lookup is two hashes of the key, and a single comparison against the only field it
+    /// could name.
+    /// - Integral and floating point fields are parsed with `std::from_chars` directly from
+    /// the input, and `bool` fields from `true` or `false`. Numbers must follow the JSON
+    /// grammar, so `nan`, `inf`, and leading zeros are syntax errors.
+    /// - `fixed_string` fields are unescaped into the field. `std::string_view` fields refer
+    /// to the contents of the string in the input, with escape sequences left intact, so the
+    /// input must outlive the record.
+    /// - Keys that are not fields have their values skipped: only the nesting of objects and
+    /// arrays, and the ends of strings, are checked.
+    /// - Whitespace and string contents are scanned eight bytes at a time.
+    ///
+    /// Fields whose key is not in the input, or whose value is `null`, keep their current
+    /// value. If a key appears more than once, the last value is used. Keys are compared
+    /// without unescaping them.
+    ///
+    /// # Requirements
+    /// - `TFields` must be a non-empty `mpl::List` of `mpl::Pair`s of a `Value` holding a
+    /// `fixed_string` (the key) and the type of the field (or a `MetaType` representing it)
+    /// - Field types must be `bool`, integral or floating point types that `std::from_chars`
+    /// can parse, `std::string_view`, or `fixed_string`s
+    /// - The keys must be distinct
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// using point = json_record<List<Pair<Value<fixed_string{"x"}>, Type<i32>>,
+    ///                                Pair<Value<fixed_string{"y"}>, Type<i32>>>>;
+    ///
+    /// auto value = point{};
+    /// const auto result = value.decode(R"({"y": -2, "x": 1, "label": "origin"})");
+    /// assert(result && value.get<"x">() == 1 && value.get<"y">() == -2);
+    /// @endcode
+    ///
+    /// @tparam TFields The `List` of `Pair`s of field names and field types
+    /// @ingroup json
+    /// @headerfile hyperion/mpl/json.h
+    template<typename TFields>
+    class json_record;
+
+    template<typename... TFields>
+        requires(sizeof...(TFields) != 0) && (detail::json_field<TFields> && ...)
+                && (detail::all_distinct<std::string_view>(TFields::first::value.view()...))
+    class json_record<List<TFields...>> {
+      private:
+        static constexpr auto num_fields = sizeof...(TFields);
+        static constexpr auto keys
+            = std::array<std::string_view, num_fields>{TFields::first::value.view()...};
+        static constexpr auto table = detail::make_perfect_hash_table(keys);
+
+        static_assert(table.found, "failed to build a perfect hash table of the field names");
+
+        template<fixed_string TName>
+        static constexpr auto index_of_name
+            = static_cast<usize>(std::find(keys.begin(), keys.end(), TName.view())
+                                 - keys.begin());
+
+      public:
+        /// @brief The record type holding the values of the fields
+        using values_type = record<List<detail::json_field_t<TFields>...>>;
+
+        /// @brief Value-initializes each field
+        constexpr json_record() noexcept : m_values(detail::json_field_t<TFields>{}...) {
+        }
+
+        /// @brief Returns the number of fields
+        /// @return the number of fields
+        [[nodiscard]] static constexpr auto size() noexcept -> usize {
+            return num_fields;
+        }
+
+        /// @brief Returns the index of the field with key `key`, or `size()` if there is none
+        /// @param key The key of the field
+        /// @return the index of the field with key `key`
+        [[nodiscard]] static constexpr auto index_of(std::string_view key) noexcept -> usize {
+            const auto index = table.find(key);
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            return index != num_fields && keys[index] == key ? index : num_fields;
+        }
+
+        /// @brief Returns the value of the field with key `TName`
+        /// @return a reference to the value of the field
+        template<fixed_string TName>
+            requires(index_of_name<TName> != num_fields)
+        [[nodiscard]] constexpr auto get() noexcept -> decltype(auto) {
+            return m_values.template get<index_of_name<TName>>();
+        }
+
+        /// @brief Returns the value of the field with key `TName`
+        /// @return a reference to the value of the field
+        template<fixed_string TName>
+            requires(index_of_name<TName> != num_fields)
+        [[nodiscard]] constexpr auto get() const noexcept -> decltype(auto) {
+            return m_values.template get<index_of_name<TName>>();
+        }
+
+        /// @brief Returns the values of all of the fields
+        /// @return the values of the fields, in the order the fields are listed
+        [[nodiscard]] constexpr auto values() const noexcept -> const values_type& {
+            return m_values;
+        }
+
+        /// @brief Decodes the JSON object in `text` into the fields.
+        ///
+        /// `text` must hold a single JSON object, optionally surrounded by whitespace.
+        /// Decoding stops at the first error; fields decoded before it keep their new values.
+        ///
+        /// @param text The JSON text
+        /// @return The result of decoding
+        auto decode(std::string_view text) noexcept -> json_result {
+            auto reader = detail::json_reader{text.data(), text.data() + text.size()};
+            const auto fail = [&](json_errc error) noexcept -> json_result {
+                if(error == json_errc::syntax_error && reader.first == reader.last) {
+                    error = json_errc::unexpected_end;
+                }
+                return {error, static_cast<usize>(reader.first - text.data())};
+            };
+
+            if(not reader.consume('{')) {
+                return fail(json_errc::syntax_error);
+            }
+            if(not reader.consume('}')) {
+                do {
+                    reader.skip_whitespace();
+                    auto key = std::string_view{};
+                    if(not reader.read_string(key) || not reader.consume(':')) {
+                        return fail(json_errc::syntax_error);
+                    }
+                    reader.skip_whitespace();
+
+                    const auto index = index_of(key);
+                    if(index == num_fields || reader.consume_literal("null")) {
+                        if(index == num_fields && not reader.skip_value()) {
+                            return fail(json_errc::syntax_error);
+                        }
+                    }
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    else if(const auto error = readers[index](*this, reader);
+                            error != json_errc::none)
+                    {
+                        return fail(error);
+                    }
+                } while(reader.consume(','));
+
+                if(not reader.consume('}')) {
+                    return fail(json_errc::syntax_error);
+                }
+            }
+
+            reader.skip_whitespace();
+            if(reader.first != reader.last) {
+                return fail(json_errc::syntax_error);
+            }
+            return {json_errc::none, text.size()};
+        }
+
+      private:
+        values_type m_values;
+
+        template<usize TIndex>
+        static auto
+        read_field(json_record& self, detail::json_reader& reader) noexcept -> json_errc {
+            return reader.read_value(self.m_values.template get<TIndex>());
+        }
+
+        template<usize... TIndices>
+        static constexpr auto
+        make_readers([[maybe_unused]] std::index_sequence<TIndices...> indices) noexcept {
+            return std::array<json_errc (*)(json_record&, detail::json_reader&) noexcept,
+                              num_fields>{&read_field<TIndices>...};
+        }
+
+        static constexpr auto readers = make_readers(std::make_index_sequence<num_fields>{});
+    };
+
+    namespace _test::json {
+        using trade = json_record<List<Pair<Value<mpl::fixed_string{"id"}>, Type<u64>>,
+                                       Pair<Value<mpl::fixed_string{"price"}>, Type<double>>,
+                                       Pair<Value<mpl::fixed_string{"symbol"}>,
+                                            Type<mpl::fixed_string<8>>>,
+                                       Pair<Value<mpl::fixed_string{"venue"}>,
+                                            Type<std::string_view>>,
+                                       Pair<Value<mpl::fixed_string{"open"}>, Type<bool>>>>;
+
+        static_assert(trade::size() == 5_usize, "hyperion::mpl::json_record test case 1 (failing)");
+        static_assert(trade::index_of("id") == 0_usize && trade::index_of("price") == 1_usize
+                          && trade::index_of("symbol") == 2_usize
+                          && trade::index_of("venue") == 3_usize
+                          && trade::index_of("open") == 4_usize,
+                      "hyperion::mpl::json_record test case 2 (failing)");
+        static_assert(trade::index_of("ids") == trade::size()
+                          && trade::index_of("") == trade::size(),
+                      "hyperion::mpl::json_record test case 3 (failing)");
+        static_assert(trade{}.get<"id">() == 0_u64 && not trade{}.get<"open">(),
+                      "hyperion::mpl::json_record test case 4 (failing)");
+        static_assert(std::same_as<trade::values_type,
+                                   mpl::record<List<u64,
+                                                    double,
+                                                    mpl::fixed_string<8>,
+                                                    std::string_view,
+                                                    bool>>>,
+                      "hyperion::mpl::json_record test case 5 (failing)");
+
+        [[nodiscard]] constexpr auto
+        test_unescape(std::string_view raw, std::string_view expected) noexcept -> bool {
+            auto out = std::array<char, 8>{};
+            const auto length = detail::json_unescape(raw, out);
+            return length != std::string_view::npos
+                   && std::string_view{out.data(), length} == expected;
+        }
+
+        static_assert(test_unescape(R"(a\"b\\c\n)", "a\"b\\c\n"),
+                      "hyperion::mpl::json_record unescape test case 1 (failing)");
+        static_assert(test_unescape(R"(\u00e9\u20AC)", "\xC3\xA9\xE2\x82\xAC"),
+                      "hyperion::mpl::json_record unescape test case 2 (failing)");
+        static_assert(test_unescape(R"(\ud83d\ude00)", "\xF0\x9F\x98\x80"),
+                      "hyperion::mpl::json_record unescape test case 3 (failing)");
+        static_assert(not test_unescape(R"(\ud83d)", ""),
+                      "hyperion::mpl::json_record unescape test case 4 (failing)");
+        static_assert(not test_unescape("123456789", ""),
+                      "hyperion::mpl::json_record unescape test case 5 (failing)");
+
+        [[nodiscard]] constexpr auto
+        test_number(std::string_view text, usize expected) noexcept -> bool {
+            return detail::json_number_length(text) == expected;
+        }
+
+        static_assert(test_number("0", 1_usize) && test_number("-12.5e+3,", 8_usize)
+                          && test_number("1E-2}", 4_usize) && test_number("0.25", 4_usize),
+                      "hyperion::mpl::json_record number test case 1 (failing)");
+        static_assert(test_number("01", 1_usize) && test_number("-0x1", 2_usize),
+                      "hyperion::mpl::json_record number test case 2 (failing)");
+        static_assert(test_number("nan", std::string_view::npos)
+                          && test_number("inf", std::string_view::npos)
+                          && test_number("-Infinity", std::string_view::npos)
+                          && test_number("+1", std::string_view::npos)
+                          && test_number(".5", std::string_view::npos)
+                          && test_number("1.", std::string_view::npos)
+                          && test_number("1e", std::string_view::npos)
+                          && test_number("-", std::string_view::npos)
+                          && test_number("", std::string_view::npos),
+                      "hyperion::mpl::json_record number test case 3 (failing)");
+
+        template<typename TFields>
+        concept valid_json_record = requires { sizeof(json_record<TFields>); };
+
+        static_assert(valid_json_record<List<Pair<Value<mpl::fixed_string{"a"}>, int>>>,
+                      "hyperion::mpl::json_record requirements test case 1 (failing)");
+        static_assert(not valid_json_record<List<Pair<Value<mpl::fixed_string{"a"}>, int>,
+                                                 Pair<Value<mpl::fixed_string{"a"}>, bool>>>,
+                      "hyperion::mpl::json_record requirements test case 2 (failing)");
+        static_assert(not valid_json_record<List<Pair<Value<mpl::fixed_string{"a"}>, int*>>>,
+                      "hyperion::mpl::json_record requirements test case 3 (failing)");
+        static_assert(not valid_json_record<List<Pair<Value<1>, int>>>,
+                      "hyperion::mpl::json_record requirements test case 4 (failing)");
+        static_assert(not valid_json_record<List<>>,
+                      "hyperion::mpl::json_record requirements test case 5 (failing)");
+        static_assert(not valid_json_record<List<Pair<Value<mpl::fixed_string{"a"}>, char16_t>>>,
+                      "hyperion::mpl::json_record requirements test case 6 (failing)");
+        static_assert(not valid_json_record<List<Pair<Value<mpl::fixed_string{"a"}>, wchar_t>>>,
+                      "hyperion::mpl::json_record requirements test case 7 (failing)");
+    } // namespace _test::json
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_JSON_H
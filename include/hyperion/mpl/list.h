@@ -30,12 +30,17 @@
 #include <hyperion/platform/types.h>
 //
 #include <hyperion/mpl/metatypes.h>
+#include <hyperion/mpl/static_vector.h>
 #include <hyperion/mpl/type.h>
 #include <hyperion/mpl/value.h>
 //
 #include <hyperion/mpl/metapredicates.h>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <concepts>
+#include <span>
 #include <type_traits>
 
 /// @ingroup mpl
@@ -111,43 +116,90 @@ namespace hyperion::mpl {
     /// @headerfile hyperion/mpl/list.h
     struct not_found_tag { };
 
+    #if defined(__has_builtin)
+        #if __has_builtin(__type_pack_element)
+            #define HYPERION_MPL_HAS_TYPE_PACK_ELEMENT 1
+        #endif // __has_builtin(__type_pack_element)
+    #endif     // defined(__has_builtin)
+
+    #ifndef HYPERION_MPL_HAS_TYPE_PACK_ELEMENT
+        #define HYPERION_MPL_HAS_TYPE_PACK_ELEMENT 0
+    #endif // HYPERION_MPL_HAS_TYPE_PACK_ELEMENT
+
     namespace detail {
+    #if !HYPERION_MPL_HAS_TYPE_PACK_ELEMENT
         /// @brief Represents an element at index `TIndex` in a `List`
         /// @tparam TIndex the index in the `List` of this element
-        /// @tparam TType the `as_meta` type of this element
+        /// @tparam TType the type of this element
         template<usize TIndex, typename TType>
-        struct element {
-            [[nodiscard]] constexpr auto
-            at([[maybe_unused]] Value<TIndex> index) const noexcept -> TType {
-                return {};
-            }
-        };
+        struct element { };
 
-        /// @brief Factory for an indexible representation of the elements of a `List`
-        /// @tparam TTypes the elements of the `List`
-        template<typename... TTypes>
-        struct elements {
-            /// @brief Returns an indexible overload set of `at` for the elements of a `List`
-            template<usize... TIndices>
-            [[nodiscard]] static constexpr auto
-            make([[maybe_unused]] std::integer_sequence<usize, TIndices...> seq) noexcept {
-                struct ret : element<TIndices, TTypes>... {
-                    using element<TIndices, TTypes>::at...;
-                };
+        /// @brief Deduces the type of the element at index `TIndex` from the `elements`
+        /// base class representing it
+        template<usize TIndex, typename TType>
+        auto element_at(const element<TIndex, TType>* elem) -> std::type_identity<TType>;
 
-                return ret{};
+        /// @brief Indexible representation of the elements of a `List`.
+        /// Inherits from one `element` per element of the `List`, so that the type at an index
+        /// can be deduced by `element_at`, without recursing over the elements.
+        /// @tparam TIndexSequence the index sequence from `0` to `sizeof...(TTypes)`
+        /// @tparam TTypes the elements of the `List`
+        template<typename TIndexSequence, typename... TTypes>
+        struct elements;
+
+        template<usize... TIndices, typename... TTypes>
+        struct elements<std::index_sequence<TIndices...>, TTypes...>
+            : element<TIndices, TTypes>... { };
+    #endif // !HYPERION_MPL_HAS_TYPE_PACK_ELEMENT
+
+        /// @brief The `TIndex`th type in `TTypes`.
+        ///
+        /// Uses the compiler's `__type_pack_element` builtin when it is available, so that
+        /// every lookup is constant time. Otherwise, each lookup is linear in
+        /// `sizeof...(TTypes)`, but never recursive, and so does not count against the
+        /// compiler's template instantiation depth limit.
+        /// @tparam TIndex the index of the type to get
+        /// @tparam TTypes the types to index into
+        template<usize TIndex, typename... TTypes>
+    #if HYPERION_MPL_HAS_TYPE_PACK_ELEMENT
+        using type_at = __type_pack_element<TIndex, TTypes...>;
+    #else
+        using type_at = typename decltype(element_at<TIndex>(
+            static_cast<const elements<std::index_sequence_for<TTypes...>, TTypes...>*>(
+                nullptr)))::type;
+    #endif // HYPERION_MPL_HAS_TYPE_PACK_ELEMENT
+
+        /// @brief The state of an in-progress `List::accumulate`.
+        ///
+        /// `operator<<` applies the accumulator to the current state and the next element,
+        /// returning the next state, so that the accumulation can be expressed as a left fold
+        /// over the elements of a `List`, instead of recursing once per element.
+        /// @tparam TState the type of the current state of the accumulation
+        /// @tparam TAccumulator the type of the callable to perform the accumulation with,
+        /// as deduced by a forwarding reference, so that every invocation of the accumulator
+        /// preserves the value category `List::accumulate` received it as
+        template<typename TState, typename TAccumulator>
+        struct accumulation {
+            TState state;
+            TAccumulator&& accumulator; // NOLINT(*-avoid-const-or-ref-data-members)
+
+            template<typename TElement>
+            [[nodiscard]] constexpr auto operator<<(TElement element) && noexcept {
+                auto next = std::forward<TAccumulator>(accumulator)(std::move(state), element);
+                return accumulation<decltype(next), TAccumulator>{
+                    std::move(next),
+                    std::forward<TAccumulator>(accumulator)};
             }
         };
 
-        /// @brief Returns the `index`th element of `list`
-        /// @tparam TTypes the elements of the `List`
-        /// @param index the index of the element of `list` to get
-        /// @return the `index`th element of `list`
-        template<typename... TTypes>
-        [[nodiscard]] constexpr auto at(MetaValue auto index) noexcept {
-            return elements<TTypes...>::make(std::make_integer_sequence<usize, sizeof...(TTypes)>{})
-                .at(Value<static_cast<usize>(decltype(index)::value), usize>{});
-        }
+        /// @brief The default accumulation operation of `List::accumulate`.
+        /// Performs the arithmetic sum of the two `MetaValue`s
+        struct arithmetic_sum {
+            [[nodiscard]] constexpr auto
+            operator()(MetaValue auto state, MetaValue auto current) const noexcept {
+                return state + current;
+            }
+        };
 
         /// @brief Removes the first element from the list, `TList`, exposing that element as
         /// the member `using` alias `front`, and the list of remaining elements from the list
@@ -191,7 +243,7 @@ namespace hyperion::mpl {
         // specialization to use the index sequence to drop the last element
         template<template<typename...> typename TList, std::size_t... TIndices, typename... TTypes>
         struct pop_back_base<TList, std::index_sequence<TIndices...>, TTypes...> {
-            using remaining = TList<decltype(at<TTypes...>(Value<TIndices>{}))...>;
+            using remaining = TList<type_at<TIndices, TTypes...>...>;
         };
 
         /// @brief Removes the last element from the list, `TList`, exposing that element as
@@ -205,7 +257,7 @@ namespace hyperion::mpl {
         // specialization for removal
         template<template<typename...> typename TList, typename... TTypes>
         struct pop_back<TList<TTypes...>> {
-            using back = decltype(at<TTypes...>(Value<sizeof...(TTypes) - 1>{}));
+            using back = type_at<sizeof...(TTypes) - 1, TTypes...>;
             using remaining =
                 typename pop_back_base<TList,
                                        std::make_index_sequence<sizeof...(TTypes) - 1>,
@@ -225,6 +277,240 @@ namespace hyperion::mpl {
             using back = not_found_tag;
             using remaining = TList<>;
         };
+
+        /// @brief Converts the elements of the list, `TList`, to their corresponding raw types,
+        /// exposing the resulting `List` as the member `using` alias `type`
+        ///
+        /// @tparam TList The list to convert the elements of
+        template<typename TList>
+        struct to_raw_list;
+
+        template<template<typename...> typename TList, typename... TTypes>
+        struct to_raw_list<TList<TTypes...>> {
+            using type = List<convert_to_raw_t<TTypes>...>;
+        };
+
+        /// @brief Converts the metaprogramming type `TMeta` to the element `List::push_back`
+        /// appends for it, exposing the result as the member `using` alias `type`.
+        ///
+        /// `Type`s are unwrapped to the type they represent, while `Value`s and `Pair`s
+        /// are kept as they are.
+        ///
+        /// @tparam TMeta The metaprogramming type to convert
+        template<typename TMeta>
+        struct pushed_element {
+            using type = TMeta;
+        };
+
+        template<typename TMeta>
+            requires MetaType<TMeta>
+        struct pushed_element<TMeta> {
+            using type = typename TMeta::type;
+        };
+
+        /// @brief Selects the elements of `TMetas` at the indices in `TIndices`, in order,
+        /// exposing the `List` of those elements, as `List::push_back` would append them,
+        /// as the member `using` alias `type`
+        ///
+        /// @tparam TIndices The indices to select, as a `std::array<usize, N>`
+        /// @tparam TIndexSequence The index sequence from `0` to `TIndices.size()`
+        /// @tparam TMetas The metaprogramming types to select from
+        template<auto TIndices, typename TIndexSequence, typename... TMetas>
+        struct select_indices;
+
+        template<auto TIndices, usize... TIs, typename... TMetas>
+        struct select_indices<TIndices, std::index_sequence<TIs...>, TMetas...> {
+            using type
+                = List<typename pushed_element<type_at<TIndices[TIs], TMetas...>>::type...>;
+        };
+
+        /// @brief Returns the index of the first `true` in `values`, or `values.size()` if
+        /// there is none
+        /// @param values the values to search
+        /// @return the index of the first `true` in `values`
+        template<usize TSize>
+        [[nodiscard]] constexpr auto
+        index_of_first_true(const std::array<bool, TSize>& values) noexcept -> usize {
+            return static_cast<usize>(std::find(values.begin(), values.end(), true)
+                                      - values.begin());
+        }
+
+        /// @brief Returns the indices of the elements of `values` equal to `TSatisfied`,
+        /// in order.
+        ///
+        /// Depends only on the size of `values` and the number of matches, so filtering any
+        /// two `List`s of the same size down to the same number of elements shares a single
+        /// instantiation.
+        /// @tparam TSatisfied the value to collect the indices of
+        /// @tparam TCount the number of elements of `values` equal to `TSatisfied`
+        /// @param values the values to search
+        /// @return the indices of the elements of `values` equal to `TSatisfied`
+        template<bool TSatisfied, usize TCount, usize TSize>
+        [[nodiscard]] constexpr auto
+        indices_where(const std::array<bool, TSize>& values) noexcept
+            -> std::array<usize, TCount> {
+            auto indices = std::array<usize, TCount>{};
+            auto current = indices.begin();
+            for(auto i = 0_usize; i < TSize; ++i) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                if(values[i] == TSatisfied) {
+                    *current = i;
+                    ++current;
+                }
+            }
+            return indices;
+        }
+
+        /// @brief Invokes the metapredicate `predicate` with `list`, if it is invocable with it
+        /// @param predicate the metapredicate to invoke
+        /// @param list the list to invoke `predicate` with
+        /// @return the result of invoking `predicate` with `list`, or `Value<false, bool>` if
+        /// `predicate` is not invocable with `list`
+        template<typename TPredicate, typename TList>
+        [[nodiscard]] constexpr auto
+        invoke_list_predicate(TPredicate&& predicate, // NOLINT(*-missing-std-forward)
+                              TList list) noexcept {
+            if constexpr(std::invocable<TPredicate, TList>) {
+                return std::forward<TPredicate>(predicate)(list);
+            }
+            else {
+                return Value<false, bool>{};
+            }
+        }
+
+        /// @brief The implementations of `List`'s predicate-based queries and transformations,
+        /// and of its accumulation, over the canonical spelling of its elements.
+        ///
+        /// Every `List` normalises its elements to their corresponding metaprogramming types
+        /// once, on entry, and forwards to the `list_algorithms` of the result. `List`s that
+        /// spell the same elements differently (e.g. `List<int>` and `List<Type<int>>`)
+        /// therefore share a single instantiation of each of these operations.
+        ///
+        /// @tparam TMetas the metaprogramming types of the elements of the `List`
+        template<typename... TMetas>
+        struct list_algorithms {
+            /// @brief Whether each element satisfies the metapredicate `TPredicate`, in order
+            /// @tparam TPredicate the type of the metapredicate to check the elements against
+            template<typename TPredicate>
+            static constexpr auto satisfied_by = std::array<bool, sizeof...(TMetas)>{
+                static_cast<bool>(TMetas{}.satisfies(TPredicate{}))...};
+
+            /// @brief The number of elements that satisfy the metapredicate `TPredicate`
+            /// @tparam TPredicate the type of the metapredicate to check the elements against
+            template<typename TPredicate>
+            static constexpr auto count_if = static_cast<usize>(
+                std::count(satisfied_by<TPredicate>.begin(), satisfied_by<TPredicate>.end(), true));
+
+            /// @brief The index of the first element that satisfies the metapredicate
+            /// `TPredicate`, or `sizeof...(TMetas)` if no element does
+            /// @tparam TPredicate the type of the metapredicate to check the elements against
+            template<typename TPredicate>
+            static constexpr auto index_if = index_of_first_true(satisfied_by<TPredicate>);
+
+            /// @brief The indices of the elements for which `satisfied_by<TPredicate>`
+            /// is `TSatisfied`, in order
+            /// @tparam TPredicate the type of the metapredicate to check the elements against
+            /// @tparam TSatisfied whether to collect the elements that do, or do not, satisfy
+            /// `TPredicate`
+            template<typename TPredicate, bool TSatisfied>
+            static constexpr auto filtered_indices = indices_where<
+                TSatisfied,
+                static_cast<usize>(std::count(satisfied_by<TPredicate>.begin(),
+                                              satisfied_by<TPredicate>.end(),
+                                              TSatisfied))>(satisfied_by<TPredicate>);
+
+            /// @brief The `List` of the elements for which `satisfied_by<TPredicate>` is
+            /// `TSatisfied`, in order, as `List::push_back` would append them
+            /// @tparam TPredicate the type of the metapredicate to check the elements against
+            /// @tparam TSatisfied whether to keep the elements that do, or do not, satisfy
+            /// `TPredicate`
+            template<typename TPredicate, bool TSatisfied>
+            using filter = typename select_indices<
+                filtered_indices<TPredicate, TSatisfied>,
+                std::make_index_sequence<filtered_indices<TPredicate, TSatisfied>.size()>,
+                TMetas...>::type;
+
+            /// @brief Folds `accumulator` over the elements, in order.
+            ///
+            /// `state` may be a different type for each invocation step of the fold,
+            /// so the fold is performed over `accumulation`s, which carry the
+            /// current state from one step to the next. This keeps the accumulation
+            /// non-recursive, so it is not limited by the compiler's template instantiation
+            /// or `constexpr` call depth limits.
+            ///
+            /// @param state the initial state of the accumulation
+            /// @param accumulator the callable to perform the accumulation with
+            /// @return the result of the accumulation
+            template<typename TState, typename TAccumulator>
+            [[nodiscard]] static constexpr auto
+            accumulate(TState state, TAccumulator&& accumulator) noexcept {
+                return (accumulation<TState, TAccumulator>{
+                            std::move(state),
+                            std::forward<TAccumulator>(accumulator)}
+                        << ... << TMetas{})
+                    .state;
+            }
+        };
+
+        /// @brief Requirements for an executor usable with `List::for_each_parallel`.
+        /// The executor must provide a nested `job` type aggregate-initializable from a
+        /// `void (*)(void*) noexcept` and a `void*`, and a member function `execute` that
+        /// runs a span of such `job`s, returning once all of them have completed.
+        template<typename TExecutor>
+        concept job_executor
+            = requires(TExecutor& executor, void (*invoke)(void*) noexcept, void* context) {
+                  typename TExecutor::job;
+                  std::type_identity_t<typename TExecutor::job>{invoke, context};
+                  executor.execute(std::span<const typename TExecutor::job>{});
+              };
+
+        /// @brief Default instrumentation for `List::for_each_parallel`, which skips timing
+        /// the visitor entirely
+        struct no_instrumentation { };
+
+        /// @brief The state shared by the jobs submitted by a call to
+        /// `List::for_each_parallel`
+        template<typename TVisitor, typename TInstrument>
+        struct parallel_context {
+            TVisitor* visitor;
+            TInstrument* instrument;
+        };
+
+        /// @brief The job submitted by `List::for_each_parallel` for the element `TElement`.
+        /// Invokes the visitor with `TElement`, and, if instrumentation was requested,
+        /// reports the time spent doing so.
+        template<typename TElement, typename TContext>
+        auto invoke_parallel_element(void* context) noexcept -> void {
+            auto& state = *static_cast<TContext*>(context);
+            if constexpr(std::same_as<std::remove_cvref_t<decltype(*state.instrument)>,
+                                      no_instrumentation>)
+            {
+                (*state.visitor)(TElement{});
+            }
+            else {
+                const auto start = std::chrono::steady_clock::now();
+                (*state.visitor)(TElement{});
+                const auto elapsed = std::chrono::steady_clock::now() - start;
+                (*state.instrument)(TElement{},
+                                    std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed));
+            }
+        }
+
+        /// @brief The number of occurrences of `TType` in `TTypes`.
+        /// Unlike `List::count`, this does not require the types to be complete
+        template<typename TType, typename... TTypes>
+        static inline constexpr auto count_of_type
+            = (0_usize + ... + (std::same_as<TType, TTypes> ? 1_usize : 0_usize));
+
+        /// @brief The index of the first occurrence of `TType` in `TTypes`, or
+        /// `sizeof...(TTypes)` if it does not occur.
+        /// Unlike `List::index_of`, this does not require the types to be complete
+        template<typename TType, typename... TTypes>
+        static inline constexpr auto index_of_type = index_of_first_true(
+            std::array<bool, sizeof...(TTypes)>{std::same_as<TType, TTypes>...});
+
+        template<typename... TTypes>
+        concept unique_types = ((count_of_type<TTypes, TTypes...> == 1_usize) && ...);
     } // namespace detail
 
     /// @brief `List` is a metaprogramming type for storing, communicating,
@@ -270,6 +556,10 @@ namespace hyperion::mpl {
         template<typename TType>
         using as_raw = detail::convert_to_raw_t<TType>;
 
+        // the implementations of the algorithms over the elements of this `List`, shared with
+        // every other `List` spelling the same elements
+        using algorithms = detail::list_algorithms<as_meta<TTypes>...>;
+
       public:
         /// @brief Returns the size of this `List`
         /// @return the size of this `List`
@@ -283,6 +573,134 @@ namespace hyperion::mpl {
             return Value < sizeof...(TTypes) == 0, bool > {};
         }
 
+        /// @brief Returns the largest `sizeof` of the types represented by the elements of
+        /// this `List`, as a `Value` specialization.
+        ///
+        /// # Requirements
+        /// - Every element of this `List` must be a type or `MetaType`
+        ///
+        /// # Example
+        /// @code {.cpp}
+        /// static_assert(List<u8, u32, u16>{}.max_sizeof() == 4_usize);
+        /// static_assert(List<>{}.max_sizeof() == 0_usize);
+        /// @endcode
+        ///
+        /// @return the largest `sizeof` of the represented types, or `0` if this `List` is empty
+        [[nodiscard]] constexpr auto max_sizeof() const noexcept
+            requires(MetaType<as_meta<TTypes>> && ...)
+        {
+            return Value<std::max({0_usize, as_meta<TTypes>{}.sizeof_().value...}), usize>{};
+        }
+
+        /// @brief Returns the largest `alignof` of the types represented by the elements of
+        /// this `List`, as a `Value` specialization.
+        ///
+        /// This is the alignment required by storage able to hold any of the represented types.
+        ///
+        /// # Requirements
+        /// - Every element of this `List` must be a type or `MetaType`
+        ///
+        /// # Example
+        /// @code {.cpp}
+        /// static_assert(List<u8, u32, u16>{}.max_alignof() == 4_usize);
+        /// static_assert(List<>{}.max_alignof() == 1_usize);
+        /// @endcode
+        ///
+        /// @return the largest `alignof` of the represented types, or `1` if this `List` is empty
+        [[nodiscard]] constexpr auto max_alignof() const noexcept
+            requires(MetaType<as_meta<TTypes>> && ...)
+        {
+            return Value<std::max({1_usize, as_meta<TTypes>{}.alignof_().value...}), usize>{};
+        }
+
+        /// @brief Returns whether every type represented by the elements of this `List` is
+        /// trivially copyable, as a `Value` specialization.
+        ///
+        /// Equivalent to `all_of(trivially_copyable)`, without instantiating the
+        /// intermediate `List`s used by `all_of`.
+        ///
+        /// # Requirements
+        /// - Every element of this `List` must be a type or `MetaType`
+        ///
+        /// # Example
+        /// @code {.cpp}
+        /// static_assert(List<int, double>{}.all_trivially_copyable());
+        /// static_assert(not List<int, std::string>{}.all_trivially_copyable());
+        /// @endcode
+        ///
+        /// @return whether every represented type is trivially copyable
+        [[nodiscard]] constexpr auto all_trivially_copyable() const noexcept
+            requires(MetaType<as_meta<TTypes>> && ...)
+        {
+            return Value<(as_meta<TTypes>{}.is_trivially_copyable().value && ...), bool>{};
+        }
+
+        /// @brief Returns whether every type represented by the elements of this `List` is a
+        /// standard-layout type, as a `Value` specialization.
+        ///
+        /// Equivalent to `all_of(standard_layout)`, without instantiating the
+        /// intermediate `List`s used by `all_of`.
+        ///
+        /// # Requirements
+        /// - Every element of this `List` must be a type or `MetaType`
+        ///
+        /// # Example
+        /// @code {.cpp}
+        /// static_assert(List<int, double>{}.all_standard_layout());
+        /// @endcode
+        ///
+        /// @return whether every represented type is a standard-layout type
+        [[nodiscard]] constexpr auto all_standard_layout() const noexcept
+            requires(MetaType<as_meta<TTypes>> && ...)
+        {
+            return Value<(as_meta<TTypes>{}.is_standard_layout().value && ...), bool>{};
+        }
+
+        /// @brief Returns whether every type represented by the elements of this `List` has
+        /// unique object representations, as a `Value` specialization.
+        ///
+        /// Equivalent to `all_of(unique_object_representations)`, without instantiating the
+        /// intermediate `List`s used by `all_of`.
+        ///
+        /// # Requirements
+        /// - Every element of this `List` must be a type or `MetaType`
+        ///
+        /// # Example
+        /// @code {.cpp}
+        /// static_assert(List<u32, i64>{}.all_unique_object_representations());
+        /// static_assert(not List<u32, float>{}.all_unique_object_representations());
+        /// @endcode
+        ///
+        /// @return whether every represented type has unique object representations
+        [[nodiscard]] constexpr auto all_unique_object_representations() const noexcept
+            requires(MetaType<as_meta<TTypes>> && ...)
+        {
+            return Value<(as_meta<TTypes>{}.has_unique_object_representations().value && ...),
+                         bool>{};
+        }
+
+        /// @brief Returns whether every type represented by the elements of this `List` is an
+        /// implicit-lifetime type, as a `Value` specialization.
+        ///
+        /// Equivalent to `all_of(implicit_lifetime)`, without instantiating the
+        /// intermediate `List`s used by `all_of`.
+        ///
+        /// # Requirements
+        /// - Every element of this `List` must be a type or `MetaType`
+        ///
+        /// # Example
+        /// @code {.cpp}
+        /// static_assert(List<int, double[4]>{}.all_implicit_lifetime());
+        /// static_assert(not List<int, std::string>{}.all_implicit_lifetime());
+        /// @endcode
+        ///
+        /// @return whether every represented type is an implicit-lifetime type
+        [[nodiscard]] constexpr auto all_implicit_lifetime() const noexcept
+            requires(MetaType<as_meta<TTypes>> && ...)
+        {
+            return Value<(as_meta<TTypes>{}.is_implicit_lifetime().value && ...), bool>{};
+        }
+
         /// @brief Checks to see if this `List` specialization satisfies the given template
         /// metafunction predicate, `TPredicate`
         ///
@@ -356,16 +774,8 @@ namespace hyperion::mpl {
         /// `Value` specialization
         template<typename TPredicate>
         [[nodiscard]] constexpr auto satisfies(TPredicate&& predicate) const noexcept {
-            constexpr auto invoke = []<typename TPred>(TPred&& pred) noexcept {
-                if constexpr(std::invocable<TPred, List>) {
-                    return std::forward<TPred>(pred)(List{});
-                }
-                else {
-                    return Value<false, bool>{};
-                }
-            };
-
-            [[maybe_unused]] const auto result = invoke(std::forward<TPredicate>(predicate));
+            [[maybe_unused]] const auto result
+                = detail::invoke_list_predicate(std::forward<TPredicate>(predicate), List{});
             if constexpr(MetaType<decltype(result)>) {
                 using inner = typename decltype(result)::type;
                 static_assert(MetaValue<inner>,
@@ -519,52 +929,76 @@ namespace hyperion::mpl {
                     .for_each(std::forward<TVisitor>(vis));
         }
 
-      private:
-        /// @brief Implementation for `accumulate`.
-        /// Recursively called for each type in `TTs...`, in pack order.
-        ///
-        /// `state` may be a different type for each invocation step
-        /// in the recursive call chain.
-        ///
-        /// @tparam TState the type of the initial (at the top level of the call chain)
-        /// or current (at any other level of the call chain) state of the accumulation
-        /// @tparam TAccumulator the type of the callable to perform the accumulation with
-        /// @tparam TTs the remaining metaprogramming types in the list of types to
-        /// recursively accumulate
-        ///
-        /// @param state the initial (at the top level of the call chain) or current
-        /// (at any other level of the call chain) state of the accumulation
-        /// @param accumulator the callable to perform the accumulation with
-        /// @param remaining the remaining metaprogramming types to recursively accumulate
-        /// @return the result of the accumulation (at the top level of the call chain)
-        /// or the current state of the accumulation (at any other level of the call chain)
-        template<typename TState, typename TAccumulator, typename... TTs>
-        [[nodiscard]] static constexpr auto
-        accumulate_impl(TState&& state,
-                        TAccumulator&& accumulator,
-                        [[maybe_unused]] List<TTs...> remaining) noexcept {
-            using popped = detail::pop_front<List<TTs...>>;
-            using front = typename popped::front;
-            using remainder = typename popped::remaining;
-
-            if constexpr(std::same_as<front, not_found_tag>) {
-                return std::forward<TState>(state);
-            }
-            else {
-                return accumulate_impl(
-                    std::forward<TAccumulator>(accumulator)(std::forward<TState>(state), front{}),
-                    std::forward<TAccumulator>(accumulator),
-                    remainder{});
+        /// @brief Invokes the function `vis` with each element of this `List`, in parallel,
+        /// using `executor`, returning once every invocation has completed.
+        ///
+        /// This is the parallel counterpart to `for_each`, for when the work done per element
+        /// is expensive (e.g. building a per-type cache at startup). One job is submitted to
+        /// `executor` for each element, `TElement`, which invokes `vis` as if by
+        /// `vis(typename as_meta<TElement>::type{})`. The invocations may happen concurrently,
+        /// in any order, on any thread used by `executor`.
+        ///
+        /// If `instrument` is given, then after each invocation of `vis`, `instrument` is
+        /// invoked on the same thread as
+        /// `instrument(typename as_meta<TElement>::type{}, elapsed)`, where `elapsed` is the
+        /// `std::chrono::nanoseconds` spent in that invocation of `vis`.
+        ///
+        /// # Requirements
+        /// - `vis` must be invocable with the corresponding metaprogramming type
+        /// for each element of this `List`, and its invoke result for each element
+        /// must be `void`.
+        /// - `vis` and `instrument` must be safe to invoke concurrently from multiple threads,
+        /// and must not throw. An exception escaping either terminates the program.
+        /// - `executor` must be an `mpl::work_stealing_pool`, or another type meeting the same
+        /// interface (a nested aggregate `job` type holding a `void (*)(void*) noexcept` and a
+        /// `void*`, and a member function `execute(std::span<const job>)` that returns once
+        /// every job has completed)
+        /// - If given, `instrument` must be invocable with the corresponding metaprogramming
+        /// type for each element of this `List` and a `std::chrono::nanoseconds`
+        ///
+        /// # Example
+        /// @code{.cpp}
+        /// auto pool = work_stealing_pool{};
+        /// registry.for_each_parallel(
+        ///     [](MetaType auto type) { codec_cache<typename decltype(type)::type>::build(); },
+        ///     pool,
+        ///     [](MetaType auto type, std::chrono::nanoseconds elapsed) {
+        ///         report_init_time(type.name(), elapsed);
+        ///     });
+        /// @endcode
+        ///
+        /// @tparam TVisitor the type of the function to invoke with each element
+        /// of this `List`
+        /// @tparam TExecutor the type of the executor to run the invocations on
+        /// @tparam TInstrument the type of the instrumentation callback
+        /// @param vis the function to invoke with each element of this `List`
+        /// @param executor the executor to run the invocations on
+        /// @param instrument the function to report the time spent on each element to
+        template<typename TVisitor,
+                 detail::job_executor TExecutor,
+                 typename TInstrument = detail::no_instrumentation>
+            requires(std::invocable<TVisitor&, as_meta<TTypes>> && ...)
+                    && (std::same_as<std::invoke_result_t<TVisitor&, as_meta<TTypes>>, void> && ...)
+                    && (std::same_as<std::remove_cvref_t<TInstrument>, detail::no_instrumentation>
+                        || (std::invocable<TInstrument&, as_meta<TTypes>, std::chrono::nanoseconds>
+                            && ...))
+        auto for_each_parallel(TVisitor&& vis, // NOLINT(*-missing-std-forward)
+                               TExecutor& executor,
+                               TInstrument&& instrument = {}) // NOLINT(*-missing-std-forward)
+            const -> void {
+            using job = typename TExecutor::job;
+            using context_type = detail::parallel_context<std::remove_reference_t<TVisitor>,
+                                                          std::remove_reference_t<TInstrument>>;
+
+            if constexpr(sizeof...(TTypes) != 0) {
+                auto context = context_type{&vis, &instrument};
+                const auto jobs = std::array<job, sizeof...(TTypes)>{
+                    job{&detail::invoke_parallel_element<as_meta<TTypes>, context_type>,
+                        &context}...};
+                executor.execute(std::span<const job>{jobs});
             }
         }
 
-        /// @brief Default accumulation operation.
-        /// Performs the arithmetic sum of the two `MetaValue`s
-        static constexpr auto sum = [](MetaValue auto _state, MetaValue auto current) noexcept {
-            return _state + current;
-        };
-
-      public:
         /// @brief Computes the arithmetic sum of `state` and the elements of this `List`.
         ///
         /// # Requirements
@@ -579,10 +1013,12 @@ namespace hyperion::mpl {
         /// @return the arithmetic sum of `state` and the elements of this `List`,
         /// as a `Value` specialization
         [[nodiscard]] constexpr auto accumulate(MetaValue auto state) const noexcept
-            requires(std::invocable<decltype(sum), as_meta<decltype(state)>, as_meta<TTypes>>
+            requires(std::invocable<detail::arithmetic_sum,
+                                    as_meta<decltype(state)>,
+                                    as_meta<TTypes>>
                      && ...)
         {
-            return accumulate_impl(as_meta<decltype(state)>{}, sum, List<as_meta<TTypes>...>{});
+            return algorithms::accumulate(as_meta<decltype(state)>{}, detail::arithmetic_sum{});
         }
 
         /// @brief Computes the accumulation of `state` and the elements of this `List`.
@@ -639,52 +1075,17 @@ namespace hyperion::mpl {
         /// @param accumulator the callable to perform the accumulation operation
         /// @return the accumulation of `state` and the elements of this `List`,
         /// according to `accumulator`
-        template<typename TDelay = List<as_meta<TTypes>...>>
+        template<typename TDelay = algorithms>
         [[nodiscard]] constexpr auto accumulate(auto state, auto&& accumulator) const noexcept
-            requires std::same_as<TDelay, List<as_meta<TTypes>...>> && requires {
-                accumulate_impl(as_meta<decltype(state)>{},
-                                std::forward<decltype(accumulator)>(accumulator),
-                                TDelay{});
+            requires std::same_as<TDelay, algorithms> && requires {
+                TDelay::accumulate(as_meta<decltype(state)>{},
+                                   std::forward<decltype(accumulator)>(accumulator));
             }
         {
-            return accumulate_impl(as_meta<decltype(state)>{},
-                                   std::forward<decltype(accumulator)>(accumulator),
-                                   List<as_meta<TTypes>...>{});
-        }
-
-      private:
-        /// @brief Returns the index of the first element of this list that satisfies `predicate`.
-        ///
-        /// # Requirements
-        /// - The value of `index` must be less than or equal to the size of this `List`,
-        /// `sizeof...(TTypes)`
-        ///
-        /// @param predicate the predicate to satisfy
-        /// @return The index of the first element to satisfy `predicate`, or if no element
-        /// satisfies `predicate`, `Value<sizeof...(TTypes)>`
-        template<typename TPredicate>
-        [[nodiscard]] static constexpr auto
-        find_if_impl([[maybe_unused]] TPredicate&& predicate) // NOLINT(*-missing-std-forward))
-            noexcept {
-            constexpr auto values = []<auto... Indices>(std::index_sequence<Indices...>) {
-                constexpr auto _at = [](MetaValue auto index) noexcept {
-                    return detail::at<as_meta<TTypes>...>(index);
-                };
-                return std::array{
-                    static_cast<bool>(_at(Value<Indices>{}).satisfies(TPredicate{}))...};
-            }(std::make_index_sequence<sizeof...(TTypes)>{});
-            constexpr auto first = [values]() {
-                for(auto i = 0_usize; i < values.size(); ++i) {
-                    if(values[i]) {
-                        return i;
-                    }
-                }
-                return values.size();
-            }();
-            return Value<static_cast<usize>(first), usize>{};
+            return algorithms::accumulate(as_meta<decltype(state)>{},
+                                          std::forward<decltype(accumulator)>(accumulator));
         }
 
-      public:
         /// @brief Returns the first element of this `List` that satisfies the
         /// metafunction predicate `predicate`.
         ///
@@ -724,13 +1125,15 @@ namespace hyperion::mpl {
         template<typename TPredicate>
             requires(MetaPredicateOf<TPredicate, as_meta<TTypes>> && ...)
                     || requires { (as_meta<TTypes>{}.satisfies(TPredicate{}), ...); }
-        [[nodiscard]] constexpr auto find_if(TPredicate&& predicate) const noexcept {
-            auto result = find_if_impl(std::forward<TPredicate>(predicate));
-            if constexpr(decltype(result){} == Value<sizeof...(TTypes), usize>{}) {
+        [[nodiscard]] constexpr auto
+        find_if([[maybe_unused]] TPredicate&& predicate) // NOLINT(*-missing-std-forward)
+            const noexcept {
+            constexpr auto index = algorithms::template index_if<std::remove_cvref_t<TPredicate>>;
+            if constexpr(index == sizeof...(TTypes)) {
                 return decltype_<not_found_tag>();
             }
             else {
-                return at(result);
+                return at(Value<index, usize>{});
             }
         }
 
@@ -798,16 +1201,7 @@ namespace hyperion::mpl {
         [[nodiscard]] constexpr auto
         count_if([[maybe_unused]] TPredicate&& predicate) // NOLINT(*-missing-std-forward)
             const noexcept {
-            constexpr auto accumulator = [](auto state, auto element) {
-                if constexpr((decltype(element){}.satisfies(TPredicate{}))) {
-                    return state + 1_value;
-                }
-                else {
-                    return state;
-                }
-            };
-
-            return accumulate(0_value, accumulator);
+            return Value<algorithms::template count_if<std::remove_cvref_t<TPredicate>>, usize>{};
         }
 
         /// @brief Returns the number of elements of this `List` that are equal to `value`,
@@ -1004,8 +1398,10 @@ namespace hyperion::mpl {
         template<typename TPredicate>
             requires(MetaPredicateOf<TPredicate, as_meta<TTypes>> && ...)
                     || requires { (as_meta<TTypes>{}.satisfies(TPredicate{}), ...); }
-        [[nodiscard]] constexpr auto index_if(TPredicate&& predicate) const noexcept {
-            return find_if_impl(std::forward<TPredicate>(predicate));
+        [[nodiscard]] constexpr auto
+        index_if([[maybe_unused]] TPredicate&& predicate) // NOLINT(*-missing-std-forward)
+            const noexcept {
+            return Value<algorithms::template index_if<std::remove_cvref_t<TPredicate>>, usize>{};
         }
 
         /// @brief Returns the index of the first element of this `List`
@@ -1083,16 +1479,7 @@ namespace hyperion::mpl {
         [[nodiscard]] constexpr auto
         filter([[maybe_unused]] TPredicate&& predicate) // NOLINT(*-missing-std-forward)
             const noexcept {
-            constexpr auto append_valid = [](auto list, auto element) noexcept {
-                if constexpr(decltype(element){}.satisfies(TPredicate{})) {
-                    return list.push_back(element);
-                }
-                else {
-                    return list;
-                }
-            };
-
-            return accumulate(List<>{}, append_valid);
+            return typename algorithms::template filter<std::remove_cvref_t<TPredicate>, true>{};
         }
 
         /// @brief Returns a copy of this `List`, but with all elements that satisfy
@@ -1142,16 +1529,7 @@ namespace hyperion::mpl {
         [[nodiscard]] constexpr auto
         remove_if([[maybe_unused]] TPredicate&& predicate) // NOLINT(*-missing-std-forward)
             const noexcept {
-            constexpr auto append_valid = [](auto list, auto element) noexcept {
-                if constexpr(not decltype(element){}.satisfies(TPredicate{})) {
-                    return list.push_back(element);
-                }
-                else {
-                    return list;
-                }
-            };
-
-            return accumulate(List<>{}, append_valid);
+            return typename algorithms::template filter<std::remove_cvref_t<TPredicate>, false>{};
         }
 
         /// @brief Returns a copy of this `List`, but with all elements that
@@ -1230,7 +1608,7 @@ namespace hyperion::mpl {
                      && ((TValues::value < sizeof...(TTypes)) && ...)
                      && ((TValues::value >= 0) && ...)
         [[nodiscard]] constexpr auto sift([[maybe_unused]] TList<TValues...> list) const noexcept {
-            return List<as_raw<decltype(at(TValues{}))>...>{};
+            return List<as_raw<detail::type_at<TValues::value, as_meta<TTypes>...>>...>{};
         }
 
         /// @brief Converts the elements of this list into a parameter pack, and invokes
@@ -1286,7 +1664,7 @@ namespace hyperion::mpl {
         template<usize TIndex>
             requires(TIndex < sizeof...(TTypes))
         [[nodiscard]] constexpr auto at() const noexcept {
-            return detail::at<as_meta<TTypes>...>(Value<TIndex>{});
+            return detail::type_at<TIndex, as_meta<TTypes>...>{};
         }
 
         /// @brief Returns the element of this `List` at index, `index`.
@@ -1312,7 +1690,8 @@ namespace hyperion::mpl {
         [[nodiscard]] constexpr auto at(MetaValue auto index) const noexcept
             requires(decltype(index)::value < sizeof...(TTypes))
         {
-            return detail::at<as_meta<TTypes>...>(index);
+            return detail::type_at<static_cast<usize>(decltype(index)::value),
+                                   as_meta<TTypes>...>{};
         }
 
         /// @brief Returns the first element of this `List`
@@ -1332,7 +1711,7 @@ namespace hyperion::mpl {
         ///
         /// @return the first element of this `List`
         [[nodiscard]] constexpr auto front() const noexcept {
-            return detail::at<as_meta<TTypes>...>(0_value);
+            return detail::type_at<0, as_meta<TTypes>...>{};
         }
 
         /// @brief Returns the last element of this `List`
@@ -1352,7 +1731,7 @@ namespace hyperion::mpl {
         ///
         /// @return the last element of this `List`
         [[nodiscard]] constexpr auto back() const noexcept {
-            return detail::at<as_meta<TTypes>...>(Value<sizeof...(TTypes) - 1>{});
+            return detail::type_at<sizeof...(TTypes) - 1, as_meta<TTypes>...>{};
         }
 
         /// @brief Returns a copy of this `List`,
@@ -1558,19 +1937,15 @@ namespace hyperion::mpl {
         /// @brief Returns a copy of this `List` with the first element removed
         /// @return a copy of this `List` with the first element removed
         [[nodiscard]] constexpr auto pop_front() const noexcept {
-            constexpr auto to_raw = []<typename... TMetas>([[maybe_unused]] List<TMetas...> list) {
-                return List<as_raw<TMetas>...>{};
-            };
-            return to_raw(typename detail::pop_front<List<as_meta<TTypes>...>>::remaining{});
+            using remaining = typename detail::pop_front<List<as_meta<TTypes>...>>::remaining;
+            return typename detail::to_raw_list<remaining>::type{};
         }
 
         /// @brief Returns a copy of this `List` with the last element removed
         /// @return a copy of this `List` with the last element removed
         [[nodiscard]] constexpr auto pop_back() const noexcept {
-            constexpr auto to_raw = []<typename... TMetas>([[maybe_unused]] List<TMetas...> list) {
-                return List<as_raw<TMetas>...>{};
-            };
-            return to_raw(typename detail::pop_back<List<as_meta<TTypes>...>>::remaining{});
+            using remaining = typename detail::pop_back<List<as_meta<TTypes>...>>::remaining;
+            return typename detail::to_raw_list<remaining>::type{};
         }
 
         /// @brief Converts the elements of this `List` and `rhs` into a single list
@@ -1600,12 +1975,7 @@ namespace hyperion::mpl {
         template<typename... TRHTypes>
             requires(sizeof...(TRHTypes) == sizeof...(TTypes))
         [[nodiscard]] constexpr auto zip([[maybe_unused]] List<TRHTypes...> rhs) const noexcept {
-            return []<usize... TIndices>(std::index_sequence<TIndices...>) {
-                constexpr auto _list = decltype(rhs){};
-
-                return mpl::List<as_raw<decltype(make_pair(List{}.template at<TIndices>(),
-                                                           _list.template at<TIndices>()))>...>{};
-            }(std::index_sequence_for<TTypes...>{});
+            return List<as_raw<decltype(make_pair(as_meta<TTypes>{}, as_meta<TRHTypes>{}))>...>{};
         }
     };
 } // namespace hyperion::mpl
@@ -1642,24 +2012,10 @@ namespace hyperion::mpl {
             return Value<false>{};
         }
         else {
-            constexpr auto is_same
-                = []<typename TFirst, typename TSecond>(Pair<TFirst, TSecond> pair)
-                requires(MetaType<typename decltype(pair)::first>
-                         || MetaValue<typename decltype(pair)::first>
-                         || MetaPair<typename decltype(pair)::first>)
-                        && (MetaType<typename decltype(pair)::second>
-                            || MetaValue<typename decltype(pair)::second>
-                            || MetaPair<typename decltype(pair)::second>)
-            {
-                return equal_to(typename decltype(pair)::first{})(
-                    typename decltype(pair)::second{});
-            };
-
-            constexpr auto check_all = [](auto... results) noexcept {
-                return (results && ...);
-            };
-
-            return List<TLHTypes...>{}.zip(List<TRHTypes...>{}).apply(is_same).unwrap(check_all);
+            return Value<(static_cast<bool>(equal_to(detail::convert_to_meta_t<TLHTypes>{})(
+                              detail::convert_to_meta_t<TRHTypes>{}))
+                          && ...),
+                         bool>{};
         }
     }
 
@@ -1692,24 +2048,10 @@ namespace hyperion::mpl {
             return Value<true>{};
         }
         else {
-            constexpr auto is_same
-                = []<typename TFirst, typename TSecond>(Pair<TFirst, TSecond> pair)
-                requires(MetaType<typename decltype(pair)::first>
-                         || MetaValue<typename decltype(pair)::first>
-                         || MetaPair<typename decltype(pair)::first>)
-                        && (MetaType<typename decltype(pair)::second>
-                            || MetaValue<typename decltype(pair)::second>
-                            || MetaPair<typename decltype(pair)::second>)
-            {
-                return not_equal_to(typename decltype(pair)::first{})(
-                    typename decltype(pair)::second{});
-            };
-
-            constexpr auto check_all = [](auto... results) noexcept {
-                return (results || ...);
-            };
-
-            return List<TLHTypes...>{}.zip(List<TRHTypes...>{}).apply(is_same).unwrap(check_all);
+            return Value<(static_cast<bool>(not_equal_to(detail::convert_to_meta_t<TLHTypes>{})(
+                              detail::convert_to_meta_t<TRHTypes>{}))
+                          || ...),
+                         bool>{};
         }
     }
 
@@ -1802,52 +2144,6 @@ namespace hyperion::mpl {
         }
     #endif // HYPERION_PLATFORM_COMPILER_IS_MSVC
 
-        /// @brief Statically stack-allocated vector containing elements of type `TType`,
-        /// up to `TCapacity` number of elements
-        ///
-        /// @note This is only a minimal implementation providing enough functionality to
-        /// support a vector containing primitive types
-        template<typename TType, usize TCapacity>
-        class static_vector {
-          public:
-            template<typename TValue>
-            constexpr auto push_back(TValue&& value) noexcept(
-                decltype_<TType>().is_noexcept_constructible_from(decltype_<decltype(value)>()))
-                -> void {
-                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
-                m_values[m_size++] = std::forward<TValue>(value);
-            }
-
-            [[nodiscard]] constexpr auto operator[](auto index) const noexcept -> const TType& {
-                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
-                return m_values[index];
-            }
-
-            [[nodiscard]] constexpr auto size() const noexcept -> usize {
-                return m_size;
-            }
-
-            [[nodiscard]] constexpr auto begin() noexcept {
-                return m_values.begin();
-            }
-
-            [[nodiscard]] constexpr auto end() noexcept {
-                return m_values.begin() + m_size;
-            }
-
-            [[nodiscard]] constexpr auto begin() const noexcept {
-                return m_values.begin();
-            }
-
-            [[nodiscard]] constexpr auto end() const noexcept {
-                return m_values.begin() + m_size;
-            }
-
-          private:
-            std::array<TType, TCapacity> m_values = {};
-            usize m_size = 0_usize;
-        };
-
         /// @brief Return a range of size `end - begin`,
         /// starting at `begin` and incrementing for each successive element,
         /// until the size is reached.
@@ -1856,23 +2152,23 @@ namespace hyperion::mpl {
         /// @param end The one-after-the-end value
         /// @return a range of values from `begin` to `end`
         constexpr auto iota(MetaValue auto begin, MetaValue auto end) noexcept {
-            std::array<std::remove_cvref_t<decltype(decltype(begin)::value)>,
-                       decltype(end)::value - decltype(begin)::value>
-                range{};
-            auto curr = decltype(begin)::value;
-            for(auto& elem : range) {
-                elem = curr++;
-            }
-            return range;
+            using value_type = std::remove_cvref_t<decltype(decltype(begin)::value)>;
+            // expand the range directly instead of filling it in a loop,
+            // so that it costs no `constexpr` evaluation steps
+            return []<usize... TIndices>([[maybe_unused]] std::index_sequence<TIndices...> seq) {
+                return std::array<value_type, sizeof...(TIndices)>{
+                    (decltype(begin)::value + static_cast<value_type>(TIndices))...};
+            }(std::make_index_sequence<decltype(end)::value - decltype(begin)::value>{});
         }
 
-        /// @brief Converts the given range to a `static_vector<TType, TCapacity`
+        /// @brief Converts the given range of at most `TCapacity` elements to a
+        /// `static_vector<TType, TCapacity>`
         /// @param range the range to convert
         /// @return a `static_vector<TType, TCapacity>` containing the elements
         /// of the `range`
         template<typename TType, usize TCapacity>
         constexpr auto to_vector(auto&& range) noexcept {
-            static_vector<TType, TCapacity> arr{};
+            mpl::static_vector<TType, std::max(TCapacity, 1_usize), bounds_policy::unchecked> arr{};
             for(const auto& elem : range) {
                 arr.push_back(elem);
             }
@@ -1926,22 +2222,20 @@ namespace hyperion::mpl {
                      && requires { (function{}(detail::convert_to_meta_t<TTypes>{}), ...); })
         {
             // case for predicates
-            // we use `std::common_type` here to force conversion of
-            // `Value<true || false>` to `bool` to enable storing the
-            // results of invoking the predicate in a `std::array`
+            // we convert the results of invoking the predicate to `bool` (e.g. from
+            // `Value<true || false>`) to enable storing them in a `std::array`.
+            // This is done element-wise, instead of through `std::common_type`,
+            // because `std::common_type` recurses once per element
             if constexpr(requires {
-                             std::array<std::common_type_t<decltype(function{}(
-                                            detail::convert_to_meta_t<TTypes>{}))...>,
-                                        sizeof...(TTypes)>{
-                                 function{}(detail::convert_to_meta_t<TTypes>{})...};
+                             std::array<bool, sizeof...(TTypes)>{static_cast<bool>(
+                                 function{}(detail::convert_to_meta_t<TTypes>{}))...};
                          })
             {
                 // calculate the indices of the "good" elements based on the range adaptor in use
                 constexpr auto indices = detail::to_vector<usize, sizeof...(TTypes)>(
-                    adaptor{}([values = std::array<std::common_type_t<decltype(function{}(
-                                                       detail::convert_to_meta_t<TTypes>{}))...>,
-                                                   sizeof...(TTypes)>{function{}(
-                                   detail::convert_to_meta_t<TTypes>{})...}](auto index) {
+                    adaptor{}([values = std::array<bool, sizeof...(TTypes)>{static_cast<bool>(
+                                   function{}(detail::convert_to_meta_t<TTypes>{}))...}](
+                                  auto index) {
                         // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
                         return values[index];
                     })(detail::iota(0_value, list.size())));
@@ -1996,6 +2290,45 @@ namespace hyperion::mpl::_test::list {
     static_assert(not List<int>{}.is_empty(),
                   "hyperion::mpl::List::is_empty test case 2 (failing)");
 
+    struct padded_layout {
+        u8 first;
+        u32 second;
+    };
+
+    // NOLINTNEXTLINE(*-special-member-functions)
+    struct not_trivially_copyable_layout {
+        not_trivially_copyable_layout(const not_trivially_copyable_layout& other);
+    };
+
+    template<typename TList>
+    concept can_query_layout = requires { TList{}.max_sizeof(); };
+
+    static_assert(List<u8, u32, u16>{}.max_sizeof() == 4_usize,
+                  "hyperion::mpl::List::max_sizeof test case 1 (failing)");
+    static_assert(List<>{}.max_sizeof() == 0_usize,
+                  "hyperion::mpl::List::max_sizeof test case 2 (failing)");
+    static_assert(not can_query_layout<List<Value<1>, Value<2>>>,
+                  "hyperion::mpl::List::max_sizeof test case 3 (failing)");
+    static_assert(List<u8, Type<u64>, u16>{}.max_alignof() == alignof(u64),
+                  "hyperion::mpl::List::max_alignof test case 1 (failing)");
+    static_assert(List<>{}.max_alignof() == 1_usize,
+                  "hyperion::mpl::List::max_alignof test case 2 (failing)");
+
+    static_assert(List<int, padded_layout>{}.all_trivially_copyable(),
+                  "hyperion::mpl::List::all_trivially_copyable test case 1 (failing)");
+    static_assert(not List<int, not_trivially_copyable_layout>{}.all_trivially_copyable(),
+                  "hyperion::mpl::List::all_trivially_copyable test case 2 (failing)");
+    static_assert(List<int, padded_layout>{}.all_standard_layout(),
+                  "hyperion::mpl::List::all_standard_layout test case 1 (failing)");
+    static_assert(List<u32, i64>{}.all_unique_object_representations(),
+                  "hyperion::mpl::List::all_unique_object_representations test case 1 (failing)");
+    static_assert(not List<u32, padded_layout>{}.all_unique_object_representations(),
+                  "hyperion::mpl::List::all_unique_object_representations test case 2 (failing)");
+    static_assert(List<int, padded_layout>{}.all_implicit_lifetime(),
+                  "hyperion::mpl::List::all_implicit_lifetime test case 1 (failing)");
+    static_assert(not List<int, not_trivially_copyable_layout>{}.all_implicit_lifetime(),
+                  "hyperion::mpl::List::all_implicit_lifetime test case 2 (failing)");
+
     static constexpr auto add_const = [](MetaType auto type) {
         return type.as_const();
     };
@@ -2095,6 +2428,41 @@ namespace hyperion::mpl::_test::list {
 
     static_assert(test_for_each(), "hyperion::mpl::List::for_each test (failing)");
 
+    struct serial_executor {
+        struct job {
+            void (*invoke)(void* context) noexcept;
+            void* context;
+        };
+
+        auto execute(std::span<const job> jobs) noexcept -> void {
+            for(const auto& work : jobs) {
+                work.invoke(work.context);
+            }
+        }
+    };
+
+    template<typename TList, typename TVisitor, typename TInstrument = detail::no_instrumentation>
+    concept can_for_each_parallel
+        = requires(TList list, TVisitor vis, serial_executor executor, TInstrument instrument) {
+              list.for_each_parallel(vis, executor, instrument);
+          };
+
+    static_assert(can_for_each_parallel<List<int, double>, decltype([](MetaType auto) {})>,
+                  "hyperion::mpl::List::for_each_parallel test case 1 (failing)");
+    static_assert(
+        can_for_each_parallel<List<int, double>,
+                              decltype([](MetaType auto) {}),
+                              decltype([](MetaType auto, std::chrono::nanoseconds) {})>,
+        "hyperion::mpl::List::for_each_parallel test case 2 (failing)");
+    static_assert(not can_for_each_parallel<List<int, double>, decltype([](MetaType auto type) {
+                                                return type;
+                                            })>,
+                  "hyperion::mpl::List::for_each_parallel test case 3 (failing)");
+    static_assert(not can_for_each_parallel<List<int, double>,
+                                            decltype([](MetaType auto) {}),
+                                            decltype([](MetaType auto) {})>,
+                  "hyperion::mpl::List::for_each_parallel test case 4 (failing)");
+
     [[nodiscard]] constexpr auto test_for_each_n1() noexcept -> bool {
         constexpr auto list = List<int, double, float, int>{};
 
@@ -2245,6 +2613,26 @@ namespace hyperion::mpl::_test::list {
                       == 8_value,
                   "hyperion::mpl::List::accumulate test case 4 (failing)");
 
+    /// @brief Accumulator that only sums when invoked as an rvalue, to check that
+    /// `accumulate` preserves the value category of the accumulator it receives
+    struct rvalue_sum {
+        constexpr auto operator()(MetaValue auto state, MetaValue auto) const& noexcept {
+            return state;
+        }
+        constexpr auto operator()(MetaValue auto state, MetaValue auto val) const&& noexcept {
+            return state + val;
+        }
+    };
+
+    inline constexpr auto lvalue_sum = rvalue_sum{};
+
+    static_assert(List<Value<3>, Value<2>, Value<3>>{}.accumulate(0_value, rvalue_sum{})
+                      == 8_value,
+                  "hyperion::mpl::List::accumulate test case 5 (failing)");
+    static_assert(List<Value<3>, Value<2>, Value<3>>{}.accumulate(1_value, lvalue_sum)
+                      == 1_value,
+                  "hyperion::mpl::List::accumulate test case 6 (failing)");
+
     static_assert(List<Value<3>, Value<2>, Value<3>>{}.count_if([](auto val) {
         return val == 3_value;
     }) == 2_value,
@@ -2297,6 +2685,15 @@ namespace hyperion::mpl::_test::list {
     static_assert(List<int, Value<1>, double, Value<2>, float>{}.filter(is_value)
                       == List<Value<1>, Value<2>>{},
                   "hyperion::mpl::List::filter test case 4 (failing)");
+    static_assert(std::same_as<decltype(List<int, const double>{}.filter(is_const)),
+                               decltype(List<Type<int>, Type<const double>>{}.filter(is_const))>,
+                  "hyperion::mpl::List::filter test case 5 (failing)");
+    static_assert(std::same_as<decltype(List<Pair<int, double>, Type<int>, Value<1>>{}.filter(
+                                   []([[maybe_unused]] auto element) noexcept {
+                                       return Value<true>{};
+                                   })),
+                               List<Pair<Type<int>, Type<double>>, int, Value<1, int>>>,
+                  "hyperion::mpl::List::filter test case 6 (failing)");
 
     static_assert(List<int, const double, float>{}.remove_if(is_const) == List<int, float>{},
                   "hyperion::mpl::List::remove_if test case 1 (failing)");
@@ -2307,6 +2704,12 @@ namespace hyperion::mpl::_test::list {
     static_assert(List<int, Value<1>, double, Value<2>, float>{}.remove_if(is_value)
                       == List<int, double, float>{},
                   "hyperion::mpl::List::remove_if test case 4 (failing)");
+    static_assert(std::same_as<decltype(List<Pair<int, double>, Type<int>, Value<1>>{}.remove_if(
+                                   []([[maybe_unused]] auto element) noexcept {
+                                       return Value<false>{};
+                                   })),
+                               List<Pair<Type<int>, Type<double>>, int, Value<1, int>>>,
+                  "hyperion::mpl::List::remove_if test case 5 (failing)");
 
     static_assert(List<int, const double, float>{}.remove(decltype_<const double>())
                       == List<int, float>{},
@@ -0,0 +1,534 @@
+/// @file lut.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Compile-time lookup table generation from `Value` metafunctions
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/concurrent_layout.h>
+#include <hyperion/mpl/metatypes.h>
+#include <hyperion/mpl/pair.h>
+#include <hyperion/mpl/type.h>
+#include <hyperion/mpl/value.h>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup lut Compile-Time Lookup Tables
+/// Hyperion provides `mpl::make_lut` for generating lookup tables (e.g. CRC tables,
+/// gamma curves, bit-reversal tables) entirely at compile time, from a `Value`
+/// metafunction or a `constexpr` callable and the `Value` range(s) of its argument(s).
+///
+/// Because the table is computed during constant evaluation, there is no startup cost, and
+/// a `static constexpr` table is emitted directly into read-only data. Tables are aligned to
+/// the cache line size, and integral tables use the narrowest integer type able to hold every
+/// entry, unless an element type is given explicitly.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/lut.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// static constexpr auto bit_reverse = make_lut(
+///     [](usize index) {
+///         auto reversed = 0_usize;
+///         for(auto bit = 0_usize; bit < 8_usize; ++bit) {
+///             reversed |= ((index >> bit) & 1_usize) << (7_usize - bit);
+///         }
+///         return reversed;
+///     },
+///     256_value);
+/// // the entries are all less than 256, so the table is a `lut<u8, 256>`
+/// static_assert(std::same_as<decltype(bit_reverse)::value_type, u8>);
+/// static_assert(bit_reverse[1] == 128);
+/// @endcode
+/// @headerfile hyperion/mpl/lut.h
+/// @}
+
+#ifndef HYPERION_MPL_LUT_H
+    #define HYPERION_MPL_LUT_H
+
+namespace hyperion::mpl {
+
+    namespace detail {
+        /// @brief Tag used as the default element type of `make_lut`, requesting that the
+        /// narrowest suitable element type be chosen
+        struct narrowest_element { };
+
+        /// @brief The index range described by a `make_lut` range argument, `TRange`.
+        /// A `MetaValue` `Value<N>` describes `[0, N)`, and a `MetaPair`
+        /// `Pair<Value<B>, Value<E>>` describes `[B, E)`.
+        template<typename TRange>
+        struct lut_range;
+
+        template<MetaValue TRange>
+        struct lut_range<TRange> {
+            using index_type = std::remove_cvref_t<decltype(TRange::value)>;
+            static inline constexpr auto begin = index_type{0};
+            static inline constexpr auto end = TRange::value;
+        };
+
+        template<MetaPair TRange>
+            requires MetaValue<typename TRange::first> && MetaValue<typename TRange::second>
+        struct lut_range<TRange> {
+            using index_type = std::common_type_t<decltype(TRange::first::value),
+                                                  decltype(TRange::second::value)>;
+            static inline constexpr auto begin = static_cast<index_type>(TRange::first::value);
+            static inline constexpr auto end = static_cast<index_type>(TRange::second::value);
+        };
+
+        template<typename TRange>
+        concept valid_lut_range = requires {
+            lut_range<TRange>::begin;
+            requires std::integral<typename lut_range<TRange>::index_type>;
+            requires lut_range<TRange>::begin < lut_range<TRange>::end;
+        };
+
+        template<typename TRange>
+        static inline constexpr auto lut_extent
+            = static_cast<usize>(lut_range<TRange>::end - lut_range<TRange>::begin);
+
+        /// @brief Returns the coordinate in dimension `TDim` of the entry at row-major
+        /// index `flat` of a table with the dimensions `TRanges`
+        template<usize TDim, typename... TRanges>
+        [[nodiscard]] constexpr auto lut_coordinate(usize flat) noexcept {
+            using range = lut_range<std::tuple_element_t<TDim, std::tuple<TRanges...>>>;
+            constexpr auto extents = std::array<usize, sizeof...(TRanges)>{lut_extent<TRanges>...};
+
+            auto stride = 1_usize;
+            for(auto dim = TDim + 1_usize; dim < sizeof...(TRanges); ++dim) {
+                stride *= extents[dim]; // NOLINT(*-pro-bounds-constant-array-index)
+            }
+
+            using index_type = typename range::index_type;
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            const auto offset = static_cast<index_type>((flat / stride) % extents[TDim]);
+            return static_cast<index_type>(range::begin + offset);
+        }
+
+        template<typename TFunction, typename... TRanges>
+        concept lut_metafunction = requires {
+            { TFunction{}(Value<lut_range<TRanges>::begin>{}...) } -> MetaValue;
+        };
+
+        template<typename TFunction, typename... TRanges>
+        concept lut_function = std::default_initializable<TFunction>
+                               && (lut_metafunction<TFunction, TRanges...>
+                                   || std::invocable<const TFunction&,
+                                                     typename lut_range<TRanges>::index_type...>);
+
+        /// @brief Returns the entry at row-major index `TFlat`, computed by invoking the
+        /// `Value` metafunction `TFunction` with the coordinates of the entry
+        template<typename TFunction, usize TFlat, typename... TRanges, usize... TDims>
+        [[nodiscard]] consteval auto
+        lut_meta_entry([[maybe_unused]] std::index_sequence<TDims...> dims) noexcept {
+            return decltype(TFunction{}(
+                Value<lut_coordinate<TDims, TRanges...>(TFlat)>{}...))::value;
+        }
+
+        /// @brief Computes every entry of the table, in row-major order,
+        /// in the common type of the results of `TFunction`
+        template<typename TFunction, typename... TRanges>
+        [[nodiscard]] consteval auto lut_entries() {
+            constexpr auto size = (lut_extent<TRanges> * ...);
+            constexpr auto dims = std::index_sequence_for<TRanges...>{};
+
+            if constexpr(lut_metafunction<TFunction, TRanges...>) {
+                return [&]<usize... TFlat>([[maybe_unused]] std::index_sequence<TFlat...> flat) {
+                    using entry = std::common_type_t<std::remove_cvref_t<
+                        decltype(lut_meta_entry<TFunction, TFlat, TRanges...>(dims))>...>;
+                    return std::array<entry, size>{
+                        static_cast<entry>(lut_meta_entry<TFunction, TFlat, TRanges...>(dims))...};
+                }(std::make_index_sequence<size>{});
+            }
+            else {
+                using entry = std::remove_cvref_t<std::invoke_result_t<
+                    const TFunction&,
+                    typename lut_range<TRanges>::index_type...>>;
+                auto entries = std::array<entry, size>{};
+                const auto func = TFunction{};
+                for(auto flat = 0_usize; flat < size; ++flat) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    entries[flat] = [&]<usize... TDims>(
+                                        [[maybe_unused]] std::index_sequence<TDims...> indices) {
+                        return func(lut_coordinate<TDims, TRanges...>(flat)...);
+                    }(dims);
+                }
+                return entries;
+            }
+        }
+
+        /// @brief Returns the `mpl::Type` of the narrowest integer type able to represent
+        /// every value in `[TMin, TMax]`, preferring unsigned types when `TMin` is non-negative
+        template<auto TMin, auto TMax>
+        [[nodiscard]] constexpr auto narrowest_integral() noexcept {
+            constexpr auto fits = []<typename TType>([[maybe_unused]] Type<TType> type) {
+                return std::in_range<TType>(TMin) && std::in_range<TType>(TMax);
+            };
+
+            if constexpr(TMin >= 0) {
+                if constexpr(fits(decltype_<u8>())) {
+                    return decltype_<u8>();
+                }
+                else if constexpr(fits(decltype_<u16>())) {
+                    return decltype_<u16>();
+                }
+                else if constexpr(fits(decltype_<u32>())) {
+                    return decltype_<u32>();
+                }
+                else {
+                    return decltype_<u64>();
+                }
+            }
+            else {
+                if constexpr(fits(decltype_<i8>())) {
+                    return decltype_<i8>();
+                }
+                else if constexpr(fits(decltype_<i16>())) {
+                    return decltype_<i16>();
+                }
+                else if constexpr(fits(decltype_<i32>())) {
+                    return decltype_<i32>();
+                }
+                else {
+                    return decltype_<i64>();
+                }
+            }
+        }
+
+        /// @brief Whether `TType` is a character type, which `make_lut` never narrows
+        template<typename TType>
+        concept character = std::same_as<TType, char> || std::same_as<TType, wchar_t>
+                            || std::same_as<TType, char8_t> || std::same_as<TType, char16_t>
+                            || std::same_as<TType, char32_t>;
+
+        /// @brief Returns whether every one of `entries` converts to `TElement` without
+        /// changing its value. Conversions between non-arithmetic types are only required
+        /// to be valid
+        template<typename TElement, typename TEntry, usize TSize>
+        [[nodiscard]] constexpr auto
+        lut_entries_fit(const std::array<TEntry, TSize>& entries) noexcept -> bool {
+            if constexpr(std::is_arithmetic_v<TElement> && std::is_arithmetic_v<TEntry>) {
+                return std::ranges::all_of(entries, [](const TEntry& entry) {
+                    const auto converted = static_cast<TElement>(entry);
+                    return static_cast<TEntry>(converted) == entry
+                           && (entry < TEntry{}) == (converted < TElement{});
+                });
+            }
+            else {
+                return std::convertible_to<const TEntry&, TElement>;
+            }
+        }
+
+        /// @brief Whether the entries generated by `TFunction` fit in the explicitly
+        /// requested element type `TElement` (always true if none was requested)
+        template<typename TElement, typename TFunction, typename... TRanges>
+        concept lut_element_fits
+            = std::same_as<TElement, narrowest_element>
+              || lut_entries_fit<TElement>(lut_entries<TFunction, TRanges...>());
+
+        /// @brief Returns the `mpl::Type` of the element type to use for a table with the
+        /// given `entries`: `TElement` if one was given explicitly, otherwise the narrowest
+        /// integer type able to hold them if they are integers, or their own type if not
+        template<typename TElement, auto TEntries>
+        [[nodiscard]] constexpr auto lut_element_type() noexcept {
+            using entry = typename decltype(TEntries)::value_type;
+            if constexpr(not std::same_as<TElement, narrowest_element>) {
+                return decltype_<TElement>();
+            }
+            else if constexpr(std::integral<entry> && not std::same_as<entry, bool>
+                              && not character<entry>)
+            {
+                constexpr auto min = *std::min_element(TEntries.begin(), TEntries.end());
+                constexpr auto max = *std::max_element(TEntries.begin(), TEntries.end());
+                return narrowest_integral<min, max>();
+            }
+            else {
+                return decltype_<entry>();
+            }
+        }
+
+        template<typename TElement, usize... TExtents>
+        struct nested_array;
+
+        template<typename TElement, usize TExtent>
+        struct nested_array<TElement, TExtent> {
+            using type = std::array<TElement, TExtent>;
+        };
+
+        template<typename TElement, usize TExtent, usize... TExtents>
+        struct nested_array<TElement, TExtent, TExtents...> {
+            using type = std::array<typename nested_array<TElement, TExtents...>::type, TExtent>;
+        };
+
+        /// @brief Fills `array`, a `nested_array<TElement, ...>::type`, with consecutive
+        /// elements of `entries`, in row-major order, starting at `next`
+        /// @return The index of the first element of `entries` not used
+        template<typename TElement, typename TSlot, usize TSize, typename TEntries>
+        constexpr auto
+        fill_nested(std::array<TSlot, TSize>& array, const TEntries& entries, usize next)
+            -> usize {
+            for(auto& slot : array) {
+                if constexpr(std::same_as<TSlot, TElement>) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    slot = static_cast<TElement>(entries[next]);
+                    ++next;
+                }
+                else {
+                    next = fill_nested<TElement>(slot, entries, next);
+                }
+            }
+            return next;
+        }
+    } // namespace detail
+
+    /// @brief `lut` is a cache-line aligned, constant lookup table with `sizeof...(TExtents)`
+    /// dimensions, generated by `mpl::make_lut`.
+    ///
+    /// The entries are stored in a (nested, for multi-dimensional tables) `std::array`, so
+    /// the entry at coordinates `(i, j, k)` of a three dimensional table is `table[i][j][k]`.
+    ///
+    /// @tparam TElement The type of the entries of the table
+    /// @tparam TExtents The size of each dimension of the table
+    /// @ingroup lut
+    /// @headerfile hyperion/mpl/lut.h
+    template<typename TElement, usize... TExtents>
+        requires(sizeof...(TExtents) != 0) && ((TExtents != 0) && ...)
+    class lut {
+      public:
+        /// @brief The type of the entries of this table
+        using value_type = TElement;
+        /// @brief The (possibly nested) `std::array` type storing the entries of this table
+        using array_type = typename detail::nested_array<TElement, TExtents...>::type;
+
+        /// @brief Constructs a `lut` holding `entries`
+        /// @param entries The entries of the table
+        constexpr explicit lut(const array_type& entries) noexcept : m_entries(entries) {
+        }
+
+        /// @brief Returns the number of dimensions of this table
+        /// @return The number of dimensions
+        [[nodiscard]] static constexpr auto rank() noexcept -> usize {
+            return sizeof...(TExtents);
+        }
+
+        /// @brief Returns the size of each dimension of this table
+        /// @return The extents of this table
+        [[nodiscard]] static constexpr auto extents() noexcept
+            -> std::array<usize, sizeof...(TExtents)> {
+            return {TExtents...};
+        }
+
+        /// @brief Returns the number of elements in the outermost dimension of this table
+        /// @return The size of the outermost dimension
+        [[nodiscard]] static constexpr auto size() noexcept -> usize {
+            return std::get<0>(std::array<usize, sizeof...(TExtents)>{TExtents...});
+        }
+
+        /// @brief Returns the element at `index` in the outermost dimension of this table.
+        /// For one dimensional tables, this is an entry. Otherwise, it is a `std::array`
+        /// holding the corresponding slice of the table
+        /// @param index The index of the element
+        /// @return The element at `index`
+        [[nodiscard]] constexpr auto operator[](usize index) const noexcept -> const auto& {
+            return m_entries[index]; // NOLINT(*-pro-bounds-constant-array-index)
+        }
+
+        /// @brief Returns the `std::array` storing the entries of this table
+        /// @return The entries of this table
+        [[nodiscard]] constexpr auto array() const noexcept -> const array_type& {
+            return m_entries;
+        }
+
+        [[nodiscard]] constexpr auto begin() const noexcept {
+            return m_entries.begin();
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept {
+            return m_entries.end();
+        }
+
+      private:
+        alignas(hardware_constructive_interference_size) array_type m_entries;
+    };
+
+    /// @brief Generates a lookup table at compile time, by invoking `func` with the
+    /// coordinates of each entry.
+    ///
+    /// Each of `ranges` describes the coordinates of one dimension of the table: a `Value<N>`
+    /// describes the coordinates `[0, N)`, and a `Pair<Value<B>, Value<E>>` describes the
+    /// coordinates `[B, E)`. The coordinates are passed to `func` as the type of their
+    /// `Value`s. The table itself is always indexed from `0`, so for a `Pair<Value<B>, ...>`
+    /// range, the entry for coordinate `c` is at index `c - B`.
+    ///
+    /// `func` may either be a `Value` metafunction, which is invoked with `Value<c>...` for the
+    /// coordinates `c...` of each entry, and must return a `MetaValue`; or a `constexpr`
+    /// callable, which is invoked directly with the coordinates.
+    ///
+    /// If `TElement` is not given and the entries are integers, the element type of the table
+    /// is the narrowest integer type able to hold every entry (unsigned, if no entry is
+    /// negative). Character entries are not integers for this purpose, and keep their type.
+    /// Otherwise, the element type is `TElement` if given, or the type of the entries if not.
+    ///
+    /// # Requirements
+    /// - `TFunction` must be default constructible (e.g. a lambda with no captures), and
+    /// invocable in constant evaluation as described above
+    /// - Each of `ranges` must be a `Value` or `Pair` of `Value`s of integral type,
+    /// describing a non-empty range
+    /// - If `TElement` is given, every entry must convert to it without changing its value
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// // `lut<u8, 16, 16>`
+    /// static constexpr auto products = make_lut([](usize row, usize column) {
+    ///     return row * column;
+    /// }, 16_value, 16_value);
+    /// static_assert(products[3][5] == 15);
+    ///
+    /// // `lut<i8, 9>`
+    /// static constexpr auto negated = make_lut([](MetaValue auto value) {
+    ///     return -value;
+    /// }, Pair<Value<-4>, Value<5>>{});
+    /// static_assert(negated[0] == 4);
+    /// @endcode
+    ///
+    /// @tparam TElement The element type of the table, if not the narrowest suitable type
+    /// @tparam TFunction The type of the function generating the entries of the table
+    /// @tparam TRanges The types of the ranges of coordinates of each dimension
+    /// @param func The function generating the entries of the table
+    /// @param ranges The ranges of coordinates of each dimension
+    /// @return The generated table
+    /// @ingroup lut
+    /// @headerfile hyperion/mpl/lut.h
+    template<typename TElement = detail::narrowest_element, typename TFunction, typename... TRanges>
+        requires(sizeof...(TRanges) != 0) && (detail::valid_lut_range<TRanges> && ...)
+                && detail::lut_function<std::remove_cvref_t<TFunction>, TRanges...>
+                && detail::lut_element_fits<TElement, std::remove_cvref_t<TFunction>, TRanges...>
+    [[nodiscard]] constexpr auto make_lut([[maybe_unused]] TFunction&& func, // NOLINT
+                                          [[maybe_unused]] TRanges... ranges) noexcept {
+        using function = std::remove_cvref_t<TFunction>;
+        constexpr auto entries = detail::lut_entries<function, TRanges...>();
+        using element = typename decltype(detail::lut_element_type<TElement, entries>())::type;
+        using table = lut<element, detail::lut_extent<TRanges>...>;
+
+        auto array = typename table::array_type{};
+        detail::fill_nested<element>(array, entries, 0_usize);
+        return table{array};
+    }
+
+    namespace _test::lut {
+        static inline constexpr auto square = [](usize value) noexcept {
+            return value * value;
+        };
+        static inline constexpr auto negate = [](MetaValue auto value) noexcept {
+            return Value<-decltype(value)::value>{};
+        };
+        static inline constexpr auto multiply = [](usize lhs, usize rhs) noexcept {
+            return lhs * rhs;
+        };
+        static inline constexpr auto half = [](int value) noexcept {
+            return static_cast<double>(value) / 2.0;
+        };
+        static inline constexpr auto letter = [](usize index) noexcept {
+            return static_cast<char>('a' + static_cast<char>(index));
+        };
+        static inline constexpr auto with_square = [](usize index) noexcept {
+            return std::array<usize, 2>{index, index * index};
+        };
+        static inline constexpr auto digits = [](usize first, usize second, usize third) noexcept {
+            return first * 100_usize + second * 10_usize + third;
+        };
+
+        static constexpr auto squares = make_lut(square, Value<16_usize>{});
+        static constexpr auto large_squares = make_lut(square, Value<300_usize>{});
+        static constexpr auto negated = make_lut(negate, Pair<Value<-4>, Value<5>>{});
+        static constexpr auto products = make_lut(multiply, Value<16_usize>{}, Value<300_usize>{});
+        static constexpr auto halves = make_lut(half, Value<4>{});
+        static constexpr auto wide_squares = make_lut<u64>(square, Value<16_usize>{});
+        static constexpr auto letters = make_lut(letter, Value<26_usize>{});
+        static constexpr auto with_squares = make_lut(with_square, Value<4_usize>{});
+        static constexpr auto cubes
+            = make_lut(digits, Value<4_usize>{}, Value<2_usize>{}, Value<3_usize>{});
+
+        template<typename TElement, typename TFunction, typename... TRanges>
+        concept can_make_lut = requires {
+            make_lut<TElement>(TFunction{}, TRanges{}...);
+        };
+
+        static_assert(std::same_as<decltype(squares)::value_type, u8>,
+                      "hyperion::mpl::make_lut test case 1 (failing)");
+        static_assert(squares[15] == 225, "hyperion::mpl::make_lut test case 2 (failing)");
+        static_assert(std::same_as<decltype(large_squares)::value_type, u32>,
+                      "hyperion::mpl::make_lut test case 3 (failing)");
+        static_assert(large_squares[299] == 89401,
+                      "hyperion::mpl::make_lut test case 4 (failing)");
+        static_assert(std::same_as<decltype(negated)::value_type, i8>,
+                      "hyperion::mpl::make_lut test case 5 (failing)");
+        static_assert(negated[0] == 4 && negated[8] == -4,
+                      "hyperion::mpl::make_lut test case 6 (failing)");
+        static_assert(std::same_as<decltype(products)::value_type, u16>,
+                      "hyperion::mpl::make_lut test case 7 (failing)");
+        static_assert(decltype(products)::rank() == 2 && decltype(products)::size() == 16,
+                      "hyperion::mpl::make_lut test case 8 (failing)");
+        static_assert(products[15][299] == 4485, "hyperion::mpl::make_lut test case 9 (failing)");
+        static_assert(std::same_as<decltype(halves)::value_type, double>,
+                      "hyperion::mpl::make_lut test case 10 (failing)");
+        static_assert(halves[3] == 1.5, "hyperion::mpl::make_lut test case 11 (failing)");
+        static_assert(std::same_as<decltype(wide_squares)::value_type, u64>,
+                      "hyperion::mpl::make_lut test case 12 (failing)");
+        static_assert(std::same_as<decltype(letters)::value_type, char>,
+                      "hyperion::mpl::make_lut test case 13 (failing)");
+        static_assert(letters[25] == 'z', "hyperion::mpl::make_lut test case 14 (failing)");
+        static_assert(not can_make_lut<u8, decltype(square), Value<300_usize>>,
+                      "hyperion::mpl::make_lut test case 15 (failing)");
+        static_assert(not can_make_lut<u8, decltype(negate), Pair<Value<-4>, Value<5>>>,
+                      "hyperion::mpl::make_lut test case 16 (failing)");
+        static_assert(not can_make_lut<int, decltype(half), Value<4>>,
+                      "hyperion::mpl::make_lut test case 17 (failing)");
+        static_assert(can_make_lut<int, decltype(half), Pair<Value<0>, Value<1>>>,
+                      "hyperion::mpl::make_lut test case 18 (failing)");
+        static_assert(std::same_as<decltype(cubes)::array_type,
+                                   std::array<std::array<std::array<u16, 3>, 2>, 4>>,
+                      "hyperion::mpl::make_lut test case 19 (failing)");
+        static_assert(cubes[3][1][2] == 3 * 100 + 1 * 10 + 2,
+                      "hyperion::mpl::make_lut test case 20 (failing)");
+        static_assert(std::same_as<decltype(with_squares)::value_type, std::array<usize, 2>>,
+                      "hyperion::mpl::make_lut test case 21 (failing)");
+        static_assert(with_squares[3] == std::array<usize, 2>{3, 9},
+                      "hyperion::mpl::make_lut test case 22 (failing)");
+        static_assert(alignof(decltype(squares)) == hardware_constructive_interference_size,
+                      "hyperion::mpl::lut layout test case 1 (failing)");
+    } // namespace _test::lut
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_LUT_H
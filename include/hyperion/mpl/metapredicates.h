@@ -1615,6 +1615,140 @@ namespace hyperion::mpl {
             return decltype_(element).is_noexcept_swappable_with(decltype_(decltype(type){}));
         };
     }
+
+    /// @brief Metaprogramming predicate object used to query whether a
+    /// `MetaType` argument represents a type that is trivially copyable.
+    ///
+    /// Determines whether the represented type is trivially copyable
+    /// as if by `decltype_(type).is_trivially_copyable()`.
+    ///
+    /// # Requirements
+    /// - `type` must be an instance of a `MetaType`
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// struct example_t {
+    ///     int value;
+    /// };
+    /// struct example2_t {
+    ///     example2_t(const example2_t&);
+    /// };
+    /// constexpr auto example1 = decltype_<example_t>{};
+    /// constexpr auto example2 = decltype_<example2_t>{};
+    ///
+    /// static_assert(example1.satisfies(trivially_copyable));
+    /// static_assert(not example2.satisfies(trivially_copyable));
+    /// @endcode
+    ///
+    /// @param type The `MetaType` representing the type to check
+    /// @return whether the type represented by `type` is trivially copyable
+    /// @ingroup metapredicates
+    /// @headerfile hyperion/mpl/metapredicates.h
+    constexpr auto trivially_copyable = [](MetaType auto type) noexcept {
+        return decltype_(type).is_trivially_copyable();
+    };
+
+    /// @brief Metaprogramming predicate object used to query whether a
+    /// `MetaType` argument represents a type that is a standard-layout type.
+    ///
+    /// Determines whether the represented type is a standard-layout type
+    /// as if by `decltype_(type).is_standard_layout()`.
+    ///
+    /// # Requirements
+    /// - `type` must be an instance of a `MetaType`
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// struct example_t {
+    ///     int first;
+    ///     int second;
+    /// };
+    /// struct example2_t {
+    ///     int first;
+    ///   private:
+    ///     int second;
+    /// };
+    /// constexpr auto example1 = decltype_<example_t>{};
+    /// constexpr auto example2 = decltype_<example2_t>{};
+    ///
+    /// static_assert(example1.satisfies(standard_layout));
+    /// static_assert(not example2.satisfies(standard_layout));
+    /// @endcode
+    ///
+    /// @param type The `MetaType` representing the type to check
+    /// @return whether the type represented by `type` is a standard-layout type
+    /// @ingroup metapredicates
+    /// @headerfile hyperion/mpl/metapredicates.h
+    constexpr auto standard_layout = [](MetaType auto type) noexcept {
+        return decltype_(type).is_standard_layout();
+    };
+
+    /// @brief Metaprogramming predicate object used to query whether a
+    /// `MetaType` argument represents a type that has unique object representations.
+    ///
+    /// Determines whether the represented type has unique object representations
+    /// as if by `decltype_(type).has_unique_object_representations()`.
+    ///
+    /// # Requirements
+    /// - `type` must be an instance of a `MetaType`
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// struct example_t {
+    ///     u32 first;
+    ///     u32 second;
+    /// };
+    /// struct example2_t {
+    ///     u8 first;
+    ///     u32 second;
+    /// };
+    /// constexpr auto example1 = decltype_<example_t>{};
+    /// constexpr auto example2 = decltype_<example2_t>{};
+    ///
+    /// static_assert(example1.satisfies(unique_object_representations));
+    /// static_assert(not example2.satisfies(unique_object_representations));
+    /// @endcode
+    ///
+    /// @param type The `MetaType` representing the type to check
+    /// @return whether the type represented by `type` has unique object representations
+    /// @ingroup metapredicates
+    /// @headerfile hyperion/mpl/metapredicates.h
+    constexpr auto unique_object_representations = [](MetaType auto type) noexcept {
+        return decltype_(type).has_unique_object_representations();
+    };
+
+    /// @brief Metaprogramming predicate object used to query whether a
+    /// `MetaType` argument represents a type that is an implicit-lifetime type.
+    ///
+    /// Determines whether the represented type is an implicit-lifetime type
+    /// as if by `decltype_(type).is_implicit_lifetime()`.
+    ///
+    /// # Requirements
+    /// - `type` must be an instance of a `MetaType`
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// struct example_t {
+    ///     int value;
+    /// };
+    /// struct example2_t {
+    ///     example2_t();
+    ///     ~example2_t();
+    /// };
+    /// constexpr auto example1 = decltype_<example_t>{};
+    /// constexpr auto example2 = decltype_<example2_t>{};
+    ///
+    /// static_assert(example1.satisfies(implicit_lifetime));
+    /// static_assert(not example2.satisfies(implicit_lifetime));
+    /// @endcode
+    ///
+    /// @param type The `MetaType` representing the type to check
+    /// @return whether the type represented by `type` is an implicit-lifetime type
+    /// @ingroup metapredicates
+    /// @headerfile hyperion/mpl/metapredicates.h
+    constexpr auto implicit_lifetime = [](MetaType auto type) noexcept {
+        return decltype_(type).is_implicit_lifetime();
+    };
 } // namespace hyperion::mpl
 
     // NOLINTNEXTLINE(misc-header-include-cycle)
@@ -2232,6 +2366,44 @@ namespace hyperion::mpl::_test::metapredicates {
     static_assert(
         not decltype_<not_swappable>().satisfies(mpl::noexcept_swappable_with(decltype_<int>())),
         "hyperion::mpl::noexcept_swappable_with predicate test case 7 (failing)");
+
+    struct packed {
+        u32 first;
+        u32 second;
+    };
+
+    struct padded {
+        u8 first;
+        u32 second;
+    };
+
+    class not_standard_layout {
+      public:
+        int first;
+
+      private:
+        [[maybe_unused]] int second;
+    };
+
+    static_assert(decltype_<packed>().satisfies(mpl::trivially_copyable),
+                  "hyperion::mpl::trivially_copyable predicate test case 1 (failing)");
+    static_assert(not decltype_<destructible>().satisfies(mpl::trivially_copyable),
+                  "hyperion::mpl::trivially_copyable predicate test case 2 (failing)");
+
+    static_assert(decltype_<packed>().satisfies(mpl::standard_layout),
+                  "hyperion::mpl::standard_layout predicate test case 1 (failing)");
+    static_assert(not decltype_<not_standard_layout>().satisfies(mpl::standard_layout),
+                  "hyperion::mpl::standard_layout predicate test case 2 (failing)");
+
+    static_assert(decltype_<packed>().satisfies(mpl::unique_object_representations),
+                  "hyperion::mpl::unique_object_representations predicate test case 1 (failing)");
+    static_assert(not decltype_<padded>().satisfies(mpl::unique_object_representations),
+                  "hyperion::mpl::unique_object_representations predicate test case 2 (failing)");
+
+    static_assert(decltype_<padded>().satisfies(mpl::implicit_lifetime),
+                  "hyperion::mpl::implicit_lifetime predicate test case 1 (failing)");
+    static_assert(not decltype_<destructible>().satisfies(mpl::implicit_lifetime),
+                  "hyperion::mpl::implicit_lifetime predicate test case 2 (failing)");
 } // namespace hyperion::mpl::_test::metapredicates
 
 #endif // HYPERION_MPL_METAPREDICATES_H
@@ -0,0 +1,397 @@
+/// @file mpsc_queue.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Bounded, lock-free multi-producer single-consumer queue of heterogeneous messages
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/concurrent_layout.h>
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/static_vector.h>
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup mpsc_queue Multi-Producer Single-Consumer Queue
+/// Hyperion provides `mpl::mpsc_queue` as a bounded, lock-free queue for passing messages of
+/// any of the types in an `mpl::List` from any number of producer threads to exactly one
+/// consumer thread, without a `std::variant` or any locks.
+///
+/// Each slot of the queue is sized and aligned for the largest message type, and stores the
+/// message in place alongside a compact type tag. The consumer drains messages in batches,
+/// dispatching each to a handler through a jump table generated from the `List`.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/mpsc_queue.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// struct start { u32 id; };
+/// struct stop { u32 id; };
+///
+/// auto queue = mpsc_queue<List<start, stop>, 1024>{};
+/// // on any producer thread
+/// if(not queue.try_emplace<start>(1_u32) || not queue.try_push(stop{1_u32})) {
+///     // the queue was full
+///     report_dropped_message();
+/// }
+/// // on the consumer thread
+/// auto handled = queue.drain([](auto&& message) { handle(message); });
+/// @endcode
+/// @headerfile hyperion/mpl/mpsc_queue.h
+/// @}
+
+#ifndef HYPERION_MPL_MPSC_QUEUE_H
+    #define HYPERION_MPL_MPSC_QUEUE_H
+
+namespace hyperion::mpl {
+
+    /// @brief `mpsc_queue` is a bounded, lock-free, multi-producer single-consumer queue of
+    /// messages of any of the types in `TMessages`.
+    ///
+    /// Any number of threads may call the producer-side member functions (`try_emplace`,
+    /// `try_push`) concurrently, but at most one thread at a time may call the consumer-side
+    /// member function (`drain`). Each slot stores its message in place, in storage sized
+    /// and aligned for the largest type in `TMessages`, along with the smallest unsigned tag
+    /// able to identify each type. Producers claim slots with a single compare-and-swap on the
+    /// shared tail index, and publish them with a per-slot sequence number, so neither side
+    /// ever blocks the other. The producer and consumer indices live on separate cache lines.
+    ///
+    /// `drain` dispatches each message through a jump table generated for the handler type,
+    /// and destroys each message after handling it. Destruction is skipped entirely for
+    /// trivially destructible message types.
+    ///
+    /// # Requirements
+    /// - `TMessages` must be a non-empty `mpl::List` of distinct, non-`const` object types
+    /// - `TCapacity` must be a non-zero power of two
+    /// - Messages can only be pushed from arguments they are `noexcept` constructible from
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// auto queue = mpsc_queue<List<int, std::string>, 64>{};
+    /// // messages must be constructed without throwing, so rather than constructing the
+    /// // `std::string` in place from `"hello"`, construct it up front and move it in
+    /// const auto pushed = queue.try_emplace<int>(1) && queue.try_push(std::string{"hello"});
+    /// // `pushed` is `true`
+    ///
+    /// auto total_size = 0_usize;
+    /// // `handled` is `2`, and `total_size` is `6`
+    /// auto handled = queue.drain([&total_size](auto&& message) {
+    ///     if constexpr(std::same_as<std::remove_cvref_t<decltype(message)>, int>) {
+    ///         ++total_size;
+    ///     }
+    ///     else {
+    ///         total_size += message.size();
+    ///     }
+    /// });
+    /// @endcode
+    ///
+    /// @tparam TMessages The `List` of message types
+    /// @tparam TCapacity The maximum number of messages the queue can hold at once
+    /// @ingroup mpsc_queue
+    /// @headerfile hyperion/mpl/mpsc_queue.h
+    template<typename TMessages, usize TCapacity>
+    class mpsc_queue;
+
+    template<typename... TMessages, usize TCapacity>
+        requires(sizeof...(TMessages) != 0)
+                && (TCapacity != 0 && (TCapacity & (TCapacity - 1)) == 0)
+                && (std::is_object_v<TMessages> && ...) && (!std::is_const_v<TMessages> && ...)
+                && detail::unique_types<TMessages...>
+    class mpsc_queue<List<TMessages...>, TCapacity> {
+      public:
+        /// @brief The type of the tags identifying the type of each message
+        using tag_type = detail::smallest_unsigned_t<sizeof...(TMessages) - 1_usize>;
+
+        /// @brief Returns the maximum number of messages this queue can hold at once
+        /// @return the capacity of this queue
+        [[nodiscard]] static constexpr auto capacity() noexcept -> usize {
+            return TCapacity;
+        }
+
+        /// @brief Returns the size of the storage for a message in each slot
+        /// @return the largest `sizeof` of the message types
+        [[nodiscard]] static constexpr auto message_size() noexcept -> usize {
+            return storage_size;
+        }
+
+        /// @brief Returns the alignment of the storage for a message in each slot
+        /// @return the largest `alignof` of the message types
+        [[nodiscard]] static constexpr auto message_alignment() noexcept -> usize {
+            return storage_alignment;
+        }
+
+        /// @brief Returns the tag identifying `TMessage`
+        /// @return the tag identifying `TMessage`
+        template<typename TMessage>
+            requires(detail::count_of_type<TMessage, TMessages...> == 1_usize)
+        [[nodiscard]] static constexpr auto tag_of() noexcept -> tag_type {
+            return static_cast<tag_type>(detail::index_of_type<TMessage, TMessages...>);
+        }
+
+        mpsc_queue() noexcept {
+            for(auto index = 0_usize; index < TCapacity; ++index) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                m_slots[index].sequence.store(index, std::memory_order_relaxed);
+            }
+        }
+
+        mpsc_queue(const mpsc_queue&) = delete;
+        mpsc_queue(mpsc_queue&&) = delete;
+
+        /// @brief Destroys any messages remaining in the queue
+        ~mpsc_queue() noexcept {
+            if constexpr(!(std::is_trivially_destructible_v<TMessages> && ...)) {
+                while(drain([]([[maybe_unused]] auto&& message) noexcept {}) != 0_usize) {
+                }
+            }
+        }
+
+        auto operator=(const mpsc_queue&) -> mpsc_queue& = delete;
+        auto operator=(mpsc_queue&&) -> mpsc_queue& = delete;
+
+        /// @brief Attempts to construct a `TMessage` in place at the back of the queue from
+        /// `args`.
+        ///
+        /// May be called from any number of threads concurrently.
+        ///
+        /// @param args The arguments to construct the message from
+        /// @return whether the message was pushed. `false` if the queue was full
+        template<typename TMessage, typename... TArgs>
+            requires(detail::count_of_type<TMessage, TMessages...> == 1_usize)
+                    && std::is_nothrow_constructible_v<TMessage, TArgs&&...>
+        [[nodiscard]] auto try_emplace(TArgs&&... args) noexcept -> bool {
+            auto position = m_producer.load(std::memory_order_relaxed);
+            while(true) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                auto& current = m_slots[position & mask];
+                const auto sequence = current.sequence.load(std::memory_order_acquire);
+                const auto difference
+                    = static_cast<isize>(sequence) - static_cast<isize>(position);
+
+                if(difference == 0) {
+                    if(m_producer.compare_exchange_weak(position,
+                                                        position + 1_usize,
+                                                        std::memory_order_relaxed))
+                    {
+                        // NOLINTNEXTLINE(*-reinterpret-cast)
+                        std::construct_at(reinterpret_cast<TMessage*>(current.storage.data()),
+                                          std::forward<TArgs>(args)...);
+                        current.tag = tag_of<TMessage>();
+                        current.sequence.store(position + 1_usize, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if(difference < 0) {
+                    return false;
+                }
+                else {
+                    position = m_producer.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /// @brief Attempts to push `message` to the back of the queue.
+        ///
+        /// May be called from any number of threads concurrently.
+        ///
+        /// @param message The message to push
+        /// @return whether `message` was pushed. `false` if the queue was full
+        template<typename TMessage>
+            requires(detail::count_of_type<std::remove_cvref_t<TMessage>, TMessages...>
+                     == 1_usize)
+                    && std::is_nothrow_constructible_v<std::remove_cvref_t<TMessage>, TMessage&&>
+        [[nodiscard]] auto try_push(TMessage&& message) noexcept -> bool {
+            return try_emplace<std::remove_cvref_t<TMessage>>(std::forward<TMessage>(message));
+        }
+
+        /// @brief Pops up to `max_count` messages from the front of the queue, in order,
+        /// invoking `handler` with each as an rvalue.
+        ///
+        /// May only be called from the consumer thread.
+        /// Each message is dispatched to the `handler` overload for its type through a jump
+        /// table, then destroyed, and its slot released back to the producers. If `handler`
+        /// throws, the message being handled is still destroyed and released.
+        ///
+        /// @param handler The handler to invoke with each message
+        /// @param max_count The maximum number of messages to pop
+        /// @return The number of messages popped
+        template<typename THandler>
+            requires(std::invocable<THandler&, TMessages &&> && ...)
+        auto drain(THandler&& handler, usize max_count = TCapacity) noexcept(
+            (std::is_nothrow_invocable_v<THandler&, TMessages&&> && ...)) -> usize {
+            auto head = m_consumer.load(std::memory_order_relaxed);
+            auto count = 0_usize;
+            for(; count < max_count; ++count) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                auto& current = m_slots[head & mask];
+                if(current.sequence.load(std::memory_order_acquire) != head + 1_usize) {
+                    break;
+                }
+
+                const auto guard = release_guard{current, head + TCapacity};
+                ++head;
+                m_consumer.store(head, std::memory_order_relaxed);
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                dispatch_table<std::remove_reference_t<THandler>>[current.tag](
+                    current.storage.data(),
+                    handler);
+            }
+            return count;
+        }
+
+        /// @brief Returns the number of messages in the queue at the time of the call.
+        ///
+        /// The result is only a snapshot, and may be stale by the time it is observed
+        /// if either side of the queue is concurrently active.
+        ///
+        /// @return the approximate number of messages in the queue
+        [[nodiscard]] auto size_approx() const noexcept -> usize {
+            const auto head = m_consumer.load(std::memory_order_acquire);
+            const auto tail = m_producer.load(std::memory_order_acquire);
+            return tail > head ? tail - head : 0_usize;
+        }
+
+      private:
+        static inline constexpr auto mask = TCapacity - 1_usize;
+        static inline constexpr auto storage_size
+            = decltype(List<TMessages...>{}.max_sizeof())::value;
+        static inline constexpr auto storage_alignment
+            = decltype(List<TMessages...>{}.max_alignof())::value;
+
+        struct slot {
+            std::atomic<usize> sequence = 0_usize;
+            tag_type tag = 0;
+            alignas(storage_alignment) std::array<std::byte, storage_size> storage;
+        };
+
+        /// @brief Releases a slot back to the producers when it goes out of scope
+        struct release_guard {
+            slot& current;
+            usize next_sequence;
+
+            release_guard(slot& released, usize sequence) noexcept
+                : current{released}, next_sequence{sequence} {
+            }
+            release_guard(const release_guard&) = delete;
+            release_guard(release_guard&&) = delete;
+            auto operator=(const release_guard&) -> release_guard& = delete;
+            auto operator=(release_guard&&) -> release_guard& = delete;
+
+            ~release_guard() noexcept {
+                current.sequence.store(next_sequence, std::memory_order_release);
+            }
+        };
+
+        /// @brief Invokes `handler` with the `TMessage` stored in `storage`, then destroys it
+        template<typename TMessage, typename THandler>
+        static auto dispatch(std::byte* storage, THandler& handler) noexcept(
+            std::is_nothrow_invocable_v<THandler&, TMessage&&>) -> void {
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            auto* message = std::launder(reinterpret_cast<TMessage*>(storage));
+            if constexpr(std::is_trivially_destructible_v<TMessage>) {
+                std::invoke(handler, std::move(*message));
+            }
+            else {
+                struct destroy_guard {
+                    TMessage* message;
+
+                    explicit destroy_guard(TMessage* destroyed) noexcept : message{destroyed} {
+                    }
+                    destroy_guard(const destroy_guard&) = delete;
+                    destroy_guard(destroy_guard&&) = delete;
+                    auto operator=(const destroy_guard&) -> destroy_guard& = delete;
+                    auto operator=(destroy_guard&&) -> destroy_guard& = delete;
+
+                    ~destroy_guard() noexcept {
+                        std::destroy_at(message);
+                    }
+                };
+
+                const auto guard = destroy_guard{message};
+                std::invoke(handler, std::move(*message));
+            }
+        }
+
+        template<typename THandler>
+        using dispatcher = void (*)(std::byte*, THandler&);
+
+        template<typename THandler>
+        static inline constexpr auto dispatch_table
+            = std::array<dispatcher<THandler>, sizeof...(TMessages)>{
+                &dispatch<TMessages, THandler>...};
+
+        alignas(hardware_destructive_interference_size) std::atomic<usize> m_producer = 0_usize;
+        alignas(hardware_destructive_interference_size) std::atomic<usize> m_consumer = 0_usize;
+        alignas(hardware_destructive_interference_size) std::array<slot, TCapacity> m_slots;
+    };
+
+    namespace _test::mpsc_queue {
+        using messages = mpl::mpsc_queue<List<u8, u64, std::array<u32, 3>>, 8>;
+
+        static_assert(messages::capacity() == 8_usize,
+                      "hyperion::mpl::mpsc_queue test case 1 (failing)");
+        static_assert(messages::message_size() == 12_usize,
+                      "hyperion::mpl::mpsc_queue test case 2 (failing)");
+        static_assert(messages::message_alignment() == alignof(u64),
+                      "hyperion::mpl::mpsc_queue test case 3 (failing)");
+        static_assert(std::same_as<messages::tag_type, u8>,
+                      "hyperion::mpl::mpsc_queue test case 4 (failing)");
+        static_assert(messages::tag_of<std::array<u32, 3>>() == 2,
+                      "hyperion::mpl::mpsc_queue test case 5 (failing)");
+
+        template<typename TMessages, usize TCapacity>
+        concept valid_queue = requires { mpl::mpsc_queue<TMessages, TCapacity>::capacity(); };
+
+        template<typename TMessage>
+        concept can_push = requires(messages& queue, TMessage&& message) {
+            queue.try_push(std::forward<TMessage>(message));
+        };
+
+        static_assert(valid_queue<List<int>, 2>,
+                      "hyperion::mpl::mpsc_queue requirements test case 1 (failing)");
+        static_assert(not valid_queue<List<int>, 6>,
+                      "hyperion::mpl::mpsc_queue requirements test case 2 (failing)");
+        static_assert(not valid_queue<List<int, int>, 2>,
+                      "hyperion::mpl::mpsc_queue requirements test case 3 (failing)");
+        static_assert(not valid_queue<List<>, 2>,
+                      "hyperion::mpl::mpsc_queue requirements test case 4 (failing)");
+        static_assert(can_push<const u64&> && not can_push<i32>,
+                      "hyperion::mpl::mpsc_queue requirements test case 5 (failing)");
+    } // namespace _test::mpsc_queue
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_MPSC_QUEUE_H
@@ -0,0 +1,600 @@
+/// @file options.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Allocation-free command line and configuration parser generated from option descriptors
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/detail/perfect_hash.h>
+#include <hyperion/mpl/fixed_string.h>
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/metatypes.h>
+#include <hyperion/mpl/record.h>
+#include <hyperion/mpl/type.h>
+#include <hyperion/mpl/value.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup options Option Parsing
+/// Hyperion provides `mpl::options` for parsing command line arguments and `key=value`
+/// configuration text into a struct generated from an `mpl::List` of `mpl::option`
+/// descriptors.
+///
+/// Option names are looked up in a perfect hash table built at compile time, values are
+/// parsed with `std::from_chars` (or the equivalent for `bool`s and strings), and no heap
+/// memory is allocated at any point.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/options.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// using cli = options<List<option<Value<fixed_string{"threads"}>, Type<u32>, Value<4_u32>>,
+///                          option<Value<fixed_string{"verbose"}>, Type<bool>, Value<false>>,
+///                          option<Value<fixed_string{"output"}>,
+///                                 Type<std::string_view>,
+///                                 Value<fixed_string{"out.bin"}>>>>;
+///
+/// auto main(int argc, char** argv) -> int {
+///     // e.g. `tool --threads 8 --verbose --output=result.bin`
+///     auto config = cli{};
+///     if(const auto result = config.parse(argc, argv); not result) {
+///         return 1;
+///     }
+///     run(config.get<"threads">(), config.get<"output">());
+/// }
+/// @endcode
+/// @headerfile hyperion/mpl/options.h
+/// @}
+
+#ifndef HYPERION_MPL_OPTIONS_H
+    #define HYPERION_MPL_OPTIONS_H
+
+namespace hyperion::mpl {
+
+    namespace detail {
+        /// @brief Whether option values of type `TType` can be parsed with `std::from_chars`.
+        /// Excludes the character types, such as `char16_t`, which are integral but have no
+        /// `std::from_chars` overload
+        template<typename TType>
+        concept option_number = (std::integral<TType> || std::floating_point<TType>)
+                                && requires(const char* chars, TType& value) {
+                                       std::from_chars(chars, chars, value);
+                                   };
+
+        /// @brief Whether option values of type `TType` can be parsed
+        template<typename TType>
+        concept option_value = std::same_as<TType, bool> || option_number<TType>
+                               || std::same_as<TType, std::string_view>
+                               || is_fixed_string<TType>::value;
+
+        /// @brief Whether `TName` is a `Value` holding a `fixed_string`
+        template<typename TName>
+        concept option_name
+            = MetaValue<TName>
+              && is_fixed_string<std::remove_cvref_t<decltype(TName::value)>>::value;
+
+        /// @brief Returns whether `value` converts to `TType` without changing its value or
+        /// sign. Floating point values never fit integral types, and conversions between
+        /// non-arithmetic types are only required to be valid
+        template<typename TType, typename TValue>
+        [[nodiscard]] constexpr auto option_default_fits(const TValue& value) noexcept -> bool {
+            if constexpr(std::is_arithmetic_v<TType> && std::is_arithmetic_v<TValue>) {
+                if constexpr(std::integral<TType> && std::floating_point<TValue>) {
+                    return false;
+                }
+                else {
+                    const auto converted = static_cast<TType>(value);
+                    return static_cast<TValue>(converted) == value
+                           && (value < TValue{}) == (converted < TType{});
+                }
+            }
+            else {
+                return true;
+            }
+        }
+
+        /// @brief Whether `TDefault` is a `Value` whose value can initialize a `TType` without
+        /// changing, either directly or (for strings) as a `std::string_view`
+        template<typename TDefault, typename TType>
+        concept option_default
+            = MetaValue<TDefault>
+              && ((std::constructible_from<TType, decltype(TDefault::value)>
+                   && option_default_fits<TType>(TDefault::value))
+                  || requires { TType{TDefault::value.view()}; });
+
+        template<typename TType, typename TDefault>
+        [[nodiscard]] constexpr auto make_option_default() noexcept -> TType {
+            if constexpr(std::constructible_from<TType, decltype(TDefault::value)>) {
+                return TType{TDefault::value};
+            }
+            else {
+                return TType{TDefault::value.view()};
+            }
+        }
+    } // namespace detail
+
+    /// @brief `option` describes a single option parsed by `mpl::options`.
+    ///
+    /// # Requirements
+    /// - `TName` must be a `Value` holding a `fixed_string`. It must be non-empty and must
+    /// not contain `'='` or whitespace
+    /// - `TType` must be (or be a `MetaType` representing) `bool`, an integral or floating
+    /// point type that `std::from_chars` can parse, `std::string_view`, or a `fixed_string`
+    /// - `TDefault` must be a `Value` whose value can initialize a `TType` without changing
+    /// its value or sign (string options may also use a `Value` holding a `fixed_string`)
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// using threads = option<Value<fixed_string{"threads"}>, Type<u32>, Value<4_u32>>;
+    /// static_assert(threads::name == "threads");
+    /// static_assert(threads::default_value == 4_u32);
+    /// @endcode
+    ///
+    /// @tparam TName The name of the option
+    /// @tparam TType The type of the option's value
+    /// @tparam TDefault The value of the option when it is not given
+    /// @ingroup options
+    /// @headerfile hyperion/mpl/options.h
+    template<typename TName, typename TType, typename TDefault>
+        requires detail::option_name<TName>
+                 && detail::option_value<detail::convert_to_raw_t<TType>>
+                 && detail::option_default<TDefault, detail::convert_to_raw_t<TType>>
+    struct option {
+        /// @brief The type of the option's value
+        using type = detail::convert_to_raw_t<TType>;
+
+        /// @brief The name of the option
+        static inline constexpr auto name = TName::value.view();
+
+        /// @brief The value of the option when it is not given
+        static inline constexpr auto default_value
+            = detail::make_option_default<type, TDefault>();
+    };
+
+    /// @brief The errors that can occur when parsing options
+    /// @ingroup options
+    /// @headerfile hyperion/mpl/options.h
+    enum class option_errc : u8 {
+        /// @brief Parsing succeeded
+        none,
+        /// @brief An option's name is not the name of any of the options
+        unknown_option,
+        /// @brief A non-`bool` option was given without a value
+        missing_value,
+        /// @brief An option's value could not be parsed as the option's type
+        invalid_value,
+    };
+
+    /// @brief The result of parsing options with `mpl::options`
+    /// @ingroup options
+    /// @headerfile hyperion/mpl/options.h
+    struct option_result {
+        /// @brief The error that stopped parsing, if any
+        option_errc error = option_errc::none;
+        /// @brief The argument, or configuration line, that caused `error`
+        std::string_view token = {};
+        /// @brief Where parsing stopped: the index of the first argument that was not
+        /// consumed, or the offset of the first configuration line that was not consumed
+        usize next = 0_usize;
+
+        /// @brief Returns whether parsing succeeded
+        [[nodiscard]] constexpr explicit operator bool() const noexcept {
+            return error == option_errc::none;
+        }
+    };
+
+    namespace detail {
+        /// @brief Returns whether `names` are valid, distinct option names
+        template<usize TSize>
+        [[nodiscard]] constexpr auto
+        valid_option_names(std::array<std::string_view, TSize> names) noexcept -> bool {
+            for(const auto name : names) {
+                if(name.empty()
+                   || std::any_of(name.begin(), name.end(), [](char character) {
+                          return character == '=' || character == ' ' || character == '\t'
+                                 || character == '\r' || character == '\n';
+                      }))
+                {
+                    return false;
+                }
+            }
+            std::sort(names.begin(), names.end());
+            return std::adjacent_find(names.begin(), names.end()) == names.end();
+        }
+
+        [[nodiscard]] constexpr auto trim_option_text(std::string_view text) noexcept
+            -> std::string_view {
+            constexpr auto whitespace = std::string_view{" \t\r"};
+            const auto first = text.find_first_not_of(whitespace);
+            if(first == std::string_view::npos) {
+                return {};
+            }
+            return text.substr(first, text.find_last_not_of(whitespace) - first + 1_usize);
+        }
+
+        /// @brief Parses `text` as a value of type `TType` into `value`
+        /// @return whether `text` was a valid `TType`
+        template<typename TType>
+        [[nodiscard]] auto parse_option_value(std::string_view text, TType& value) noexcept
+            -> bool {
+            if constexpr(std::same_as<TType, bool>) {
+                if(text == "true" || text == "1" || text == "yes" || text == "on") {
+                    value = true;
+                    return true;
+                }
+                if(text == "false" || text == "0" || text == "no" || text == "off") {
+                    value = false;
+                    return true;
+                }
+                return false;
+            }
+            else if constexpr(std::same_as<TType, std::string_view>) {
+                value = text;
+                return true;
+            }
+            else if constexpr(is_fixed_string<TType>::value) {
+                if(text.size() > TType::size()) {
+                    return false;
+                }
+                value = TType{text};
+                return true;
+            }
+            else {
+                auto parsed = TType{};
+                const auto* const end = text.data() + text.size();
+                const auto [last, error] = std::from_chars(text.data(), end, parsed);
+                if(error != std::errc{} || last != end) {
+                    return false;
+                }
+                value = parsed;
+                return true;
+            }
+        }
+    } // namespace detail
+
+    /// @brief `options` is a struct holding one value for each of the `option`s in the `List`
+    /// `TOptions`, along with a parser for them.
+    ///
+    /// Each value is initialized to its option's default. The values can be set from command
+    /// line arguments with `parse(argc, argv)` and from `key=value` configuration text with
+    /// `parse_config`, and are accessed by name with `get<"name">()`.
+    ///
+    /// Option names are looked up in a perfect hash table built at compile time: a lookup
+    /// is two hashes of the name, and a single comparison against the only option it could
+    /// name. Values are parsed with `std::from_chars`. `std::string_view` options refer into
+    /// the parsed arguments or configuration text, so those must outlive the `options`;
+    /// all other values are copied. Parsing never allocates.
+    ///
+    /// # Requirements
+    /// - `TOptions` must be a non-empty `mpl::List` of `mpl::option`s
+    /// - The names of the options must be distinct
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// using settings = options<List<option<Value<fixed_string{"port"}>, Type<u16>, Value<80>>,
+    ///                               option<Value<fixed_string{"ratio"}>,
+    ///                                      Type<double>,
+    ///                                      Value<0.5>>>>;
+    ///
+    /// auto values = settings{};
+    /// const auto result = values.parse_config("# server settings\nport = 8080\n");
+    /// assert(result && values.get<"port">() == 8080 && values.get<"ratio">() == 0.5);
+    /// @endcode
+    ///
+    /// @tparam TOptions The `List` of `option`s
+    /// @ingroup options
+    /// @headerfile hyperion/mpl/options.h
+    template<typename TOptions>
+    class options;
+
+    template<typename... TOptions>
+        requires(sizeof...(TOptions) != 0)
+                && (requires {
+                       typename TOptions::type;
+                       TOptions::name;
+                       TOptions::default_value;
+                   } && ...)
+                && (detail::valid_option_names(
+                    std::array<std::string_view, sizeof...(TOptions)>{TOptions::name...}))
+    class options<List<TOptions...>> {
+      private:
+        static constexpr auto num_options = sizeof...(TOptions);
+        static constexpr auto names
+            = std::array<std::string_view, num_options>{TOptions::name...};
+        static constexpr auto table = detail::make_perfect_hash_table(names);
+
+        static_assert(table.found, "failed to build a perfect hash table of the option names");
+
+        template<fixed_string TName>
+        static constexpr auto index_of_name
+            = static_cast<usize>(std::find(names.begin(), names.end(), TName.view())
+                                 - names.begin());
+
+      public:
+        /// @brief The struct type holding the values of the options
+        using values_type = record<List<typename TOptions::type...>>;
+
+        /// @brief Initializes each option to its default value
+        constexpr options() noexcept : m_values(TOptions::default_value...) {
+        }
+
+        /// @brief Returns the number of options
+        /// @return the number of options
+        [[nodiscard]] static constexpr auto size() noexcept -> usize {
+            return num_options;
+        }
+
+        /// @brief Returns the index of the option named `name`, or `size()` if there is none
+        /// @param name The name of the option
+        /// @return the index of the option named `name`
+        [[nodiscard]] static constexpr auto index_of(std::string_view name) noexcept -> usize {
+            const auto index = table.find(name);
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            return index != num_options && names[index] == name ? index : num_options;
+        }
+
+        /// @brief Returns the value of the option named `TName`
+        /// @return a reference to the value of the option
+        template<fixed_string TName>
+            requires(index_of_name<TName> != num_options)
+        [[nodiscard]] constexpr auto get() noexcept -> decltype(auto) {
+            return m_values.template get<index_of_name<TName>>();
+        }
+
+        /// @brief Returns the value of the option named `TName`
+        /// @return a reference to the value of the option
+        template<fixed_string TName>
+            requires(index_of_name<TName> != num_options)
+        [[nodiscard]] constexpr auto get() const noexcept -> decltype(auto) {
+            return m_values.template get<index_of_name<TName>>();
+        }
+
+        /// @brief Returns the values of all of the options
+        /// @return the values of the options, in the order the options are listed
+        [[nodiscard]] constexpr auto values() const noexcept -> const values_type& {
+            return m_values;
+        }
+
+        /// @brief Sets the option named `name` to `value`, parsed as the option's type
+        /// @param name The name of the option
+        /// @param value The textual value of the option
+        /// @return `option_errc::unknown_option` if there is no option named `name`,
+        /// `option_errc::invalid_value` if `value` is not a valid value of the option's type,
+        /// and `option_errc::none` otherwise
+        auto set(std::string_view name, std::string_view value) noexcept -> option_errc {
+            const auto index = index_of(name);
+            if(index == num_options) {
+                return option_errc::unknown_option;
+            }
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            return setters[index](*this, value) ? option_errc::none : option_errc::invalid_value;
+        }
+
+        /// @brief Parses command line arguments.
+        ///
+        /// Options are given as `--name=value` or `--name value`. `bool` options can also be
+        /// given as just `--name`, which sets them to `true`. `bool` values are one of `true`,
+        /// `false`, `1`, `0`, `yes`, `no`, `on` or `off`.
+        ///
+        /// Parsing starts after the program name, and stops at the first argument that is not
+        /// an option, after an argument of just `--`, or at the first error.
+        ///
+        /// @param argc The number of arguments, including the program name
+        /// @param argv The arguments
+        /// @return The result of parsing. `next` is the index of the first argument that was
+        /// not consumed, i.e. of the first positional argument
+        auto parse(int argc, const char* const* argv) noexcept -> option_result {
+            const auto args = std::span<const char* const>{argv, static_cast<usize>(argc)};
+            auto index = 1_usize;
+            while(index < args.size()) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                const auto arg = std::string_view{args[index]};
+                if(arg == "--") {
+                    return {.next = index + 1_usize};
+                }
+                if(not arg.starts_with("--") || arg.size() == 2_usize) {
+                    break;
+                }
+
+                const auto body = arg.substr(2_usize);
+                const auto separator = body.find('=');
+                const auto name = body.substr(0_usize, separator);
+                const auto option = index_of(name);
+                auto value = std::string_view{};
+                if(separator != std::string_view::npos) {
+                    value = body.substr(separator + 1_usize);
+                }
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                else if(option != num_options && is_flag[option]) {
+                    value = "true";
+                }
+                else if(option != num_options) {
+                    if(index + 1_usize == args.size()) {
+                        return {option_errc::missing_value, arg, index};
+                    }
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    value = std::string_view{args[++index]};
+                }
+
+                if(const auto error = set(name, value); error != option_errc::none) {
+                    return {error, arg, index};
+                }
+                ++index;
+            }
+
+            return {.next = index};
+        }
+
+        /// @brief Parses `key=value` configuration text.
+        ///
+        /// Each line holds one `key=value` pair. Whitespace around keys and values, blank lines,
+        /// and lines starting with `#` are ignored. Parsing stops at the first error.
+        ///
+        /// @param text The configuration text
+        /// @return The result of parsing. `next` is the offset in `text` of the first line
+        /// that was not consumed
+        auto parse_config(std::string_view text) noexcept -> option_result {
+            auto offset = 0_usize;
+            while(offset < text.size()) {
+                const auto end = std::min(text.find('\n', offset), text.size());
+                const auto line = detail::trim_option_text(text.substr(offset, end - offset));
+
+                if(not line.empty() && not line.starts_with('#')) {
+                    const auto separator = line.find('=');
+                    if(separator == std::string_view::npos) {
+                        return {option_errc::missing_value, line, offset};
+                    }
+
+                    const auto error
+                        = set(detail::trim_option_text(line.substr(0_usize, separator)),
+                              detail::trim_option_text(line.substr(separator + 1_usize)));
+                    if(error != option_errc::none) {
+                        return {error, line, offset};
+                    }
+                }
+
+                offset = end + 1_usize;
+            }
+
+            return {.next = text.size()};
+        }
+
+      private:
+        values_type m_values;
+
+        template<usize TIndex>
+        static auto set_value(options& self, std::string_view value) noexcept -> bool {
+            return detail::parse_option_value(value, self.m_values.template get<TIndex>());
+        }
+
+        template<usize... TIndices>
+        static constexpr auto
+        make_setters([[maybe_unused]] std::index_sequence<TIndices...> indices) noexcept {
+            return std::array<bool (*)(options&, std::string_view) noexcept, num_options>{
+                &set_value<TIndices>...};
+        }
+
+        static constexpr auto setters = make_setters(std::make_index_sequence<num_options>{});
+        static constexpr auto is_flag = std::array<bool, num_options>{
+            std::same_as<typename TOptions::type, bool>...};
+    };
+
+    namespace _test::options {
+        using threads = option<Value<mpl::fixed_string{"threads"}>, Type<u32>, Value<4_u32>>;
+        using verbose = option<Value<mpl::fixed_string{"verbose"}>, Type<bool>, Value<false>>;
+        using ratio = option<Value<mpl::fixed_string{"ratio"}>, Type<double>, Value<0.5>>;
+        using output = option<Value<mpl::fixed_string{"output"}>,
+                              Type<std::string_view>,
+                              Value<mpl::fixed_string{"out.bin"}>>;
+        using label = option<Value<mpl::fixed_string{"label"}>,
+                             Type<mpl::fixed_string<8>>,
+                             Value<mpl::fixed_string{"none"}>>;
+
+        using cli = mpl::options<List<threads, verbose, ratio, output, label>>;
+
+        static_assert(threads::name == "threads" && threads::default_value == 4_u32,
+                      "hyperion::mpl::option test case 1 (failing)");
+        static_assert(output::default_value == "out.bin",
+                      "hyperion::mpl::option test case 2 (failing)");
+        static_assert(label::default_value.view() == "none",
+                      "hyperion::mpl::option test case 3 (failing)");
+
+        static_assert(cli::size() == 5_usize, "hyperion::mpl::options test case 1 (failing)");
+        static_assert(cli::index_of("threads") == 0_usize && cli::index_of("verbose") == 1_usize
+                          && cli::index_of("ratio") == 2_usize
+                          && cli::index_of("output") == 3_usize
+                          && cli::index_of("label") == 4_usize,
+                      "hyperion::mpl::options test case 2 (failing)");
+        static_assert(cli::index_of("thread") == cli::size()
+                          && cli::index_of("threads2") == cli::size()
+                          && cli::index_of("") == cli::size(),
+                      "hyperion::mpl::options test case 3 (failing)");
+        static_assert(cli{}.get<"threads">() == 4_u32 && not cli{}.get<"verbose">()
+                          && cli{}.get<"ratio">() == 0.5 && cli{}.get<"output">() == "out.bin",
+                      "hyperion::mpl::options test case 4 (failing)");
+        static_assert(std::same_as<cli::values_type,
+                                   mpl::record<List<u32,
+                                                    bool,
+                                                    double,
+                                                    std::string_view,
+                                                    mpl::fixed_string<8>>>>,
+                      "hyperion::mpl::options test case 5 (failing)");
+
+        template<typename TOptions>
+        concept valid_options = requires { sizeof(mpl::options<TOptions>); };
+
+        static_assert(valid_options<List<threads, verbose>>,
+                      "hyperion::mpl::options requirements test case 1 (failing)");
+        static_assert(not valid_options<List<threads, threads>>,
+                      "hyperion::mpl::options requirements test case 2 (failing)");
+        static_assert(not valid_options<List<>>,
+                      "hyperion::mpl::options requirements test case 3 (failing)");
+        static_assert(not valid_options<
+                          List<option<Value<mpl::fixed_string{"a=b"}>, Type<int>, Value<0>>>>,
+                      "hyperion::mpl::options requirements test case 4 (failing)");
+        static_assert(not valid_options<List<int>>,
+                      "hyperion::mpl::options requirements test case 5 (failing)");
+
+        template<typename TType>
+        concept valid_option_type
+            = requires { sizeof(option<Value<mpl::fixed_string{"a"}>, TType, Value<0>>); };
+
+        static_assert(valid_option_type<Type<i64>> && valid_option_type<char>,
+                      "hyperion::mpl::option requirements test case 1 (failing)");
+        static_assert(not valid_option_type<Type<char16_t>> && not valid_option_type<char8_t>
+                          && not valid_option_type<wchar_t>,
+                      "hyperion::mpl::option requirements test case 2 (failing)");
+
+        template<typename TType, typename TDefault>
+        concept valid_option_default
+            = requires { sizeof(option<Value<mpl::fixed_string{"a"}>, TType, TDefault>); };
+
+        static_assert(valid_option_default<u8, Value<255>> && valid_option_default<i8, Value<-128>>
+                          && valid_option_default<bool, Value<1>>
+                          && valid_option_default<double, Value<2>>,
+                      "hyperion::mpl::option requirements test case 3 (failing)");
+        static_assert(not valid_option_default<u32, Value<-1>>
+                          && not valid_option_default<u8, Value<300>>
+                          && not valid_option_default<bool, Value<2>>
+                          && not valid_option_default<i32, Value<0.5>>
+                          && not valid_option_default<float, Value<0.1>>,
+                      "hyperion::mpl::option requirements test case 4 (failing)");
+    } // namespace _test::options
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_OPTIONS_H
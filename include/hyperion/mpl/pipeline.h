@@ -0,0 +1,587 @@
+/// @file pipeline.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Statically-typed, multi-stage streaming pipeline described by an `mpl::List` of stages
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/metatypes.h>
+#include <hyperion/mpl/spsc_queue.h>
+#include <hyperion/mpl/type.h>
+#include <hyperion/mpl/value.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if HYPERION_PLATFORM_IS_LINUX
+    #include <pthread.h>
+    #include <sched.h>
+#endif // HYPERION_PLATFORM_IS_LINUX
+
+/// @ingroup mpl
+/// @{
+/// @defgroup pipeline Multi-Stage Streaming Pipeline
+/// Hyperion provides `mpl::pipeline` for building statically-typed streaming pipelines
+/// (e.g. decode -> enrich -> aggregate -> emit) out of an `mpl::List` of stage types.
+///
+/// The message type passed between each pair of adjacent stages is inferred from the
+/// stage signatures at compile time, stages are connected by bounded lock-free
+/// `mpl::spsc_queue`s, and each stage runs on its own thread. Adjacent stages can be
+/// fused with `mpl::fused` to run them on a single thread without queueing between
+/// them, and an entire pipeline can be run on the calling thread with
+/// `pipeline::run_fused`.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/pipeline.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// struct decode {
+///     auto operator()(std::string_view line) -> record;
+/// };
+/// struct enrich {
+///     auto operator()(record rec) -> enriched_record;
+/// };
+/// struct emit {
+///     auto operator()(enriched_record rec) -> void;
+/// };
+///
+/// auto lines = pipeline<std::string_view, List<decode, enrich, emit>>{};
+/// static_assert(decltype(lines)::messages{}
+///               == List<std::string_view, record, enriched_record, void>{});
+///
+/// lines.run([&](std::string_view& line) { return read_line(line); });
+/// @endcode
+/// @headerfile hyperion/mpl/pipeline.h
+/// @}
+
+#ifndef HYPERION_MPL_PIPELINE_H
+    #define HYPERION_MPL_PIPELINE_H
+
+namespace hyperion::mpl {
+
+    namespace detail {
+        /// @brief Accumulation step for `pipeline_message_types`.
+        /// Appends the message type output by `stage` when invoked with
+        /// the last message type in `messages`.
+        static inline constexpr auto append_stage_output
+            = [](MetaList auto messages, MetaType auto stage) noexcept {
+                  using input = typename decltype(messages.back())::type;
+                  using stage_type = typename decltype(stage)::type;
+
+                  static_assert(not decltype_<input>().is(decltype_<void>()),
+                                "Only the last stage of an mpl::pipeline may return `void`");
+                  static_assert(std::invocable<stage_type&, input&&>,
+                                "Each stage of an mpl::pipeline must be invocable with the "
+                                "message type output by the previous stage");
+
+                  return messages.push_back(
+                      decltype_<std::remove_cvref_t<std::invoke_result_t<stage_type&, input&&>>>());
+              };
+
+        /// @brief Invokes the stages in `stages`, starting at `TIndex`, in order,
+        /// passing the output of each stage as the input to the next.
+        /// @return the output of the last stage in `stages`
+        template<usize TIndex, typename TStages, typename TInput>
+        constexpr auto invoke_chain(TStages& stages, TInput&& input) -> decltype(auto) {
+            if constexpr(TIndex == std::tuple_size_v<TStages> - 1) {
+                return std::invoke(std::get<TIndex>(stages), std::forward<TInput>(input));
+            }
+            else {
+                return invoke_chain<TIndex + 1>(
+                    stages,
+                    std::invoke(std::get<TIndex>(stages), std::forward<TInput>(input)));
+            }
+        }
+
+        /// @brief A queue connecting two adjacent stages of a pipeline,
+        /// and the flag the producing stage uses to signal that it has finished.
+        template<typename TMessage, usize TCapacity>
+        struct pipeline_channel {
+            spsc_queue<TMessage, TCapacity> queue;
+            alignas(hardware_destructive_interference_size) std::atomic<bool> closed = false;
+        };
+
+        /// @brief Pins `thread` to the processor core `core`, if supported on the
+        /// current platform. Otherwise, does nothing.
+        inline auto
+        pin_to_core([[maybe_unused]] std::thread& thread, [[maybe_unused]] usize core) noexcept
+            -> void {
+    #if HYPERION_PLATFORM_IS_LINUX
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(core, &set);
+            static_cast<void>(pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set));
+    #endif // HYPERION_PLATFORM_IS_LINUX
+        }
+    } // namespace detail
+
+    /// @brief Returns the list of message types flowing through a pipeline made of the stages
+    /// in `stages`, when fed values of type `TInput`.
+    ///
+    /// The first element of the returned `List` is `TInput`, and each subsequent element
+    /// is the (cv-ref unqualified) type returned by invoking the corresponding stage with
+    /// the previous message type. The last element is the output type of the pipeline, and
+    /// may be `void`.
+    ///
+    /// # Requirements
+    /// - Each stage must be invocable with an rvalue of the message type output by the
+    /// previous stage (or `TInput`, for the first stage)
+    /// - Only the last stage may return `void`
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// struct parse {
+    ///     auto operator()(int value) -> double;
+    /// };
+    /// struct shrink {
+    ///     auto operator()(double value) -> float;
+    /// };
+    ///
+    /// static_assert(pipeline_message_types<int>(List<parse, shrink>{})
+    ///               == List<int, double, float>{});
+    /// @endcode
+    ///
+    /// @tparam TInput The type of the values fed into the first stage
+    /// @tparam TStages The stage types
+    /// @param stages The `List` of stage types
+    /// @return The `List` of message types flowing through the pipeline
+    /// @ingroup pipeline
+    /// @headerfile hyperion/mpl/pipeline.h
+    template<typename TInput, typename... TStages>
+    [[nodiscard]] constexpr auto
+    pipeline_message_types([[maybe_unused]] List<TStages...> stages) noexcept {
+        return List<TStages...>{}.accumulate(List<TInput>{}, detail::append_stage_output);
+    }
+
+    /// @brief `fused` composes adjacent pipeline stages into a single stage.
+    ///
+    /// Invoking a `fused` invokes each of `TStages` in order, passing the output of each
+    /// directly to the next, without any intermediate queueing. Using a `fused` as a stage of
+    /// an `mpl::pipeline` runs all of the fused stages on the same thread.
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// // `decode` and `enrich` run on one thread, `emit` on another
+    /// auto lines = pipeline<std::string_view, List<fused<decode, enrich>, emit>>{};
+    /// @endcode
+    ///
+    /// @tparam TStages The stages to fuse
+    /// @ingroup pipeline
+    /// @headerfile hyperion/mpl/pipeline.h
+    template<typename... TStages>
+        requires(sizeof...(TStages) != 0)
+    class fused {
+      public:
+        constexpr fused() noexcept(std::is_nothrow_default_constructible_v<std::tuple<TStages...>>)
+            requires std::default_initializable<std::tuple<TStages...>>
+        = default;
+
+        /// @brief Constructs a `fused` from the given stage instances
+        /// @param stages The stages to fuse
+        constexpr explicit fused(TStages... stages) noexcept(
+            std::is_nothrow_move_constructible_v<std::tuple<TStages...>>)
+            : m_stages(std::move(stages)...) {
+        }
+
+        /// @brief Invokes the fused stages in order with `input`
+        /// @param input The input to the first fused stage
+        /// @return The output of the last fused stage
+        template<typename TInput>
+        constexpr auto operator()(TInput&& input) -> decltype(auto) {
+            return detail::invoke_chain<0>(m_stages, std::forward<TInput>(input));
+        }
+
+      private:
+        std::tuple<TStages...> m_stages;
+    };
+
+    /// @brief The default sink for `pipeline::run` and `pipeline::run_fused`.
+    /// Discards the outputs of the last stage.
+    /// @ingroup pipeline
+    /// @headerfile hyperion/mpl/pipeline.h
+    struct discard_output {
+        constexpr auto operator()([[maybe_unused]] auto&&... outputs) const noexcept -> void {
+        }
+    };
+
+    /// @brief Options controlling how `pipeline::run` schedules its stage threads
+    /// @ingroup pipeline
+    /// @headerfile hyperion/mpl/pipeline.h
+    struct pipeline_options {
+        /// @brief Whether to pin each stage's thread to its own processor core.
+        /// Only supported on Linux; ignored on other platforms.
+        bool pin_threads = false;
+        /// @brief The core to pin the first stage's thread to, when `pin_threads` is `true`.
+        /// Each subsequent stage is pinned to the next core, wrapping around at the
+        /// number of hardware threads.
+        usize first_core = 0;
+    };
+
+    template<typename TInput,
+             typename TStages,
+             usize TQueueCapacity = 1024_usize,
+             usize TBatchSize = 32_usize>
+    class pipeline;
+
+    /// @brief `pipeline` is a statically-typed, multi-stage streaming pipeline.
+    ///
+    /// Each stage of the pipeline is an instance of the corresponding type in `TStages`.
+    /// The message types passed between stages are inferred at compile time
+    /// (see `pipeline_message_types`), and exposed through the member alias `messages`.
+    ///
+    /// `run` executes each stage on its own thread, connecting adjacent stages with
+    /// bounded `mpl::spsc_queue`s of capacity `TQueueCapacity`. Stages pop their inputs
+    /// and publish their outputs in batches of up to `TBatchSize` messages, so the
+    /// cross-thread synchronization cost is amortized over each batch.
+    /// `run_fused` instead executes every stage on the calling thread, without queueing.
+    ///
+    /// # Requirements
+    /// - `TStages` must be a non-empty `List` of stage types
+    /// - Each stage must be invocable with an rvalue of the message type output by the
+    /// previous stage (or `TInput`, for the first stage)
+    /// - Only the last stage may return `void`
+    /// - Every message type except the output of the last stage must be default constructible
+    /// and move assignable
+    /// - Stages should not throw; an exception escaping a stage during `run` terminates
+    /// the program
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// auto lines = pipeline<std::string_view, List<decode, enrich, emit>>{};
+    /// lines.run([&](std::string_view& line) { return read_line(line); },
+    ///           discard_output{},
+    ///           pipeline_options{.pin_threads = true});
+    /// @endcode
+    ///
+    /// @tparam TInput The type of the values fed into the first stage
+    /// @tparam TStages The stage types
+    /// @tparam TQueueCapacity The capacity of each inter-stage queue. Must be a power of two
+    /// @tparam TBatchSize The maximum number of messages a stage processes per batch
+    /// @ingroup pipeline
+    /// @headerfile hyperion/mpl/pipeline.h
+    template<typename TInput, typename... TStages, usize TQueueCapacity, usize TBatchSize>
+        requires(sizeof...(TStages) != 0) && (TBatchSize != 0)
+    class pipeline<TInput, List<TStages...>, TQueueCapacity, TBatchSize> {
+      public:
+        /// @brief The `List` of message types flowing through this pipeline, beginning with
+        /// `TInput` and ending with the output type of the last stage
+        using messages = decltype(pipeline_message_types<TInput>(List<TStages...>{}));
+        /// @brief The type of the values fed into the first stage
+        using input_type = TInput;
+        /// @brief The type output by the last stage. May be `void`
+        using output_type = typename decltype(messages{}.back())::type;
+
+        /// @brief The number of stages in this pipeline
+        static inline constexpr auto num_stages = sizeof...(TStages);
+
+        constexpr pipeline() noexcept(
+            std::is_nothrow_default_constructible_v<std::tuple<TStages...>>)
+            requires std::default_initializable<std::tuple<TStages...>>
+        = default;
+
+        /// @brief Constructs a `pipeline` from the given stage instances
+        /// @param stages The stages of the pipeline
+        constexpr explicit pipeline(TStages... stages) noexcept(
+            std::is_nothrow_move_constructible_v<std::tuple<TStages...>>)
+            : m_stages(std::move(stages)...) {
+        }
+
+        /// @brief Runs the pipeline, executing each stage on its own thread, until `source`
+        /// is exhausted and every message has flowed through every stage.
+        ///
+        /// `source` is invoked on the calling thread as `source(input)`, where `input` is
+        /// a `TInput&` to write the next input to. It must return `true` if it produced an
+        /// input, or `false` once it is exhausted. If `output_type` is not `void`, `sink` is
+        /// invoked on the last stage's thread with each output of the last stage.
+        ///
+        /// If `source` throws, the inputs it produced before throwing still flow through
+        /// every stage, and the exception is rethrown once every stage thread has been joined.
+        /// The same holds if starting a stage thread fails, before any input is produced.
+        ///
+        /// @param source The producer of input values
+        /// @param sink The consumer of the last stage's outputs
+        /// @param options How to schedule the stage threads
+        template<typename TSource, typename TSink = discard_output>
+            requires std::invocable<TSource&, TInput&>
+                     && std::convertible_to<std::invoke_result_t<TSource&, TInput&>, bool>
+        auto run(TSource&& source, // NOLINT(*-missing-std-forward)
+                 TSink&& sink = {}, // NOLINT(*-missing-std-forward)
+                 pipeline_options options = {}) -> void {
+            auto channels = make_channels(std::make_index_sequence<num_stages>{});
+            auto threads = std::array<std::thread, num_stages>{};
+            const auto join_all = [&threads]() {
+                for(auto& thread : threads) {
+                    if(thread.joinable()) {
+                        thread.join();
+                    }
+                }
+            };
+
+            try {
+                [&]<usize... TIndices>([[maybe_unused]] std::index_sequence<TIndices...> indices) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    ((threads[TIndices] = std::thread([this, &channels, &sink]() {
+                          run_stage<TIndices>(channels, sink);
+                      })),
+                     ...);
+                }(std::make_index_sequence<num_stages>{});
+            }
+            catch(...) {
+                // nothing has been pushed yet, so closing every channel lets each stage that
+                // did start exit immediately, even if a later stage never started
+                std::apply(
+                    [](auto&... channel) {
+                        (channel->closed.store(true, std::memory_order_release), ...);
+                    },
+                    channels);
+                join_all();
+                throw;
+            }
+
+            if(options.pin_threads) {
+                const auto cores = std::max(std::thread::hardware_concurrency(), 1U);
+                for(auto index = 0_usize; index < num_stages; ++index) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    detail::pin_to_core(threads[index], (options.first_core + index) % cores);
+                }
+            }
+
+            auto& first = *std::get<0>(channels);
+            auto batch = std::array<TInput, TBatchSize>{};
+            auto count = 0_usize;
+            try {
+                for(;;) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    const auto produced = static_cast<bool>(source(batch[count]));
+                    count += produced ? 1_usize : 0_usize;
+                    if(count == TBatchSize || (not produced && count != 0)) {
+                        push_all(first.queue, std::span{batch}.first(count));
+                        count = 0;
+                    }
+                    if(not produced) {
+                        break;
+                    }
+                }
+            }
+            catch(...) {
+                push_all(first.queue, std::span{batch}.first(count));
+                first.closed.store(true, std::memory_order_release);
+                join_all();
+                throw;
+            }
+            first.closed.store(true, std::memory_order_release);
+            join_all();
+        }
+
+        /// @brief Runs the pipeline on the calling thread, invoking every stage in order for
+        /// each input, without any queueing between stages, until `source` is exhausted.
+        ///
+        /// `source` and `sink` have the same requirements and semantics as in `run`.
+        ///
+        /// @param source The producer of input values
+        /// @param sink The consumer of the last stage's outputs
+        template<typename TSource, typename TSink = discard_output>
+            requires std::invocable<TSource&, TInput&>
+                     && std::convertible_to<std::invoke_result_t<TSource&, TInput&>, bool>
+        constexpr auto run_fused(TSource&& source, // NOLINT(*-missing-std-forward)
+                                 TSink&& sink = {}) // NOLINT(*-missing-std-forward)
+            -> void {
+            auto input = TInput{};
+            while(static_cast<bool>(source(input))) {
+                if constexpr(std::is_void_v<output_type>) {
+                    detail::invoke_chain<0>(m_stages, std::move(input));
+                }
+                else {
+                    sink(detail::invoke_chain<0>(m_stages, std::move(input)));
+                }
+            }
+        }
+
+        /// @brief Returns the stage at index `TIndex`
+        /// @return the stage at index `TIndex`
+        template<usize TIndex>
+            requires(TIndex < num_stages)
+        [[nodiscard]] constexpr auto stage() noexcept -> auto& {
+            return std::get<TIndex>(m_stages);
+        }
+
+      private:
+        template<usize TIndex>
+        using message_t = typename decltype(messages{}.template at<TIndex>())::type;
+
+        template<usize... TIndices>
+        [[nodiscard]] static auto
+        make_channels([[maybe_unused]] std::index_sequence<TIndices...> indices) {
+            return std::tuple{std::make_unique<
+                detail::pipeline_channel<message_t<TIndices>, TQueueCapacity>>()...};
+        }
+
+        /// @brief Pushes all of `values` into `queue`, yielding while `queue` is full
+        template<typename TQueue, typename TMessage>
+        static auto push_all(TQueue& queue, std::span<TMessage> values) -> void {
+            while(not values.empty()) {
+                const auto pushed = queue.try_push_batch(values);
+                values = values.subspan(pushed);
+                if(not values.empty()) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        /// @brief The body of the thread running the stage at index `TIndex`
+        template<usize TIndex, typename TChannels, typename TSink>
+        auto run_stage(TChannels& channels, TSink& sink) -> void {
+            static constexpr auto is_last = TIndex == num_stages - 1;
+
+            auto& input = *std::get<TIndex>(channels);
+            auto& stage = std::get<TIndex>(m_stages);
+            auto batch = std::array<message_t<TIndex>, TBatchSize>{};
+            [[maybe_unused]] auto outputs = [] {
+                if constexpr(is_last) {
+                    return std::array<bool, 0>{};
+                }
+                else {
+                    return std::array<message_t<TIndex + 1>, TBatchSize>{};
+                }
+            }();
+
+            for(;;) {
+                auto count = input.queue.try_pop_batch(std::span{batch});
+                if(count == 0) {
+                    if(not input.closed.load(std::memory_order_acquire)) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    // the producer may have published a final batch before closing
+                    count = input.queue.try_pop_batch(std::span{batch});
+                    if(count == 0) {
+                        break;
+                    }
+                }
+
+                for(auto index = 0_usize; index < count; ++index) {
+                    if constexpr(not is_last) {
+                        // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                        outputs[index] = std::invoke(stage, std::move(batch[index]));
+                    }
+                    else if constexpr(std::is_void_v<output_type>) {
+                        // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                        std::invoke(stage, std::move(batch[index]));
+                    }
+                    else {
+                        // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                        sink(std::invoke(stage, std::move(batch[index])));
+                    }
+                }
+
+                if constexpr(not is_last) {
+                    push_all(std::get<TIndex + 1>(channels)->queue,
+                             std::span{outputs}.first(count));
+                }
+            }
+
+            if constexpr(not is_last) {
+                std::get<TIndex + 1>(channels)->closed.store(true, std::memory_order_release);
+            }
+        }
+
+        std::tuple<TStages...> m_stages;
+    };
+
+    namespace _test::pipeline {
+        struct to_double {
+            constexpr auto operator()(int value) const noexcept -> double {
+                return static_cast<double>(value) * 2.0;
+            }
+        };
+
+        struct to_float {
+            constexpr auto operator()(double value) const noexcept -> float {
+                return static_cast<float>(value) + 1.0F;
+            }
+        };
+
+        struct to_long {
+            constexpr auto operator()(float value) noexcept -> const i64& {
+                m_last = static_cast<i64>(value);
+                return m_last;
+            }
+
+          private:
+            i64 m_last = 0;
+        };
+
+        static_assert(pipeline_message_types<int>(List<to_double, to_float>{})
+                          == List<int, double, float>{},
+                      "hyperion::mpl::pipeline_message_types test case 1 (failing)");
+        static_assert(pipeline_message_types<int>(List<to_double, to_float, to_long>{})
+                          == List<int, double, float, i64>{},
+                      "hyperion::mpl::pipeline_message_types test case 2 (failing)");
+        static_assert(pipeline_message_types<int>(List<fused<to_double, to_float>, to_long>{})
+                          == List<int, float, i64>{},
+                      "hyperion::mpl::pipeline_message_types test case 3 (failing)");
+
+        static_assert(std::same_as<mpl::pipeline<int, List<to_double, to_float>>::output_type,
+                                   float>,
+                      "hyperion::mpl::pipeline::output_type test case 1 (failing)");
+
+        static_assert(fused<to_double, to_float>{}(2) == 5.0F,
+                      "hyperion::mpl::fused test case 1 (failing)");
+
+        [[nodiscard]] constexpr auto test_run_fused() noexcept -> bool {
+            auto stages = mpl::pipeline<int, List<to_double, fused<to_float, to_long>>>{};
+
+            auto next = 0;
+            auto sum = 0_i64;
+            stages.run_fused(
+                [&next](int& input) {
+                    input = next++;
+                    return next <= 4;
+                },
+                [&sum](i64 output) { sum += output; });
+
+            // (0 * 2 + 1) + (1 * 2 + 1) + (2 * 2 + 1) + (3 * 2 + 1)
+            return sum == 16;
+        }
+
+        static_assert(test_run_fused(), "hyperion::mpl::pipeline::run_fused test case 1 (failing)");
+    } // namespace _test::pipeline
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_PIPELINE_H
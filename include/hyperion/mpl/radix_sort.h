@@ -0,0 +1,514 @@
+/// @file radix_sort.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Order-preserving radix key encoding generated from a `List` of key field types,
+/// and LSD/MSD radix sorts over the encoded keys
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/fixed_string.h>
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/metatypes.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup radix_sort Radix Keys and Radix Sort
+/// Hyperion provides `mpl::radix_key` for generating an encoder from a `List` of key field
+/// types to order-preserving, big-endian byte strings, and `mpl::lsd_radix_sort` and
+/// `mpl::msd_radix_sort` for sorting values by those encoded keys.
+///
+/// Comparing two encoded keys bytewise gives the same result as comparing the original
+/// fields lexicographically, so composite keys can be sorted in `O(n * key size)` time,
+/// without any comparisons between fields.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/radix_sort.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// struct trade {
+///     fixed_string<8> symbol;
+///     i64 timestamp;
+///     double price;
+/// };
+///
+/// using trade_key = radix_key<List<fixed_string<8>, i64, double>>;
+///
+/// // sorts `trades` by symbol, then timestamp, then price
+/// lsd_radix_sort(std::span{trades}, [](const trade& value) {
+///     return trade_key::encode(value.symbol, value.timestamp, value.price);
+/// });
+/// @endcode
+/// @headerfile hyperion/mpl/radix_sort.h
+/// @}
+
+#ifndef HYPERION_MPL_RADIX_SORT_H
+    #define HYPERION_MPL_RADIX_SORT_H
+
+namespace hyperion::mpl {
+
+    namespace detail {
+        template<typename TField>
+        struct radix_field;
+
+        template<typename TField>
+            requires std::unsigned_integral<TField> && (!std::same_as<TField, bool>)
+        struct radix_field<TField> {
+            static inline constexpr auto size = sizeof(TField);
+
+            [[nodiscard]] static constexpr auto to_unsigned(TField value) noexcept -> TField {
+                return value;
+            }
+        };
+
+        template<typename TField>
+            requires std::signed_integral<TField>
+        struct radix_field<TField> {
+            using unsigned_type = std::make_unsigned_t<TField>;
+            static inline constexpr auto size = sizeof(TField);
+
+            /// @brief Flips the sign bit, so negative values order before positive ones
+            [[nodiscard]] static constexpr auto to_unsigned(TField value) noexcept
+                -> unsigned_type {
+                constexpr auto sign_bit = static_cast<unsigned_type>(
+                    unsigned_type{1} << (std::numeric_limits<unsigned_type>::digits - 1));
+                return static_cast<unsigned_type>(static_cast<unsigned_type>(value) ^ sign_bit);
+            }
+        };
+
+        template<>
+        struct radix_field<bool> {
+            static inline constexpr auto size = 1_usize;
+
+            [[nodiscard]] static constexpr auto to_unsigned(bool value) noexcept -> u8 {
+                return static_cast<u8>(value);
+            }
+        };
+
+        template<typename TField>
+            requires std::is_enum_v<TField>
+                     && requires { radix_field<std::underlying_type_t<TField>>::size; }
+        struct radix_field<TField> {
+            using underlying = radix_field<std::underlying_type_t<TField>>;
+            static inline constexpr auto size = underlying::size;
+
+            [[nodiscard]] static constexpr auto to_unsigned(TField value) noexcept {
+                return underlying::to_unsigned(static_cast<std::underlying_type_t<TField>>(value));
+            }
+        };
+
+        template<typename TField>
+            requires std::floating_point<TField> && std::numeric_limits<TField>::is_iec559
+                     && (sizeof(TField) == sizeof(u32) || sizeof(TField) == sizeof(u64))
+        struct radix_field<TField> {
+            using unsigned_type = std::conditional_t<sizeof(TField) == sizeof(u32), u32, u64>;
+            static inline constexpr auto size = sizeof(TField);
+
+            /// @brief Flips every bit of negative values, and only the sign bit of positive
+            /// values, so that the unsigned ordering of the bits matches the ordering of the
+            /// values
+            [[nodiscard]] static constexpr auto to_unsigned(TField value) noexcept
+                -> unsigned_type {
+                constexpr auto sign_shift = std::numeric_limits<unsigned_type>::digits - 1;
+                constexpr auto sign_bit = static_cast<unsigned_type>(unsigned_type{1}
+                                                                     << sign_shift);
+                const auto bits = std::bit_cast<unsigned_type>(value);
+                const auto mask = static_cast<unsigned_type>(
+                    static_cast<unsigned_type>(unsigned_type{0} - (bits >> sign_shift))
+                    | sign_bit);
+                return static_cast<unsigned_type>(bits ^ mask);
+            }
+        };
+
+        template<usize TSize>
+        struct radix_field<fixed_string<TSize>> {
+            static inline constexpr auto size = TSize;
+        };
+
+        template<typename TField>
+        concept radix_encodable = requires { radix_field<TField>::size; };
+
+        template<usize TKeySize, typename TField>
+        constexpr auto encode_radix_field(std::array<u8, TKeySize>& key,
+                                          usize offset,
+                                          const TField& field) noexcept -> void {
+            if constexpr(requires { radix_field<TField>::to_unsigned(field); }) {
+                const auto bits = radix_field<TField>::to_unsigned(field);
+                constexpr auto size = radix_field<TField>::size;
+                for(auto index = 0_usize; index < size; ++index) {
+                    const auto shift = (size - 1_usize - index) * 8_usize;
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    key[offset + index] = static_cast<u8>(bits >> shift);
+                }
+            }
+            else {
+                for(auto index = 0_usize; index < TField::size(); ++index) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    key[offset + index] = static_cast<u8>(field.chars[index]);
+                }
+            }
+        }
+
+        template<usize TKeySize>
+        struct radix_entry {
+            std::array<u8, TKeySize> key;
+            usize index;
+        };
+
+        template<typename TKey>
+        static inline constexpr auto is_radix_key = false;
+
+        template<usize TKeySize>
+        static inline constexpr auto is_radix_key<std::array<u8, TKeySize>> = true;
+
+        template<typename TKeyOf, typename TValue>
+        concept radix_key_function = std::invocable<TKeyOf&, const TValue&>
+                                     && is_radix_key<std::remove_cvref_t<
+                                         std::invoke_result_t<TKeyOf&, const TValue&>>>;
+    } // namespace detail
+
+    /// @brief `radix_key` generates an encoder from a list of key fields to an order-preserving,
+    /// big-endian byte string.
+    ///
+    /// Comparing two encoded keys lexicographically, byte by byte, gives the same result as
+    /// comparing their fields lexicographically in the order of `TFields`. Each field is encoded
+    /// without branching:
+    /// - Unsigned integers are stored big-endian
+    /// - Signed integers have their sign bit flipped, then are stored big-endian
+    /// - `float`s and `double`s have every bit flipped if they are negative, or only their sign
+    /// bit flipped otherwise, then are stored big-endian. `-0.0` orders before `0.0`, and NaNs
+    /// order before (negative) or after (positive) every other value
+    /// - `bool`s and enums are encoded as their integral value
+    /// - `fixed_string`s are stored as-is
+    ///
+    /// # Requirements
+    /// - `TFields` must be an `mpl::List` of types (or `MetaType`s representing types) that are
+    /// integral, IEEE-754 `float` or `double`, enums, or `fixed_string`s
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// using key = radix_key<List<i32, float>>;
+    ///
+    /// static_assert(key::size == 8);
+    /// static_assert(key::encode(-1, 2.0F) < key::encode(0, -2.0F));
+    /// static_assert(key::encode(0, -2.0F) < key::encode(0, 1.0F));
+    /// @endcode
+    ///
+    /// @tparam TFields The `List` of key field types, from most to least significant
+    /// @ingroup radix_sort
+    /// @headerfile hyperion/mpl/radix_sort.h
+    template<typename TFields>
+    struct radix_key;
+
+    template<typename... TFields>
+        requires(sizeof...(TFields) != 0)
+                && (detail::radix_encodable<detail::convert_to_raw_t<TFields>> && ...)
+    struct radix_key<List<TFields...>> {
+        /// @brief The size of an encoded key, in bytes
+        static inline constexpr auto size
+            = (detail::radix_field<detail::convert_to_raw_t<TFields>>::size + ...);
+
+        /// @brief The type of an encoded key
+        using key_type = std::array<u8, size>;
+
+        /// @brief Encodes `fields` into an order-preserving key
+        ///
+        /// @param fields The fields to encode, from most to least significant
+        /// @return The encoded key
+        [[nodiscard]] static constexpr auto
+        encode(const detail::convert_to_raw_t<TFields>&... fields) noexcept -> key_type {
+            auto key = key_type{};
+            auto offset = 0_usize;
+            ((detail::encode_radix_field(key, offset, fields),
+              offset += detail::radix_field<detail::convert_to_raw_t<TFields>>::size),
+             ...);
+            return key;
+        }
+    };
+
+    namespace detail {
+        /// @brief Computes the encoded keys of `values`, paired with their indices
+        template<typename TValue, typename TKeyOf>
+        [[nodiscard]] auto make_radix_entries(std::span<TValue> values, TKeyOf& key_of) {
+            using key_type = std::remove_cvref_t<std::invoke_result_t<TKeyOf&, const TValue&>>;
+            auto entries = std::vector<radix_entry<std::tuple_size_v<key_type>>>{};
+            entries.reserve(values.size());
+            for(auto index = 0_usize; index < values.size(); ++index) {
+                entries.push_back({std::invoke(key_of, std::as_const(values[index])), index});
+            }
+            return entries;
+        }
+
+        /// @brief Reorders `values` into the order of `entries`
+        template<typename TValue, usize TKeySize>
+        auto apply_radix_order(std::span<TValue> values,
+                               std::span<const radix_entry<TKeySize>> entries) -> void {
+            auto sorted = std::vector<TValue>{};
+            sorted.reserve(values.size());
+            for(const auto& entry : entries) {
+                sorted.push_back(std::move(values[entry.index]));
+            }
+            std::move(sorted.begin(), sorted.end(), values.begin());
+        }
+
+        /// @brief Sorts `entries` by the bytes of their keys starting at `byte`, using `scratch`
+        /// (which must be the same size as `entries`) as temporary storage
+        template<usize TKeySize>
+        auto msd_radix_sort(std::span<radix_entry<TKeySize>> entries,
+                            std::span<radix_entry<TKeySize>> scratch,
+                            usize byte) -> void {
+            constexpr auto insertion_sort_threshold = 32_usize;
+
+            for(; byte < TKeySize; ++byte) {
+                if(entries.size() <= insertion_sort_threshold) {
+                    // stable, and cheaper than another counting pass for small buckets
+                    std::stable_sort(entries.begin(),
+                                     entries.end(),
+                                     [byte](const auto& lhs, const auto& rhs) {
+                                         return std::lexicographical_compare(
+                                             std::next(lhs.key.begin(),
+                                                       static_cast<std::ptrdiff_t>(byte)),
+                                             lhs.key.end(),
+                                             std::next(rhs.key.begin(),
+                                                       static_cast<std::ptrdiff_t>(byte)),
+                                             rhs.key.end());
+                                     });
+                    return;
+                }
+
+                auto counts = std::array<usize, 257_usize>{};
+                for(const auto& entry : entries) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    ++counts[static_cast<usize>(entry.key[byte]) + 1_usize];
+                }
+
+                // every key shares this byte, so move on to the next one without scattering
+                if(std::ranges::find(counts, entries.size()) != counts.end()) {
+                    continue;
+                }
+
+                std::partial_sum(counts.begin(), counts.end(), counts.begin());
+                auto offsets = counts;
+                for(auto& entry : entries) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    scratch[offsets[entry.key[byte]]++] = std::move(entry);
+                }
+                std::ranges::copy(scratch, entries.begin());
+
+                for(auto bucket = 0_usize; bucket < 256_usize; ++bucket) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    const auto begin = counts[bucket];
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    const auto count = counts[bucket + 1_usize] - begin;
+                    if(count > 1_usize) {
+                        msd_radix_sort(entries.subspan(begin, count),
+                                       scratch.subspan(begin, count),
+                                       byte + 1_usize);
+                    }
+                }
+                return;
+            }
+        }
+    } // namespace detail
+
+    /// @brief Stably sorts `values` in ascending order of their encoded keys, using a
+    /// least-significant-digit radix sort.
+    ///
+    /// Each value's key is computed once, with `key_of`. The sort then makes one counting pass
+    /// per key byte, from last to first, skipping bytes that are the same in every key.
+    /// This is the better choice when keys are short, or when most key bytes vary.
+    ///
+    /// # Requirements
+    /// - `key_of` must be invocable with a `const TValue&`, returning a `std::array<u8, N>`,
+    /// typically a `radix_key<...>::key_type`
+    /// - `TValue` must be move constructible and move assignable
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// using key = radix_key<List<i32>>;
+    /// auto values = std::array{3, -1, 2};
+    /// lsd_radix_sort(std::span{values}, [](int value) { return key::encode(value); });
+    /// // `values` is now `{-1, 2, 3}`
+    /// @endcode
+    ///
+    /// @param values The values to sort
+    /// @param key_of The function computing the encoded key of a value
+    /// @ingroup radix_sort
+    /// @headerfile hyperion/mpl/radix_sort.h
+    template<typename TValue, typename TKeyOf>
+        requires detail::radix_key_function<TKeyOf, TValue> && std::movable<TValue>
+    auto lsd_radix_sort(std::span<TValue> values, TKeyOf&& key_of) -> void {
+        if(values.size() <= 1_usize) {
+            return;
+        }
+
+        auto entries = detail::make_radix_entries(values, key_of);
+        using entry = typename decltype(entries)::value_type;
+        constexpr auto key_size = std::tuple_size_v<decltype(entry::key)>;
+
+        auto counts = std::vector<std::array<usize, 256_usize>>(key_size);
+        for(const auto& current : entries) {
+            for(auto byte = 0_usize; byte < key_size; ++byte) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                ++counts[byte][current.key[byte]];
+            }
+        }
+
+        auto scratch = std::vector<entry>(entries.size());
+        for(auto byte = key_size; byte > 0_usize; --byte) {
+            auto& histogram = counts[byte - 1_usize];
+            // every key shares this byte, so this pass wouldn't change the order
+            if(std::ranges::find(histogram, entries.size()) != histogram.end()) {
+                continue;
+            }
+
+            auto offset = 0_usize;
+            for(auto& count : histogram) {
+                offset += std::exchange(count, offset);
+            }
+            for(const auto& current : entries) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                scratch[histogram[current.key[byte - 1_usize]]++] = current;
+            }
+            entries.swap(scratch);
+        }
+
+        detail::apply_radix_order(values, std::span<const entry>{entries});
+    }
+
+    /// @brief Stably sorts `values` in ascending order of their encoded keys, using a
+    /// most-significant-digit radix sort.
+    ///
+    /// Each value's key is computed once, with `key_of`. The sort then partitions the values
+    /// by the first key byte, and recursively sorts each partition by the following bytes,
+    /// finishing small partitions with a comparison sort. This is the better choice when keys
+    /// are long and are usually distinguished by their first few bytes.
+    ///
+    /// # Requirements
+    /// - `key_of` must be invocable with a `const TValue&`, returning a `std::array<u8, N>`,
+    /// typically a `radix_key<...>::key_type`
+    /// - `TValue` must be move constructible and move assignable
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// using key = radix_key<List<fixed_string<4>>>;
+    /// auto values = std::array{fixed_string{"beta"}, fixed_string{"alfa"}};
+    /// msd_radix_sort(std::span{values}, [](const auto& value) { return key::encode(value); });
+    /// // `values` is now `{"alfa", "beta"}`
+    /// @endcode
+    ///
+    /// @param values The values to sort
+    /// @param key_of The function computing the encoded key of a value
+    /// @ingroup radix_sort
+    /// @headerfile hyperion/mpl/radix_sort.h
+    template<typename TValue, typename TKeyOf>
+        requires detail::radix_key_function<TKeyOf, TValue> && std::movable<TValue>
+    auto msd_radix_sort(std::span<TValue> values, TKeyOf&& key_of) -> void {
+        if(values.size() <= 1_usize) {
+            return;
+        }
+
+        auto entries = detail::make_radix_entries(values, key_of);
+        using entry = typename decltype(entries)::value_type;
+
+        auto scratch = std::vector<entry>(entries.size());
+        detail::msd_radix_sort(std::span{entries}, std::span{scratch}, 0_usize);
+
+        detail::apply_radix_order(values, std::span<const entry>{entries});
+    }
+
+    namespace _test::radix_sort {
+        enum class priority : i8 {
+            low = -1,
+            normal = 0,
+            high = 1
+        };
+
+        using signed_key = radix_key<List<i32>>;
+        using float_key = radix_key<List<double>>;
+        using composite_key = radix_key<List<mpl::fixed_string<3>, Type<priority>, u16, bool>>;
+
+        static_assert(signed_key::size == 4_usize,
+                      "hyperion::mpl::radix_key test case 1 (failing)");
+        static_assert(composite_key::size == 7_usize,
+                      "hyperion::mpl::radix_key test case 2 (failing)");
+        static_assert(signed_key::encode(-1) < signed_key::encode(0),
+                      "hyperion::mpl::radix_key test case 3 (failing)");
+        static_assert(signed_key::encode(std::numeric_limits<i32>::min())
+                          < signed_key::encode(-1),
+                      "hyperion::mpl::radix_key test case 4 (failing)");
+        static_assert(signed_key::encode(255) < signed_key::encode(256),
+                      "hyperion::mpl::radix_key test case 5 (failing)");
+        static_assert(float_key::encode(-2.0) < float_key::encode(-1.0),
+                      "hyperion::mpl::radix_key test case 6 (failing)");
+        static_assert(float_key::encode(-1.0) < float_key::encode(-0.0),
+                      "hyperion::mpl::radix_key test case 7 (failing)");
+        static_assert(float_key::encode(0.0) < float_key::encode(0.5),
+                      "hyperion::mpl::radix_key test case 8 (failing)");
+        static_assert(float_key::encode(0.5) < float_key::encode(2.0),
+                      "hyperion::mpl::radix_key test case 9 (failing)");
+        static_assert(float_key::encode(-std::numeric_limits<double>::infinity())
+                          < float_key::encode(std::numeric_limits<double>::lowest()),
+                      "hyperion::mpl::radix_key test case 10 (failing)");
+        static constexpr auto abc = mpl::fixed_string{"abc"};
+        static constexpr auto abd = mpl::fixed_string{"abd"};
+
+        static_assert(composite_key::encode(abc, priority::high, 9_u16, true)
+                          < composite_key::encode(abd, priority::low, 0_u16, false),
+                      "hyperion::mpl::radix_key test case 11 (failing)");
+        static_assert(composite_key::encode(abc, priority::low, 9_u16, true)
+                          < composite_key::encode(abc, priority::normal, 0_u16, false),
+                      "hyperion::mpl::radix_key test case 12 (failing)");
+        static_assert(composite_key::encode(abc, priority::low, 9_u16, false)
+                          < composite_key::encode(abc, priority::low, 9_u16, true),
+                      "hyperion::mpl::radix_key test case 13 (failing)");
+
+        template<typename TFields>
+        concept valid_key = requires { radix_key<TFields>::size; };
+
+        static_assert(not valid_key<List<>>,
+                      "hyperion::mpl::radix_key requirements test case 1 (failing)");
+        static_assert(not valid_key<List<i32, void*>>,
+                      "hyperion::mpl::radix_key requirements test case 2 (failing)");
+        static_assert(not valid_key<List<List<i32>>>,
+                      "hyperion::mpl::radix_key requirements test case 3 (failing)");
+    } // namespace _test::radix_sort
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_RADIX_SORT_H
@@ -0,0 +1,249 @@
+/// @file record.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Plain-old-data record types generated from a `List` of field types
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/metatypes.h>
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup record Records
+/// Hyperion provides `mpl::record` for generating a plain-old-data record type from an
+/// `mpl::List` of field types.
+///
+/// Unlike `std::tuple`, a `record` of trivially copyable fields is itself trivially
+/// copyable, and its fields are laid out in the order they are listed. `record`s support
+/// structured bindings, and their fields are accessed by index with `get`.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/record.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// using order = record<List<u64, i32, double>>;
+///
+/// auto value = order{42_u64, -1_i32, 1.5};
+/// value.get<1>() = 2;
+/// auto [id, quantity, price] = value;
+/// @endcode
+/// @headerfile hyperion/mpl/record.h
+/// @}
+
+#ifndef HYPERION_MPL_RECORD_H
+    #define HYPERION_MPL_RECORD_H
+
+namespace hyperion::mpl {
+
+    namespace detail {
+        template<usize TIndex, typename TType>
+        struct record_field {
+            TType value;
+        };
+
+        template<typename TIndices, typename... TTypes>
+        struct record_fields;
+
+        template<usize... TIndices, typename... TTypes>
+        struct record_fields<std::index_sequence<TIndices...>, TTypes...>
+            : record_field<TIndices, TTypes>... { };
+    } // namespace detail
+
+    /// @brief `record` is a plain-old-data record type with one field for each of the
+    /// types in the `List` `TFields`.
+    ///
+    /// Fields are laid out in the order they are listed, are accessed by index with `get`,
+    /// and can be bound with structured bindings. A `record` of trivially copyable fields is
+    /// trivially copyable, and a default-initialized `record` of trivial fields leaves them
+    /// uninitialized, like an aggregate.
+    ///
+    /// # Requirements
+    /// - `TFields` must be an `mpl::List` of object types (or `MetaType`s representing them)
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// using point = record<List<float, float>>;
+    ///
+    /// constexpr auto value = point{1.0F, 2.0F};
+    /// static_assert(value.get<0>() == 1.0F);
+    /// static_assert(std::is_trivially_copyable_v<point>);
+    /// @endcode
+    ///
+    /// @tparam TFields The `List` of field types
+    /// @ingroup record
+    /// @headerfile hyperion/mpl/record.h
+    template<typename TFields>
+    struct record;
+
+    template<typename... TFields>
+        requires(std::is_object_v<detail::convert_to_raw_t<TFields>> && ...)
+    struct record<List<TFields...>>
+        : private detail::record_fields<std::index_sequence_for<TFields...>,
+                                        detail::convert_to_raw_t<TFields>...> {
+      private:
+        using base = detail::record_fields<std::index_sequence_for<TFields...>,
+                                           detail::convert_to_raw_t<TFields>...>;
+
+        template<usize TIndex>
+        using storage = detail::record_field<
+            TIndex,
+            std::tuple_element_t<TIndex, std::tuple<detail::convert_to_raw_t<TFields>...>>>;
+
+      public:
+        /// @brief The `List` of field types of this `record`
+        using fields = List<detail::convert_to_raw_t<TFields>...>;
+
+        /// @brief The type of the field at `TIndex`
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TFields))
+        using field_type
+            = std::tuple_element_t<TIndex, std::tuple<detail::convert_to_raw_t<TFields>...>>;
+
+        /// @brief Returns the number of fields of this `record`
+        /// @return the number of fields
+        [[nodiscard]] static constexpr auto size() noexcept -> usize {
+            return sizeof...(TFields);
+        }
+
+        /// @brief Default-initializes each field
+        constexpr record() noexcept = default;
+
+        /// @brief Initializes each field from the corresponding argument
+        /// @param values The values of the fields, in order
+        template<typename... TValues>
+            requires(sizeof...(TValues) == sizeof...(TFields)) && (sizeof...(TFields) != 0)
+                    && (std::constructible_from<detail::convert_to_raw_t<TFields>, TValues &&>
+                        && ...)
+        constexpr explicit(sizeof...(TFields) == 1) record(TValues&&... values) noexcept(
+            (std::is_nothrow_constructible_v<detail::convert_to_raw_t<TFields>, TValues&&>
+             && ...))
+            : record(std::index_sequence_for<TFields...>{}, std::forward<TValues>(values)...) {
+        }
+
+        /// @brief Returns the field at `TIndex`
+        /// @return a reference to the field at `TIndex`
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TFields))
+        [[nodiscard]] constexpr auto get() & noexcept -> field_type<TIndex>& {
+            return static_cast<storage<TIndex>&>(*this).value;
+        }
+
+        /// @brief Returns the field at `TIndex`
+        /// @return a reference to the field at `TIndex`
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TFields))
+        [[nodiscard]] constexpr auto get() const& noexcept -> const field_type<TIndex>& {
+            return static_cast<const storage<TIndex>&>(*this).value;
+        }
+
+        /// @brief Returns the field at `TIndex`
+        /// @return an rvalue reference to the field at `TIndex`
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TFields))
+        [[nodiscard]] constexpr auto get() && noexcept -> field_type<TIndex>&& {
+            return std::move(static_cast<storage<TIndex>&>(*this).value);
+        }
+
+        /// @brief Returns the field at `TIndex` of `value`, for use with structured bindings
+        /// @return a reference to the field at `TIndex` of `value`
+        template<usize TIndex, typename TRecord>
+            requires std::same_as<std::remove_cvref_t<TRecord>, record>
+        [[nodiscard]] friend constexpr auto get(TRecord&& value) noexcept -> decltype(auto) {
+            return std::forward<TRecord>(value).template get<TIndex>();
+        }
+
+        /// @brief Compares each field of `lhs` and `rhs` in order
+        [[nodiscard]] friend constexpr auto operator==(const record& lhs, const record& rhs)
+            -> bool
+            requires(std::equality_comparable<detail::convert_to_raw_t<TFields>> && ...)
+        {
+            return [&]<usize... TIndices>(
+                       [[maybe_unused]] std::index_sequence<TIndices...> indices) {
+                return ((lhs.template get<TIndices>() == rhs.template get<TIndices>()) && ...);
+            }(std::index_sequence_for<TFields...>{});
+        }
+
+      private:
+        template<usize... TIndices, typename... TValues>
+        constexpr explicit record([[maybe_unused]] std::index_sequence<TIndices...> indices,
+                                  TValues&&... values)
+            : base{storage<TIndices>{field_type<TIndices>(std::forward<TValues>(values))}...} {
+        }
+    };
+
+} // namespace hyperion::mpl
+
+template<typename... TFields>
+struct std::tuple_size<hyperion::mpl::record<hyperion::mpl::List<TFields...>>>
+    : std::integral_constant<std::size_t, sizeof...(TFields)> { };
+
+template<std::size_t TIndex, typename... TFields>
+struct std::tuple_element<TIndex, hyperion::mpl::record<hyperion::mpl::List<TFields...>>> {
+    using type = typename hyperion::mpl::record<
+        hyperion::mpl::List<TFields...>>::template field_type<TIndex>;
+};
+
+namespace hyperion::mpl::_test::record {
+    using order = mpl::record<List<u64, i32, double>>;
+    using single = mpl::record<List<Type<int>>>;
+
+    static_assert(std::is_trivially_copyable_v<order>,
+                  "hyperion::mpl::record test case 1 (failing)");
+    static_assert(std::is_trivially_default_constructible_v<order>,
+                  "hyperion::mpl::record test case 2 (failing)");
+    static_assert(order::size() == 3_usize, "hyperion::mpl::record test case 3 (failing)");
+    static_assert(order{1_u64, 2_i32, 3.0}.get<1>() == 2_i32,
+                  "hyperion::mpl::record test case 4 (failing)");
+    static_assert(order{1_u64, 2_i32, 3.0} == order{1_u64, 2_i32, 3.0},
+                  "hyperion::mpl::record test case 5 (failing)");
+    static_assert(order{1_u64, 2_i32, 3.0} != order{1_u64, 2_i32, 4.0},
+                  "hyperion::mpl::record test case 6 (failing)");
+    static_assert(std::same_as<single::field_type<0>, int>,
+                  "hyperion::mpl::record test case 7 (failing)");
+    static_assert(not std::is_convertible_v<int, single>,
+                  "hyperion::mpl::record test case 8 (failing)");
+    static_assert(std::is_empty_v<mpl::record<List<>>>,
+                  "hyperion::mpl::record test case 9 (failing)");
+
+    [[nodiscard]] constexpr auto test_structured_bindings() noexcept -> bool {
+        auto value = order{1_u64, 2_i32, 3.0};
+        auto& [id, quantity, price] = value;
+        quantity = 4_i32;
+        return id == 1_u64 && value.get<1>() == 4_i32 && price == 3.0;
+    }
+
+    static_assert(test_structured_bindings(),
+                  "hyperion::mpl::record structured bindings test case 1 (failing)");
+} // namespace hyperion::mpl::_test::record
+
+#endif // HYPERION_MPL_RECORD_H
@@ -0,0 +1,821 @@
+/// @file record_batch.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Columnar batch of records whose schema is an `mpl::List` of field types
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/metatypes.h>
+#include <hyperion/mpl/record.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup record_batch Columnar Record Batches
+/// Hyperion provides `mpl::record_batch` as an in-memory, columnar batch of records, in the
+/// style of Apache Arrow, whose schema is an `mpl::List` of field types.
+///
+/// Each field is stored in its own 64-byte-aligned column, optionally with a validity bitmap
+/// marking null values, so scans over some fields only load those fields' columns. Columns
+/// are reference counted and immutable once shared: slicing a batch, or selecting some of its
+/// columns, creates a new batch sharing the original's columns without copying them, and
+/// filtering a batch only copies the columns of the batch being filtered.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/record_batch.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// using trades = record_batch<List<u64, f64, u32, fixed_string<8>>>;
+///
+/// auto batch = trades{};
+/// batch.append(std::span{rows}); // e.g. a `std::vector<trades::row_type>`
+///
+/// // only the price and quantity columns are read, and only they are copied by `filter`
+/// const auto priced = batch.select<1, 2>();
+/// const auto large = priced.filter(priced.where<1>([](u32 quantity) { return quantity > 100; }));
+/// auto notional = 0.0;
+/// for(auto index = 0_usize; index < large.size(); ++index) {
+///     notional += large.get<0>(index) * large.get<1>(index);
+/// }
+/// @endcode
+/// @headerfile hyperion/mpl/record_batch.h
+/// @}
+
+#ifndef HYPERION_MPL_RECORD_BATCH_H
+    #define HYPERION_MPL_RECORD_BATCH_H
+
+namespace hyperion::mpl {
+
+    /// @brief The alignment of the columns of `mpl::record_batch`es, in bytes.
+    /// Column sizes are also rounded up to a multiple of this.
+    /// @ingroup record_batch
+    /// @headerfile hyperion/mpl/record_batch.h
+    static inline constexpr auto record_batch_alignment = 64_usize;
+
+    namespace detail {
+        template<typename TType>
+        struct is_optional : std::false_type { };
+
+        template<typename TType>
+        struct is_optional<std::optional<TType>> : std::true_type { };
+
+        /// @brief Returns the field at `TIndex` of the tuple-like `row`
+        template<usize TIndex, typename TRow>
+        [[nodiscard]] constexpr auto batch_row_field(const TRow& row) noexcept -> decltype(auto) {
+            using std::get;
+            return get<TIndex>(row);
+        }
+
+        /// @brief The type of the field at `TIndex` of the tuple-like `TRow`
+        template<usize TIndex, typename TRow>
+        using batch_row_field_t = decltype(batch_row_field<TIndex>(std::declval<const TRow&>()));
+
+        /// @brief Whether the field at `TIndex` of `TRow` can be stored in a column of
+        /// `TType`, either directly or as an optional (nullable) value
+        template<typename TRow, usize TIndex, typename TType>
+        concept batch_row_field_of
+            = requires(const TRow& row) { batch_row_field<TIndex>(row); }
+              && (std::convertible_to<batch_row_field_t<TIndex, TRow>, TType>
+                  || std::convertible_to<batch_row_field_t<TIndex, TRow>, std::optional<TType>>);
+
+        template<typename TRow, typename TIndices, typename... TTypes>
+        struct is_batch_row : std::false_type { };
+
+        template<typename TRow, usize... TIndices, typename... TTypes>
+            requires(std::tuple_size<TRow>::value == sizeof...(TTypes))
+        struct is_batch_row<TRow, std::index_sequence<TIndices...>, TTypes...>
+            : std::bool_constant<(batch_row_field_of<TRow, TIndices, TTypes> && ...)> { };
+
+        /// @brief Whether `TRow` is a tuple-like row whose fields can be stored in columns of
+        /// `TTypes`
+        template<typename TRow, typename... TTypes>
+        concept batch_row
+            = is_batch_row<TRow, std::index_sequence_for<TTypes...>, TTypes...>::value;
+
+        /// @brief Allocates an uninitialized, `record_batch_alignment`-aligned,
+        /// reference-counted buffer of at least `count` `TType`s
+        template<typename TType>
+        [[nodiscard]] auto make_batch_buffer(usize count) -> std::shared_ptr<TType[]> {
+            const auto bytes
+                = (count * sizeof(TType) + record_batch_alignment - 1_usize)
+                  / record_batch_alignment * record_batch_alignment;
+            auto* const data = static_cast<TType*>(
+                ::operator new(bytes, std::align_val_t{record_batch_alignment}));
+            return std::shared_ptr<TType[]>(data, [](TType* pointer) noexcept {
+                ::operator delete(pointer, std::align_val_t{record_batch_alignment});
+            });
+        }
+
+        /// @brief The number of 64-bit words needed to hold `bits` bits
+        [[nodiscard]] constexpr auto bitmap_words(usize bits) noexcept -> usize {
+            return (bits + 63_usize) / 64_usize;
+        }
+
+        /// @brief Returns the 64 bits of `words` starting at bit `position`.
+        /// Bits past the end of the bitmap, up to the end of its last word, are included
+        [[nodiscard]] inline auto
+        load_bits(const u64* words, usize position, usize num_words) noexcept -> u64 {
+            const auto word = position / 64_usize;
+            const auto shift = position % 64_usize;
+            // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+            auto bits = words[word] >> shift;
+            if(shift != 0_usize && word + 1_usize < num_words) {
+                // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                bits |= words[word + 1_usize] << (64_usize - shift);
+            }
+            return bits;
+        }
+
+        [[nodiscard]] constexpr auto low_bits(usize count) noexcept -> u64 {
+            return count >= 64_usize ? ~0_u64 : (1_u64 << count) - 1_u64;
+        }
+
+        /// @brief A column of a `record_batch`: a reference-counted buffer of values, and an
+        /// optional reference-counted validity bitmap
+        template<typename TType>
+        struct batch_column {
+            std::shared_ptr<TType[]> values;
+            /// @brief Bit `i` is set if the value at `i` is valid. `nullptr` if every value is
+            /// valid
+            std::shared_ptr<u64[]> validity;
+        };
+    } // namespace detail
+
+    /// @brief `batch_selection` is a bitmap selecting rows of an `mpl::record_batch`, as
+    /// produced by `record_batch::where` and consumed by `record_batch::filter`.
+    /// @ingroup record_batch
+    /// @headerfile hyperion/mpl/record_batch.h
+    class batch_selection {
+      public:
+        /// @brief Constructs a selection of `size` rows, none of which are selected
+        /// @param size The number of rows
+        explicit batch_selection(usize size)
+            : m_words(detail::bitmap_words(size)), m_size(size) {
+        }
+
+        /// @brief Returns the number of rows this selection is over
+        /// @return the number of rows
+        [[nodiscard]] auto size() const noexcept -> usize {
+            return m_size;
+        }
+
+        /// @brief Returns the number of selected rows
+        /// @return the number of selected rows
+        [[nodiscard]] auto count() const noexcept -> usize {
+            auto count = 0_usize;
+            for(const auto word : m_words) {
+                count += static_cast<usize>(std::popcount(word));
+            }
+            return count;
+        }
+
+        /// @brief Returns whether the row at `index` is selected
+        /// @param index The index of the row
+        /// @return whether the row is selected
+        [[nodiscard]] auto contains(usize index) const noexcept -> bool {
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            return ((m_words[index / 64_usize] >> (index % 64_usize)) & 1_u64) != 0_u64;
+        }
+
+        /// @brief Returns the words of the bitmap: bit `i % 64` of word `i / 64` is set if
+        /// row `i` is selected. Bits past `size()` are clear
+        /// @return the words of the bitmap
+        [[nodiscard]] auto words() noexcept -> std::span<u64> {
+            return m_words;
+        }
+
+        /// @brief Returns the words of the bitmap: bit `i % 64` of word `i / 64` is set if
+        /// row `i` is selected. Bits past `size()` are clear
+        /// @return the words of the bitmap
+        [[nodiscard]] auto words() const noexcept -> std::span<const u64> {
+            return m_words;
+        }
+
+        /// @brief Returns the rows selected by both `lhs` and `rhs`
+        ///
+        /// # Requirements
+        /// - `lhs` and `rhs` must be over the same number of rows
+        [[nodiscard]] friend auto
+        operator&(batch_selection lhs, const batch_selection& rhs) noexcept -> batch_selection {
+            std::transform(lhs.m_words.begin(),
+                           lhs.m_words.end(),
+                           rhs.m_words.begin(),
+                           lhs.m_words.begin(),
+                           [](u64 left, u64 right) { return left & right; });
+            return lhs;
+        }
+
+        /// @brief Returns the rows selected by either of `lhs` and `rhs`
+        ///
+        /// # Requirements
+        /// - `lhs` and `rhs` must be over the same number of rows
+        [[nodiscard]] friend auto
+        operator|(batch_selection lhs, const batch_selection& rhs) noexcept -> batch_selection {
+            std::transform(lhs.m_words.begin(),
+                           lhs.m_words.end(),
+                           rhs.m_words.begin(),
+                           lhs.m_words.begin(),
+                           [](u64 left, u64 right) { return left | right; });
+            return lhs;
+        }
+
+      private:
+        std::vector<u64> m_words;
+        usize m_size;
+    };
+
+    /// @brief `record_batch` is an in-memory, columnar batch of records with one column for
+    /// each of the field types in the `List` `TFields`.
+    ///
+    /// Each column is stored in a `record_batch_alignment`-aligned buffer, with an optional
+    /// validity bitmap marking which of its values are valid (non-null). Columns are accessed
+    /// by index, resolved at compile time, with `column<I>()` and `get<I>(row)`.
+    ///
+    /// Column buffers are reference counted, and are never modified while shared:
+    /// - `slice` and `select` return batches sharing this batch's columns, without copying them
+    /// - `filter` returns a batch with compacted copies of only this batch's columns, so
+    /// `select`ing the needed columns before filtering avoids copying the others
+    /// - `append`ing to a batch whose columns are shared, or lack capacity, first moves it to
+    /// new columns
+    ///
+    /// Batches sharing columns may be used and destroyed concurrently on different threads, as
+    /// with `std::shared_ptr`. As with standard containers, a single batch must not be modified
+    /// while another thread accesses it.
+    ///
+    /// Rows are appended in bulk from tuple-like row types (e.g. `row_type`, or `std::tuple`).
+    /// Row fields that are `std::optional`s mark the rows they are empty in as null.
+    ///
+    /// # Requirements
+    /// - `TFields` must be a non-empty `mpl::List` of trivially copyable object types (or
+    /// `MetaType`s representing them)
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// using batch_type = record_batch<List<u32, f64>>;
+    ///
+    /// auto batch = batch_type{};
+    /// const auto rows = std::array{std::tuple{1_u32, std::optional{1.5}},
+    ///                              std::tuple{2_u32, std::optional<f64>{}}};
+    /// batch.append(std::span{rows});
+    /// assert(batch.size() == 2 && batch.is_valid<1>(0) && not batch.is_valid<1>(1));
+    ///
+    /// const auto tail = batch.slice(1, 1);
+    /// assert(tail.get<0>(0) == 2_u32);
+    /// @endcode
+    ///
+    /// @tparam TFields The `List` of field types
+    /// @ingroup record_batch
+    /// @headerfile hyperion/mpl/record_batch.h
+    template<typename TFields>
+    class record_batch;
+
+    template<typename... TFields>
+        requires(sizeof...(TFields) != 0)
+                && (std::is_object_v<detail::convert_to_raw_t<TFields>> && ...)
+                && (std::is_trivially_copyable_v<detail::convert_to_raw_t<TFields>> && ...)
+    class record_batch<List<TFields...>> {
+      public:
+        /// @brief The `List` of field types of this batch
+        using fields = List<detail::convert_to_raw_t<TFields>...>;
+
+        /// @brief The record type of a single row of this batch
+        using row_type = record<List<detail::convert_to_raw_t<TFields>...>>;
+
+        /// @brief The type of the field at `TIndex`
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TFields))
+        using field_type = typename row_type::template field_type<TIndex>;
+
+        /// @brief Constructs an empty batch
+        record_batch() noexcept = default;
+
+        /// @brief Returns the number of columns
+        /// @return the number of columns
+        [[nodiscard]] static constexpr auto num_columns() noexcept -> usize {
+            return sizeof...(TFields);
+        }
+
+        /// @brief Returns the number of rows
+        /// @return the number of rows
+        [[nodiscard]] auto size() const noexcept -> usize {
+            return m_size;
+        }
+
+        /// @brief Returns whether this batch has no rows
+        /// @return whether this batch is empty
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return m_size == 0_usize;
+        }
+
+        /// @brief Returns the values of the column at `TIndex`.
+        /// Values marked as null by the column's validity bitmap are unspecified
+        /// @return the values of the column
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TFields))
+        [[nodiscard]] auto column() const noexcept -> std::span<const field_type<TIndex>> {
+            const auto& values = std::get<TIndex>(m_columns).values;
+            if(values == nullptr) {
+                return {};
+            }
+            return std::span<const field_type<TIndex>>{values.get() + m_offset, m_size};
+        }
+
+        /// @brief Returns the value of the column at `TIndex` in the row at `index`
+        ///
+        /// # Requirements
+        /// - `index` must be less than `size()`
+        ///
+        /// @param index The index of the row
+        /// @return the value
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TFields))
+        [[nodiscard]] auto get(usize index) const noexcept -> const field_type<TIndex>& {
+            // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+            return std::get<TIndex>(m_columns).values[m_offset + index];
+        }
+
+        /// @brief Returns whether the column at `TIndex` has a validity bitmap
+        /// @return whether the column may hold nulls
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TFields))
+        [[nodiscard]] auto has_validity() const noexcept -> bool {
+            return std::get<TIndex>(m_columns).validity != nullptr;
+        }
+
+        /// @brief Returns whether the value of the column at `TIndex` in the row at `index` is
+        /// valid (non-null)
+        ///
+        /// # Requirements
+        /// - `index` must be less than `size()`
+        ///
+        /// @param index The index of the row
+        /// @return whether the value is valid
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TFields))
+        [[nodiscard]] auto is_valid(usize index) const noexcept -> bool {
+            const auto& validity = std::get<TIndex>(m_columns).validity;
+            const auto position = m_offset + index;
+            return validity == nullptr
+                   // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                   || ((validity[position / 64_usize] >> (position % 64_usize)) & 1_u64) != 0_u64;
+        }
+
+        /// @brief Returns the number of null values in the column at `TIndex`
+        /// @return the number of nulls
+        template<usize TIndex>
+            requires(TIndex < sizeof...(TFields))
+        [[nodiscard]] auto null_count() const noexcept -> usize {
+            const auto& validity = std::get<TIndex>(m_columns).validity;
+            if(validity == nullptr) {
+                return 0_usize;
+            }
+            auto valid = 0_usize;
+            const auto num_words = detail::bitmap_words(m_offset + m_size);
+            for(auto index = 0_usize; index < m_size; index += 64_usize) {
+                const auto bits
+                    = detail::load_bits(validity.get(), m_offset + index, num_words)
+                      & detail::low_bits(m_size - index);
+                valid += static_cast<usize>(std::popcount(bits));
+            }
+            return m_size - valid;
+        }
+
+        /// @brief Reserves space for at least `capacity` rows
+        /// @param capacity The number of rows to reserve space for
+        auto reserve(usize capacity) -> void {
+            if(not writable(capacity)) {
+                reallocate(std::max(capacity, m_size));
+            }
+        }
+
+        /// @brief Appends `rows` to this batch
+        /// @param rows The rows to append: a contiguous range of tuple-like rows, such as a
+        /// `std::vector`, `std::array` or `std::span` of `row_type`s or `std::tuple`s
+        template<std::ranges::contiguous_range TRows>
+            requires std::ranges::sized_range<const TRows>
+                     && detail::batch_row<std::ranges::range_value_t<TRows>,
+                                          detail::convert_to_raw_t<TFields>...>
+        auto append(const TRows& rows) -> void {
+            append_rows(std::span<const std::ranges::range_value_t<TRows>>{
+                std::ranges::data(rows),
+                std::ranges::size(rows)});
+        }
+
+        /// @brief Returns the batch of the `count` rows starting at `first`, sharing this
+        /// batch's columns
+        ///
+        /// # Requirements
+        /// - `first + count` must not be greater than `size()`
+        ///
+        /// @param first The index of the first row of the slice
+        /// @param count The number of rows in the slice
+        /// @return the slice
+        [[nodiscard]] auto slice(usize first, usize count) const noexcept -> record_batch {
+            auto sliced = *this;
+            sliced.m_offset += first;
+            sliced.m_size = count;
+            return sliced;
+        }
+
+        /// @brief Returns the batch of the columns at `TIndices`, sharing this batch's columns
+        /// @return the batch of the selected columns
+        template<usize... TIndices>
+            requires(sizeof...(TIndices) != 0) && ((TIndices < sizeof...(TFields)) && ...)
+        [[nodiscard]] auto select() const noexcept {
+            auto selected = record_batch<List<field_type<TIndices>...>>{};
+            selected.m_columns = {std::get<TIndices>(m_columns)...};
+            selected.m_offset = m_offset;
+            selected.m_size = m_size;
+            selected.m_capacity = m_capacity;
+            return selected;
+        }
+
+        /// @brief Returns the selection of the rows whose value in the column at `TIndex`
+        /// satisfies `predicate`. Null values are never selected.
+        ///
+        /// `predicate` is evaluated for every row, and its results are packed into the
+        /// selection 64 rows at a time without branching, so that the loop can be vectorized.
+        ///
+        /// @param predicate The predicate to evaluate for each value
+        /// @return the selection of the rows satisfying `predicate`
+        template<usize TIndex, typename TPredicate>
+            requires(TIndex < sizeof...(TFields))
+                    && std::predicate<TPredicate&, const field_type<TIndex>&>
+        [[nodiscard]] auto where(TPredicate&& predicate) const -> batch_selection {
+            auto selection = batch_selection{m_size};
+            const auto values = column<TIndex>();
+            const auto words = selection.words();
+
+            const auto full_words = m_size / 64_usize;
+            for(auto word = 0_usize; word < full_words; ++word) {
+                const auto block = values.subspan(word * 64_usize, 64_usize);
+                auto bits = 0_u64;
+                for(auto bit = 0_usize; bit < 64_usize; ++bit) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    bits |= static_cast<u64>(static_cast<bool>(predicate(block[bit]))) << bit;
+                }
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                words[word] = bits;
+            }
+            if(const auto remaining = m_size % 64_usize; remaining != 0_usize) {
+                const auto block = values.subspan(full_words * 64_usize);
+                auto bits = 0_u64;
+                for(auto bit = 0_usize; bit < remaining; ++bit) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    bits |= static_cast<u64>(static_cast<bool>(predicate(block[bit]))) << bit;
+                }
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                words[full_words] = bits;
+            }
+
+            if(const auto& validity = std::get<TIndex>(m_columns).validity; validity != nullptr) {
+                const auto num_words = detail::bitmap_words(m_offset + m_size);
+                for(auto word = 0_usize; word < words.size(); ++word) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    words[word] &= detail::load_bits(validity.get(),
+                                                     m_offset + word * 64_usize,
+                                                     num_words);
+                }
+            }
+
+            return selection;
+        }
+
+        /// @brief Returns the batch of the rows of this batch selected by `selection`, in
+        /// order. Every column of this batch is compacted into a new column
+        ///
+        /// # Requirements
+        /// - `selection` must be over `size()` rows
+        ///
+        /// @param selection The rows to keep
+        /// @return the filtered batch
+        [[nodiscard]] auto filter(const batch_selection& selection) const -> record_batch {
+            auto filtered = record_batch{};
+            const auto count = selection.count();
+            filtered.reallocate(count);
+
+            [&]<usize... TIndices>([[maybe_unused]] std::index_sequence<TIndices...> indices) {
+                (filter_column<TIndices>(filtered, selection), ...);
+            }(std::index_sequence_for<TFields...>{});
+            filtered.m_size = count;
+
+            return filtered;
+        }
+
+      private:
+        template<typename TOtherFields>
+        friend class record_batch;
+
+        std::tuple<detail::batch_column<detail::convert_to_raw_t<TFields>>...> m_columns;
+        usize m_offset = 0_usize;
+        usize m_size = 0_usize;
+        usize m_capacity = 0_usize;
+
+        /// @brief Returns whether `size` rows fit in this batch's columns, and no other batch
+        /// shares them
+        [[nodiscard]] auto writable(usize size) const noexcept -> bool {
+            const auto exclusive
+                = m_offset + size <= m_capacity
+                  && std::apply(
+                      [](const auto&... columns) {
+                          return ((columns.values.use_count() == 1
+                                   && (columns.validity == nullptr
+                                       || columns.validity.use_count() == 1))
+                                  && ...);
+                      },
+                      m_columns);
+            // `use_count` is a relaxed load. If it observed the release of the last other
+            // owner, on another thread, that owner's reads of the columns must happen before
+            // our writes to them
+            if(exclusive) {
+                std::atomic_thread_fence(std::memory_order_acquire);
+            }
+            return exclusive;
+        }
+
+        /// @brief Moves this batch's rows to new, unshared columns with room for `capacity`
+        /// rows
+        auto reallocate(usize capacity) -> void {
+            // allocate every new column before replacing any, so that if an allocation
+            // throws, this batch is left unchanged
+            auto columns = std::apply(
+                [&](const auto&... old_columns) {
+                    return decltype(m_columns){reallocated_column(old_columns, capacity)...};
+                },
+                m_columns);
+
+            static_assert(std::is_nothrow_move_assignable_v<decltype(m_columns)>,
+                          "committing reallocated record_batch columns must not throw");
+            m_columns = std::move(columns);
+            m_offset = 0_usize;
+            m_capacity = capacity;
+        }
+
+        /// @brief Appends `rows` to this batch
+        template<typename TRow>
+        auto append_rows(std::span<const TRow> rows) -> void {
+            if(rows.empty()) {
+                return;
+            }
+
+            const auto size = m_size + rows.size();
+            if(not writable(size)) {
+                reallocate(std::max(size, 2_usize * m_capacity));
+            }
+
+            // rows are scattered into the columns a cache-sized chunk at a time, so that each
+            // row is loaded from memory once rather than once per column
+            constexpr auto chunk_size = 1024_usize;
+            for(auto first = 0_usize; first < rows.size(); first += chunk_size) {
+                const auto chunk = rows.subspan(first, std::min(chunk_size, rows.size() - first));
+                [&]<usize... TIndices>([[maybe_unused]] std::index_sequence<TIndices...> indices) {
+                    (append_column<TIndices>(chunk), ...);
+                }(std::index_sequence_for<TFields...>{});
+                m_size += chunk.size();
+            }
+        }
+
+        /// @brief Returns a new, unshared copy of this batch's rows of `column`, with room
+        /// for `capacity` rows
+        template<typename TType>
+        [[nodiscard]] auto reallocated_column(const detail::batch_column<TType>& column,
+                                              usize capacity) const
+            -> detail::batch_column<TType> {
+            auto reallocated = detail::batch_column<TType>{};
+            reallocated.values = detail::make_batch_buffer<TType>(capacity);
+            if(m_size != 0_usize) {
+                std::memcpy(reallocated.values.get(),
+                            column.values.get() + m_offset,
+                            m_size * sizeof(TType));
+            }
+
+            if(column.validity != nullptr) {
+                const auto num_words = detail::bitmap_words(capacity);
+                const auto copied_words = detail::bitmap_words(m_size);
+                reallocated.validity = detail::make_batch_buffer<u64>(num_words);
+                copy_bits(reallocated.validity.get(),
+                          0_usize,
+                          column.validity.get(),
+                          m_offset,
+                          m_size);
+                // `set_valid` read-modify-writes the words of rows appended after these
+                // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                std::fill_n(reallocated.validity.get() + copied_words,
+                            num_words - copied_words,
+                            0_u64);
+            }
+            return reallocated;
+        }
+
+        /// @brief Copies `count` bits starting at bit `source_position` of `source` into
+        /// `destination`, starting at bit `destination_position`, which must be a multiple
+        /// of 64
+        auto copy_bits(u64* destination,
+                       usize destination_position,
+                       const u64* source,
+                       usize source_position,
+                       usize count) const noexcept -> void {
+            const auto num_words = detail::bitmap_words(source_position + count);
+            for(auto index = 0_usize; index < count; index += 64_usize) {
+                // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                destination[(destination_position + index) / 64_usize]
+                    = detail::load_bits(source, source_position + index, num_words);
+            }
+        }
+
+        /// @brief Sets the validity bit of the row at `index` (relative to this batch's
+        /// offset) of `validity` to `valid`
+        auto set_valid(u64* validity, usize index, bool valid) const noexcept -> void {
+            const auto position = m_offset + index;
+            const auto mask = 1_u64 << (position % 64_usize);
+            // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+            auto& word = validity[position / 64_usize];
+            word = valid ? (word | mask) : (word & ~mask);
+        }
+
+        template<usize TIndex, typename TRow>
+        auto append_column(std::span<const TRow> rows) -> void {
+            using type = field_type<TIndex>;
+            using row_field
+                = std::remove_cvref_t<decltype(detail::batch_row_field<TIndex>(rows.front()))>;
+            auto& column = std::get<TIndex>(m_columns);
+            auto* const values = column.values.get() + m_offset + m_size;
+
+            if constexpr(detail::is_optional<row_field>::value) {
+                if(column.validity == nullptr
+                   && std::any_of(rows.begin(), rows.end(), [](const TRow& row) {
+                          return not detail::batch_row_field<TIndex>(row).has_value();
+                      }))
+                {
+                    // the first null in this column: every earlier value is valid
+                    column.validity
+                        = detail::make_batch_buffer<u64>(detail::bitmap_words(m_capacity));
+                    std::fill_n(column.validity.get(),
+                                detail::bitmap_words(m_capacity),
+                                ~0_u64);
+                }
+
+                for(auto index = 0_usize; index < rows.size(); ++index) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    const auto& value = detail::batch_row_field<TIndex>(rows[index]);
+                    // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                    values[index] = value.has_value() ? static_cast<type>(*value) : type{};
+                    if(column.validity != nullptr) {
+                        set_valid(column.validity.get(), m_size + index, value.has_value());
+                    }
+                }
+            }
+            else {
+                for(auto index = 0_usize; index < rows.size(); ++index) {
+                    // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+                    values[index]
+                        = static_cast<type>(detail::batch_row_field<TIndex>(rows[index]));
+                }
+                if(column.validity != nullptr) {
+                    for(auto index = 0_usize; index < rows.size(); ++index) {
+                        set_valid(column.validity.get(), m_size + index, true);
+                    }
+                }
+            }
+        }
+
+        template<usize TIndex>
+        auto filter_column(record_batch& filtered, const batch_selection& selection) const
+            -> void {
+            using type = field_type<TIndex>;
+            const auto& column = std::get<TIndex>(m_columns);
+            auto& output = std::get<TIndex>(filtered.m_columns);
+            const auto* const input = column.values.get() + m_offset;
+            auto* const values = output.values.get();
+            const auto words = selection.words();
+
+            // compact the values: runs of 64 selected rows are copied at once, and sparser
+            // words visit only their selected rows
+            auto count = 0_usize;
+            for(auto word = 0_usize; word < words.size(); ++word) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                auto bits = words[word];
+                const auto base = word * 64_usize;
+                if(bits == ~0_u64) {
+                    // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                    std::memcpy(values + count, input + base, 64_usize * sizeof(type));
+                    count += 64_usize;
+                    continue;
+                }
+                while(bits != 0_u64) {
+                    const auto bit = static_cast<usize>(std::countr_zero(bits));
+                    // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                    values[count++] = input[base + bit];
+                    bits &= bits - 1_u64;
+                }
+            }
+
+            if(column.validity != nullptr) {
+                const auto num_words = detail::bitmap_words(m_offset + m_size);
+                auto validity = detail::make_batch_buffer<u64>(
+                    detail::bitmap_words(filtered.m_capacity));
+                std::fill_n(validity.get(), detail::bitmap_words(filtered.m_capacity), 0_u64);
+                auto position = 0_usize;
+                for(auto word = 0_usize; word < words.size(); ++word) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    auto bits = words[word];
+                    const auto valid = detail::load_bits(column.validity.get(),
+                                                         m_offset + word * 64_usize,
+                                                         num_words);
+                    while(bits != 0_u64) {
+                        const auto bit = static_cast<usize>(std::countr_zero(bits));
+                        // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                        validity[position / 64_usize] |= ((valid >> bit) & 1_u64)
+                                                         << (position % 64_usize);
+                        ++position;
+                        bits &= bits - 1_u64;
+                    }
+                }
+                output.validity = std::move(validity);
+            }
+        }
+    };
+
+    namespace _test::record_batch {
+        using trades = mpl::record_batch<List<u64, double, Type<u32>, i16>>;
+
+        static_assert(trades::num_columns() == 4_usize,
+                      "hyperion::mpl::record_batch test case 1 (failing)");
+        static_assert(std::same_as<trades::field_type<2>, u32>,
+                      "hyperion::mpl::record_batch test case 2 (failing)");
+        static_assert(std::same_as<trades::row_type, mpl::record<List<u64, double, u32, i16>>>,
+                      "hyperion::mpl::record_batch test case 3 (failing)");
+        static_assert(std::same_as<decltype(std::declval<const trades&>().select<3, 1>()),
+                                   mpl::record_batch<List<i16, double>>>,
+                      "hyperion::mpl::record_batch test case 4 (failing)");
+        static_assert(std::same_as<decltype(std::declval<const trades&>().column<1>()),
+                                   std::span<const double>>,
+                      "hyperion::mpl::record_batch test case 5 (failing)");
+
+        static_assert(detail::batch_row<trades::row_type, u64, double, u32, i16>,
+                      "hyperion::mpl::record_batch row test case 1 (failing)");
+        static_assert(detail::batch_row<std::tuple<u64, std::optional<double>, u32, i16>,
+                                        u64,
+                                        double,
+                                        u32,
+                                        i16>,
+                      "hyperion::mpl::record_batch row test case 2 (failing)");
+        static_assert(not detail::batch_row<std::tuple<u64, double>, u64, double, u32, i16>,
+                      "hyperion::mpl::record_batch row test case 3 (failing)");
+        static_assert(not detail::batch_row<int, u64>,
+                      "hyperion::mpl::record_batch row test case 4 (failing)");
+
+        template<typename TFields>
+        concept valid_record_batch = requires { mpl::record_batch<TFields>::num_columns(); };
+
+        static_assert(valid_record_batch<List<u8>>,
+                      "hyperion::mpl::record_batch requirements test case 1 (failing)");
+        static_assert(not valid_record_batch<List<>>,
+                      "hyperion::mpl::record_batch requirements test case 2 (failing)");
+        static_assert(not valid_record_batch<List<std::vector<int>>>,
+                      "hyperion::mpl::record_batch requirements test case 3 (failing)");
+    } // namespace _test::record_batch
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_RECORD_BATCH_H
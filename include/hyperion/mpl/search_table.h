@@ -0,0 +1,323 @@
+/// @file search_table.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Compile-time generated, cache-friendly key-value lookup tables
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/concurrent_layout.h>
+#include <hyperion/mpl/detail/all_distinct.h>
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/metatypes.h>
+#include <hyperion/mpl/pair.h>
+#include <hyperion/mpl/value.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup search_table Compile-Time Search Tables
+/// Hyperion provides `mpl::search_table` and `mpl::make_search_table` for generating
+/// constant key-value lookup tables (e.g. error code mappings, protocol field IDs) from an
+/// `mpl::List` of `mpl::Pair`s of `mpl::Value`s.
+///
+/// The pairs are sorted at compile time and stored in Eytzinger (breadth-first binary
+/// heap) order, so that the first levels of every search share the same few cache lines,
+/// and the cache lines needed by later levels can be prefetched well ahead of use. Searches
+/// are branchless apart from the loop condition: a search of a table of `n` entries takes
+/// `floor(log2(n))` or `floor(log2(n)) + 1` iterations, depending on whether its path ends
+/// above or within the partially filled bottom level of the tree. Only when `n` is
+/// `2^k - 1` does every search take the same number (`k`) of iterations.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/search_table.h>
+/// #include <sysexits.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// static constexpr auto exit_codes = make_search_table(
+///     List<Pair<Value<ENOENT>, Value<EX_NOINPUT>>,
+///          Pair<Value<EACCES>, Value<EX_NOPERM>>,
+///          Pair<Value<EINVAL>, Value<EX_USAGE>>>{});
+///
+/// if(const auto* code = exit_codes.find(errno)) {
+///     std::exit(*code);
+/// }
+/// @endcode
+/// @headerfile hyperion/mpl/search_table.h
+/// @}
+
+#ifndef HYPERION_MPL_SEARCH_TABLE_H
+    #define HYPERION_MPL_SEARCH_TABLE_H
+
+namespace hyperion::mpl {
+
+    namespace detail {
+        template<typename TPair>
+        using pair_key_t = std::remove_cvref_t<decltype(TPair::first::value)>;
+        template<typename TPair>
+        using pair_mapped_t = std::remove_cvref_t<decltype(TPair::second::value)>;
+
+        template<typename TPair>
+        concept value_pair = MetaPair<TPair> && MetaValue<typename TPair::first>
+                             && MetaValue<typename TPair::second>;
+    } // namespace detail
+
+    /// @brief `search_table` is a constant lookup table from keys of type `TKey` to values
+    /// of type `TValue`, stored in Eytzinger order for fast, branchless searches.
+    ///
+    /// `search_table`s are created by `mpl::make_search_table`.
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// static constexpr auto table = make_search_table(
+    ///     List<Pair<Value<3>, Value<30>>, Pair<Value<1>, Value<10>>>{});
+    /// static_assert(*table.find(3) == 30);
+    /// static_assert(table.find(2) == nullptr);
+    /// @endcode
+    ///
+    /// @tparam TKey The type of the keys
+    /// @tparam TValue The type of the values
+    /// @tparam TSize The number of entries in the table
+    /// @ingroup search_table
+    /// @headerfile hyperion/mpl/search_table.h
+    template<typename TKey, typename TValue, usize TSize>
+        requires std::totally_ordered<TKey> && std::default_initializable<TKey>
+                 && std::default_initializable<TValue>
+    class search_table {
+      public:
+        /// @brief The type of the keys of this table
+        using key_type = TKey;
+        /// @brief The type of the values of this table
+        using mapped_type = TValue;
+
+        /// @brief Constructs a `search_table` from the given key-value pairs.
+        ///
+        /// # Requirements
+        /// - The keys in `entries` must be distinct
+        ///
+        /// @param entries The key-value pairs, in any order
+        constexpr explicit search_table(
+            std::array<std::pair<TKey, TValue>, TSize> entries) noexcept(
+            std::is_nothrow_copy_assignable_v<TKey> && std::is_nothrow_copy_assignable_v<TValue>) {
+            std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.first < rhs.first;
+            });
+            static_cast<void>(layout(entries, 0_usize, 1_usize));
+        }
+
+        /// @brief Returns the number of entries in this table
+        /// @return The number of entries
+        [[nodiscard]] static constexpr auto size() noexcept -> usize {
+            return TSize;
+        }
+
+        /// @brief Returns a pointer to the value associated with `key`,
+        /// or `nullptr` if `key` is not in this table
+        /// @param key The key to search for
+        /// @return A pointer to the value associated with `key`, if any
+        [[nodiscard]] constexpr auto find(const TKey& key) const noexcept -> const TValue* {
+            const auto index = lower_bound(key);
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            return index != 0_usize && m_keys[index] == key ? &m_values[index] : nullptr;
+        }
+
+        /// @brief Returns whether `key` is in this table
+        /// @param key The key to search for
+        /// @return Whether `key` is in this table
+        [[nodiscard]] constexpr auto contains(const TKey& key) const noexcept -> bool {
+            return find(key) != nullptr;
+        }
+
+        /// @brief Returns the value associated with `key`, or `default_value`
+        /// if `key` is not in this table
+        ///
+        /// The result is returned by value, so that passing a temporary as
+        /// `default_value` can't leave the caller with a dangling reference.
+        ///
+        /// @param key The key to search for
+        /// @param default_value The value to return if `key` is not in this table
+        /// @return The value associated with `key`, or `default_value`
+        [[nodiscard]] constexpr auto
+        value_or(const TKey& key, const TValue& default_value) const
+            noexcept(std::is_nothrow_copy_constructible_v<TValue>) -> TValue {
+            const auto* value = find(key);
+            return value != nullptr ? *value : default_value;
+        }
+
+      private:
+        /// @brief The number of keys per cache line. Prefetching the node this many times
+        /// further along the current search path fetches the cache line holding all of its
+        /// descendants `log2(keys_per_line)` levels down
+        static inline constexpr auto keys_per_line = std::max(
+            hardware_constructive_interference_size / sizeof(TKey), 1_usize);
+
+        // index 0 is unused, so that the children of node `i` are at `2i` and `2i + 1`
+        std::array<TKey, TSize + 1> m_keys = {};
+        std::array<TValue, TSize + 1> m_values = {};
+
+        /// @brief Fills the subtree rooted at `node` with the sorted `entries`, starting at
+        /// `next`, via an in-order traversal of the implicit tree
+        /// @return The index of the first entry not placed in the subtree
+        constexpr auto layout(const std::array<std::pair<TKey, TValue>, TSize>& entries,
+                              usize next,
+                              usize node) -> usize {
+            if(node > TSize) {
+                return next;
+            }
+
+            next = layout(entries, next, 2_usize * node);
+            // NOLINTBEGIN(*-pro-bounds-constant-array-index)
+            m_keys[node] = entries[next].first;
+            m_values[node] = entries[next].second;
+            // NOLINTEND(*-pro-bounds-constant-array-index)
+            return layout(entries, next + 1_usize, 2_usize * node + 1_usize);
+        }
+
+        /// @brief Returns the index of the first key not less than `key`,
+        /// or `0` if there is no such key
+        [[nodiscard]] constexpr auto lower_bound(const TKey& key) const noexcept -> usize {
+            auto index = 1_usize;
+            while(index <= TSize) {
+    #if HYPERION_PLATFORM_COMPILER_IS_CLANG || HYPERION_PLATFORM_COMPILER_IS_GCC
+                if(not std::is_constant_evaluated()) {
+                    __builtin_prefetch(m_keys.data() + std::min(index * keys_per_line, TSize));
+                }
+    #endif // HYPERION_PLATFORM_COMPILER_IS_CLANG || HYPERION_PLATFORM_COMPILER_IS_GCC
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                index = 2_usize * index + static_cast<usize>(m_keys[index] < key);
+            }
+
+            // the search path went right at each trailing one bit of `index`, and left once
+            // before those; the lower bound is the node at which it went left
+            return index >> static_cast<usize>(std::countr_one(index) + 1);
+        }
+    };
+
+    /// @brief Returns a `search_table` mapping the `first` `Value` of each `Pair` in `pairs`
+    /// to the corresponding `second` `Value`.
+    ///
+    /// The key type of the table is the common type of the `first` values, and the value
+    /// type is the common type of the `second` values.
+    ///
+    /// # Requirements
+    /// - Each element of `pairs` must be an `mpl::Pair` of two `MetaValue`s
+    /// - The `first` values must be distinct
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// static constexpr auto field_ids = make_search_table(
+    ///     List<Pair<Value<100>, Value<0>>,
+    ///          Pair<Value<7>, Value<1>>,
+    ///          Pair<Value<42>, Value<2>>>{});
+    /// static_assert(field_ids.value_or(42, -1) == 2);
+    /// static_assert(field_ids.value_or(8, -1) == -1);
+    /// @endcode
+    ///
+    /// @tparam TPairs The `Pair`s of keys and values
+    /// @param pairs The `List` of key-value `Pair`s
+    /// @return A `search_table` holding the key-value pairs in `pairs`
+    /// @ingroup search_table
+    /// @headerfile hyperion/mpl/search_table.h
+    template<typename... TPairs>
+        requires(sizeof...(TPairs) != 0) && (detail::value_pair<TPairs> && ...)
+                && (detail::all_distinct<std::common_type_t<detail::pair_key_t<TPairs>...>>(
+                    TPairs::first::value...))
+    [[nodiscard]] constexpr auto
+    make_search_table([[maybe_unused]] List<TPairs...> pairs) noexcept {
+        using key_type = std::common_type_t<detail::pair_key_t<TPairs>...>;
+        using mapped_type = std::common_type_t<detail::pair_mapped_t<TPairs>...>;
+        using entry = std::pair<key_type, mapped_type>;
+
+        return search_table<key_type, mapped_type, sizeof...(TPairs)>{
+            std::array<entry, sizeof...(TPairs)>{entry{static_cast<key_type>(TPairs::first::value),
+                                                       static_cast<mapped_type>(
+                                                           TPairs::second::value)}...}};
+    }
+
+    namespace _test::search_table {
+        template<typename TList>
+        concept can_make_search_table = requires { make_search_table(TList{}); };
+
+        static constexpr auto table = make_search_table(List<Pair<Value<40>, Value<4>>,
+                                                             Pair<Value<10>, Value<1>>,
+                                                             Pair<Value<70>, Value<7>>,
+                                                             Pair<Value<20>, Value<2>>,
+                                                             Pair<Value<60>, Value<6>>,
+                                                             Pair<Value<30>, Value<3>>,
+                                                             Pair<Value<50>, Value<5>>>{});
+
+        [[nodiscard]] constexpr auto test_find_all() noexcept -> bool {
+            for(auto key = 10; key <= 70; key += 10) {
+                const auto* value = table.find(key);
+                if(value == nullptr || *value != key / 10) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        [[nodiscard]] constexpr auto test_find_missing() noexcept -> bool {
+            for(auto key = 0; key <= 80; key += 10) {
+                if(table.contains(key + 5) || table.contains(key - 5)) {
+                    return false;
+                }
+            }
+            return not table.contains(0) && not table.contains(80);
+        }
+
+        static_assert(table.size() == 7, "hyperion::mpl::search_table::size test case 1 (failing)");
+        static_assert(test_find_all(), "hyperion::mpl::search_table::find test case 1 (failing)");
+        static_assert(test_find_missing(),
+                      "hyperion::mpl::search_table::find test case 2 (failing)");
+        static_assert(table.value_or(35, -1) == -1,
+                      "hyperion::mpl::search_table::value_or test case 1 (failing)");
+        static_assert(std::same_as<decltype(table.value_or(35, -1)), int>,
+                      "hyperion::mpl::search_table::value_or test case 2 (failing)");
+        static_assert(*make_search_table(List<Pair<Value<1U>, Value<'a'>>>{}).find(1U) == 'a',
+                      "hyperion::mpl::make_search_table test case 1 (failing)");
+        static_assert(not can_make_search_table<
+                          List<Pair<Value<1>, Value<1>>, Pair<Value<1>, Value<2>>>>,
+                      "hyperion::mpl::make_search_table test case 2 (failing)");
+        static_assert(not can_make_search_table<List<Pair<int, Value<1>>>>,
+                      "hyperion::mpl::make_search_table test case 3 (failing)");
+        static_assert(not can_make_search_table<List<>>,
+                      "hyperion::mpl::make_search_table test case 4 (failing)");
+        static_assert(
+            *make_search_table(List<Pair<Value<2>, Value<0.5>>, Pair<Value<1>, Value<0.25>>>{})
+                    .find(1)
+                == 0.25,
+                      "hyperion::mpl::make_search_table test case 5 (failing)");
+    } // namespace _test::search_table
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_SEARCH_TABLE_H
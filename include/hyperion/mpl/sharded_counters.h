@@ -0,0 +1,308 @@
+/// @file sharded_counters.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Per-core sharded metric counters keyed by a `List` of tag types
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/concurrent_layout.h>
+#include <hyperion/mpl/list.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#if HYPERION_PLATFORM_IS_LINUX
+    #include <sched.h>
+#endif // HYPERION_PLATFORM_IS_LINUX
+
+/// @ingroup mpl
+/// @{
+/// @defgroup sharded_counters Sharded Counters
+/// Hyperion provides `mpl::sharded_counters` as a block of metric counters, keyed by an
+/// `mpl::List` of tag types, that is sharded per processor core so that concurrent
+/// increments from different cores never contend on the same cache line.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/sharded_counters.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// struct requests;
+/// struct errors;
+///
+/// auto metrics = sharded_counters<List<requests, errors>>{};
+/// // on any thread
+/// metrics.add<requests>();
+/// metrics.add<errors>(2);
+/// // on the reporting thread
+/// auto totals = metrics.snapshot();
+/// auto request_count = totals.get<requests>();
+/// @endcode
+/// @headerfile hyperion/mpl/sharded_counters.h
+/// @}
+
+#ifndef HYPERION_MPL_SHARDED_COUNTERS_H
+    #define HYPERION_MPL_SHARDED_COUNTERS_H
+
+namespace hyperion::mpl {
+
+    namespace detail {
+        /// @brief Returns the processor core the calling thread is currently running on,
+        /// if supported on the current platform. Otherwise, returns a stable per-thread
+        /// index, assigned round-robin as threads first call this function
+        [[nodiscard]] inline auto current_core() noexcept -> usize {
+    #if HYPERION_PLATFORM_IS_LINUX
+            if(const auto core = sched_getcpu(); core >= 0) {
+                return static_cast<usize>(core);
+            }
+    #endif // HYPERION_PLATFORM_IS_LINUX
+
+            static constinit auto next_index = std::atomic<usize>{0_usize};
+            thread_local const auto index = next_index.fetch_add(1_usize,
+                                                                 std::memory_order_relaxed);
+            return index;
+        }
+    } // namespace detail
+
+    /// @brief A snapshot of the totals of each of the counters of a `sharded_counters`
+    ///
+    /// @tparam TTags The `List` of metric tags
+    /// @ingroup sharded_counters
+    /// @headerfile hyperion/mpl/sharded_counters.h
+    template<typename TTags>
+    class counter_snapshot;
+
+    template<typename... TTags>
+        requires detail::unique_types<TTags...>
+    class counter_snapshot<List<TTags...>> {
+      public:
+        /// @brief Constructs a `counter_snapshot` from the totals of each counter, in the
+        /// order of `TTags`
+        /// @param totals The totals of each counter
+        constexpr explicit counter_snapshot(const std::array<u64, sizeof...(TTags)>& totals)
+            : m_totals{totals} {
+        }
+
+        /// @brief Returns the index of the counter for `TTag`
+        /// @return the index of the counter for `TTag`
+        template<typename TTag>
+            requires(detail::count_of_type<TTag, TTags...> == 1_usize)
+        [[nodiscard]] static constexpr auto index_of() noexcept -> usize {
+            return detail::index_of_type<TTag, TTags...>;
+        }
+
+        /// @brief Returns the total of the counter for `TTag`
+        /// @return the total of the counter for `TTag`
+        template<typename TTag>
+            requires(detail::count_of_type<TTag, TTags...> == 1_usize)
+        [[nodiscard]] constexpr auto get() const noexcept -> u64 {
+            return std::get<index_of<TTag>()>(m_totals);
+        }
+
+        /// @brief Returns the totals of each counter, in the order of `TTags`
+        /// @return the totals of each counter
+        [[nodiscard]] constexpr auto totals() const noexcept
+            -> const std::array<u64, sizeof...(TTags)>& {
+            return m_totals;
+        }
+
+      private:
+        std::array<u64, sizeof...(TTags)> m_totals;
+    };
+
+    /// @brief `sharded_counters` is a block of `u64` metric counters, one per tag type in
+    /// `TTags`, sharded per processor core.
+    ///
+    /// Each shard holds one counter for every tag contiguously, and is aligned and padded to
+    /// `hardware_destructive_interference_size`. Increments add to the shard of the core the
+    /// calling thread is running on, with a relaxed atomic add, so increments from different
+    /// cores never touch the same cache line and no locks are involved. The index of each tag
+    /// within a shard is resolved at compile time.
+    ///
+    /// Reads sum the corresponding counters of every shard. They are not atomic with respect
+    /// to concurrent increments, but every increment that happens-before a read is included.
+    ///
+    /// # Requirements
+    /// - `TTags` must be an `mpl::List` of distinct types. They may be incomplete
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// struct hits;
+    /// struct misses;
+    ///
+    /// auto metrics = sharded_counters<List<hits, misses>>{};
+    /// metrics.add<hits>();
+    /// metrics.add<misses>(3);
+    ///
+    /// // `total_misses` is `3`
+    /// auto total_misses = metrics.get<misses>();
+    /// @endcode
+    ///
+    /// @tparam TTags The `List` of metric tags
+    /// @ingroup sharded_counters
+    /// @headerfile hyperion/mpl/sharded_counters.h
+    template<typename TTags>
+    class sharded_counters;
+
+    template<typename... TTags>
+        requires(sizeof...(TTags) != 0) && detail::unique_types<TTags...>
+    class sharded_counters<List<TTags...>> {
+      public:
+        /// @brief The type of a snapshot of the totals of this block's counters
+        using snapshot_type = counter_snapshot<List<TTags...>>;
+
+        /// @brief Constructs a `sharded_counters` with one shard per hardware thread
+        sharded_counters() : sharded_counters(std::thread::hardware_concurrency()) {
+        }
+
+        /// @brief Constructs a `sharded_counters` with (at least) `shards` shards
+        ///
+        /// The number of shards is rounded up to a power of two.
+        ///
+        /// @param shards The minimum number of shards
+        explicit sharded_counters(usize shards)
+            : m_shards(std::bit_ceil(std::max(shards, 1_usize))) {
+        }
+
+        /// @brief Returns the number of shards
+        /// @return the number of shards
+        [[nodiscard]] auto shard_count() const noexcept -> usize {
+            return m_shards.size();
+        }
+
+        /// @brief Returns the index of the counter for `TTag` within each shard
+        /// @return the index of the counter for `TTag`
+        template<typename TTag>
+            requires(detail::count_of_type<TTag, TTags...> == 1_usize)
+        [[nodiscard]] static constexpr auto index_of() noexcept -> usize {
+            return snapshot_type::template index_of<TTag>();
+        }
+
+        /// @brief Adds `amount` to the counter for `TTag` in the calling core's shard
+        /// @param amount The amount to add
+        template<typename TTag>
+            requires(detail::count_of_type<TTag, TTags...> == 1_usize)
+        auto add(u64 amount = 1_u64) noexcept -> void {
+            std::get<index_of<TTag>()>(local_shard().counters)
+                .fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        /// @brief Returns the total of the counter for `TTag` across all shards
+        /// @return the total of the counter for `TTag`
+        template<typename TTag>
+            requires(detail::count_of_type<TTag, TTags...> == 1_usize)
+        [[nodiscard]] auto get() const noexcept -> u64 {
+            auto total = 0_u64;
+            for(const auto& current : m_shards) {
+                total += std::get<index_of<TTag>()>(current.counters)
+                             .load(std::memory_order_relaxed);
+            }
+            return total;
+        }
+
+        /// @brief Returns the totals of every counter across all shards
+        ///
+        /// Each shard's counters are loaded into a contiguous buffer, then added to the
+        /// running totals with a single element-wise pass, which the compiler can vectorize.
+        ///
+        /// @return the totals of every counter
+        [[nodiscard]] auto snapshot() const noexcept -> snapshot_type {
+            auto totals = std::array<u64, sizeof...(TTags)>{};
+            auto values = std::array<u64, sizeof...(TTags)>{};
+            for(const auto& current : m_shards) {
+                std::ranges::transform(current.counters,
+                                       values.begin(),
+                                       [](const std::atomic<u64>& counter) noexcept {
+                                           return counter.load(std::memory_order_relaxed);
+                                       });
+                std::ranges::transform(totals, values, totals.begin(), std::plus<>{});
+            }
+            return snapshot_type{totals};
+        }
+
+        /// @brief Resets every counter in every shard to zero.
+        ///
+        /// Increments concurrent with a reset may or may not be included in later reads
+        auto reset() noexcept -> void {
+            for(auto& current : m_shards) {
+                for(auto& counter : current.counters) {
+                    counter.store(0_u64, std::memory_order_relaxed);
+                }
+            }
+        }
+
+      private:
+        struct alignas(hardware_destructive_interference_size) shard {
+            std::array<std::atomic<u64>, sizeof...(TTags)> counters = {};
+        };
+
+        std::vector<shard> m_shards;
+
+        [[nodiscard]] auto local_shard() noexcept -> shard& {
+            // the shard count is a power of two, so this is `core % shard_count()`
+            return m_shards[detail::current_core() & (m_shards.size() - 1_usize)];
+        }
+    };
+
+    namespace _test::sharded_counters {
+        struct hits;
+        struct misses;
+        struct evictions;
+
+        using metrics = mpl::sharded_counters<List<hits, misses, evictions>>;
+
+        static_assert(metrics::index_of<misses>() == 1_usize,
+                      "hyperion::mpl::sharded_counters test case 1 (failing)");
+        static_assert(metrics::index_of<evictions>() == 2_usize,
+                      "hyperion::mpl::sharded_counters test case 2 (failing)");
+        static_assert(metrics::snapshot_type{{1_u64, 2_u64, 3_u64}}.get<misses>() == 2_u64,
+                      "hyperion::mpl::sharded_counters test case 3 (failing)");
+
+        template<typename TTags>
+        concept valid_tags = requires { typename mpl::sharded_counters<TTags>::snapshot_type; };
+
+        template<typename TTag>
+        concept has_counter = requires(metrics& counters) { counters.add<TTag>(); };
+
+        static_assert(valid_tags<List<hits>>,
+                      "hyperion::mpl::sharded_counters requirements test case 1 (failing)");
+        static_assert(not valid_tags<List<hits, misses, hits>>,
+                      "hyperion::mpl::sharded_counters requirements test case 2 (failing)");
+        static_assert(not valid_tags<List<>>,
+                      "hyperion::mpl::sharded_counters requirements test case 3 (failing)");
+        static_assert(has_counter<hits> && not has_counter<int>,
+                      "hyperion::mpl::sharded_counters requirements test case 4 (failing)");
+    } // namespace _test::sharded_counters
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_SHARDED_COUNTERS_H
@@ -0,0 +1,287 @@
+/// @file spsc_queue.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Bounded, lock-free, single-producer single-consumer queue
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/concurrent_layout.h>
+#include <hyperion/mpl/type.h>
+#include <hyperion/mpl/value.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup spsc_queue Single-Producer Single-Consumer Queue
+/// Hyperion provides `mpl::spsc_queue` as a bounded, lock-free queue for passing
+/// values from exactly one producer thread to exactly one consumer thread.
+/// It is the channel type used to connect the stages of an `mpl::pipeline`.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/spsc_queue.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// auto queue = spsc_queue<int, 64>{};
+/// // on the producer thread
+/// queue.try_push(42);
+/// // on the consumer thread
+/// auto values = std::array<int, 16>{};
+/// auto popped = queue.try_pop_batch(std::span{values});
+/// @endcode
+/// @headerfile hyperion/mpl/spsc_queue.h
+/// @}
+
+#ifndef HYPERION_MPL_SPSC_QUEUE_H
+    #define HYPERION_MPL_SPSC_QUEUE_H
+
+namespace hyperion::mpl {
+
+    namespace detail {
+        /// @brief Move-assigns the values in `source` to the front of `destination`, in order.
+        ///
+        /// If `TType` is trivially copyable, this is a single `std::memcpy` of the underlying
+        /// bytes, rather than an element-wise loop.
+        template<typename TType>
+        auto move_values(std::span<TType> source, std::span<TType> destination) noexcept(
+            std::is_nothrow_move_assignable_v<TType>) -> void {
+            if constexpr(decltype_<TType>().is_trivially_copyable()) {
+                if(not source.empty()) {
+                    std::memcpy(destination.data(), source.data(), source.size_bytes());
+                }
+            }
+            else {
+                std::move(source.begin(), source.end(), destination.begin());
+            }
+        }
+    } // namespace detail
+
+    /// @brief `spsc_queue` is a bounded, lock-free, single-producer single-consumer queue.
+    ///
+    /// Exactly one thread may call the producer-side member functions
+    /// (`try_push`, `try_push_batch`) and exactly one (possibly different) thread may call
+    /// the consumer-side member functions (`try_pop`, `try_pop_batch`) concurrently.
+    /// The producer and consumer indices live on separate cache lines, and each side
+    /// caches the last observed value of the other side's index, so that in steady state
+    /// neither side needs to touch the other's cache line on every operation.
+    /// When `TType` is trivially copyable, the batch operations transfer values with
+    /// `std::memcpy` rather than element-wise move assignment.
+    ///
+    /// # Requirements
+    /// - `TCapacity` must be a non-zero power of two
+    /// - `TType` must be default constructible and move assignable
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// auto queue = spsc_queue<int, 64>{};
+    /// queue.try_push(1);
+    /// queue.try_push(2);
+    ///
+    /// auto values = std::array<int, 4>{};
+    /// // `popped` is `2`, `values` is `{1, 2, 0, 0}`
+    /// auto popped = queue.try_pop_batch(std::span{values});
+    /// @endcode
+    ///
+    /// @tparam TType The type of the values stored in the queue
+    /// @tparam TCapacity The maximum number of values the queue can hold at once
+    /// @ingroup spsc_queue
+    /// @headerfile hyperion/mpl/spsc_queue.h
+    template<typename TType, usize TCapacity>
+        requires(TCapacity != 0 && (TCapacity & (TCapacity - 1)) == 0)
+                && (decltype_<TType>().is_default_constructible().value)
+                && (decltype_<TType>().is_move_assignable().value)
+    class spsc_queue {
+      public:
+        /// @brief The type of the values stored in this queue
+        using value_type = TType;
+
+        /// @brief Returns the maximum number of values this queue can hold at once
+        /// @return the capacity of this queue
+        [[nodiscard]] static constexpr auto capacity() noexcept -> usize {
+            return TCapacity;
+        }
+
+        /// @brief Attempts to push `value` into the queue.
+        ///
+        /// May only be called from the producer thread.
+        ///
+        /// @param value The value to push
+        /// @return whether `value` was pushed. `false` if the queue was full
+        template<typename TValue>
+            requires std::assignable_from<TType&, TValue&&>
+        [[nodiscard]] auto try_push(TValue&& value) noexcept(
+            std::is_nothrow_assignable_v<TType&, TValue&&>) -> bool {
+            const auto tail = m_producer.index.load(std::memory_order_relaxed);
+            if(tail - m_producer.cached_other == TCapacity) {
+                m_producer.cached_other = m_consumer.index.load(std::memory_order_acquire);
+                if(tail - m_producer.cached_other == TCapacity) {
+                    return false;
+                }
+            }
+
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            m_slots[tail & mask] = std::forward<TValue>(value);
+            m_producer.index.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// @brief Attempts to push as many of `values` into the queue as will fit,
+        /// moving from them in order.
+        ///
+        /// May only be called from the producer thread.
+        /// All pushed values are published to the consumer with a single atomic store.
+        ///
+        /// @param values The values to push
+        /// @return The number of values pushed. This is the length of the prefix of `values`
+        /// that has been moved into the queue
+        [[nodiscard]] auto try_push_batch(std::span<TType> values) noexcept(
+            std::is_nothrow_move_assignable_v<TType>) -> usize {
+            const auto tail = m_producer.index.load(std::memory_order_relaxed);
+            if(tail - m_producer.cached_other + values.size() > TCapacity) {
+                m_producer.cached_other = m_consumer.index.load(std::memory_order_acquire);
+            }
+
+            const auto available = TCapacity - (tail - m_producer.cached_other);
+            const auto count = values.size() < available ? values.size() : available;
+            const auto first = tail & mask;
+            const auto until_wrap = TCapacity - first < count ? TCapacity - first : count;
+            const auto slots = std::span<TType>{m_slots};
+            detail::move_values(values.first(until_wrap), slots.subspan(first));
+            detail::move_values(values.subspan(until_wrap, count - until_wrap), slots);
+
+            if(count != 0) {
+                m_producer.index.store(tail + count, std::memory_order_release);
+            }
+            return count;
+        }
+
+        /// @brief Attempts to pop the value at the front of the queue into `out`.
+        ///
+        /// May only be called from the consumer thread.
+        ///
+        /// @param out The location to move the popped value into
+        /// @return whether a value was popped. `false` if the queue was empty
+        [[nodiscard]] auto try_pop(TType& out) noexcept(std::is_nothrow_move_assignable_v<TType>)
+            -> bool {
+            const auto head = m_consumer.index.load(std::memory_order_relaxed);
+            if(head == m_consumer.cached_other) {
+                m_consumer.cached_other = m_producer.index.load(std::memory_order_acquire);
+                if(head == m_consumer.cached_other) {
+                    return false;
+                }
+            }
+
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            out = std::move(m_slots[head & mask]);
+            m_consumer.index.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// @brief Attempts to pop up to `out.size()` values from the front of the queue
+        /// into `out`, in order.
+        ///
+        /// May only be called from the consumer thread.
+        /// The popped slots are released back to the producer with a single atomic store.
+        ///
+        /// @param out The locations to move the popped values into
+        /// @return The number of values popped. This is the length of the prefix of `out`
+        /// that has been written to
+        [[nodiscard]] auto
+        try_pop_batch(std::span<TType> out) noexcept(std::is_nothrow_move_assignable_v<TType>)
+            -> usize {
+            const auto head = m_consumer.index.load(std::memory_order_relaxed);
+            if(m_consumer.cached_other - head < out.size()) {
+                m_consumer.cached_other = m_producer.index.load(std::memory_order_acquire);
+            }
+
+            const auto available = m_consumer.cached_other - head;
+            const auto count = out.size() < available ? out.size() : available;
+            const auto first = head & mask;
+            const auto until_wrap = TCapacity - first < count ? TCapacity - first : count;
+            const auto slots = std::span<TType>{m_slots};
+            detail::move_values(slots.subspan(first, until_wrap), out);
+            detail::move_values(slots.first(count - until_wrap), out.subspan(until_wrap));
+
+            if(count != 0) {
+                m_consumer.index.store(head + count, std::memory_order_release);
+            }
+            return count;
+        }
+
+        /// @brief Returns the number of values in the queue at the time of the call.
+        ///
+        /// The result is only a snapshot, and may be stale by the time it is observed
+        /// if either side of the queue is concurrently active.
+        ///
+        /// @return the approximate number of values in the queue
+        [[nodiscard]] auto size_approx() const noexcept -> usize {
+            const auto head = m_consumer.index.load(std::memory_order_acquire);
+            const auto tail = m_producer.index.load(std::memory_order_acquire);
+            return tail - head;
+        }
+
+      private:
+        static inline constexpr auto mask = TCapacity - 1_usize;
+
+        /// @brief The state owned by one side of the queue: its own index, and its
+        /// cached copy of the other side's index
+        struct alignas(hardware_destructive_interference_size) side {
+            std::atomic<usize> index = 0_usize;
+            usize cached_other = 0_usize;
+        };
+
+        side m_producer;
+        side m_consumer;
+        alignas(hardware_destructive_interference_size) std::array<TType, TCapacity> m_slots = {};
+    };
+
+    namespace _test::spsc_queue {
+        template<usize TCapacity>
+        concept valid_capacity = requires { typename mpl::spsc_queue<int, TCapacity>; };
+
+        static_assert(mpl::spsc_queue<int, 8>::capacity() == 8,
+                      "hyperion::mpl::spsc_queue::capacity test case 1 (failing)");
+        static_assert(alignof(mpl::spsc_queue<int, 8>) == hardware_destructive_interference_size,
+                      "hyperion::mpl::spsc_queue layout test case 1 (failing)");
+        static_assert(valid_capacity<8>,
+                      "hyperion::mpl::spsc_queue capacity requirement test case 1 (failing)");
+        static_assert(not valid_capacity<6>,
+                      "hyperion::mpl::spsc_queue capacity requirement test case 2 (failing)");
+        static_assert(not valid_capacity<0>,
+                      "hyperion::mpl::spsc_queue capacity requirement test case 3 (failing)");
+    } // namespace _test::spsc_queue
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_SPSC_QUEUE_H
@@ -0,0 +1,905 @@
+/// @file static_vector.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Fixed-capacity, `constexpr` vector with inline storage
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/type.h>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup static_vector Static Vectors
+/// Hyperion provides `mpl::static_vector` as a fixed-capacity, `constexpr` vector whose
+/// elements are stored inline, for small buffers that must never allocate.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/static_vector.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// constexpr auto squares = [] {
+///     auto values = static_vector<int, 8>{};
+///     for(auto value = 1; value <= 4; ++value) {
+///         values.push_back(value * value);
+///     }
+///     values.erase(values.begin());
+///     return values;
+/// }();
+///
+/// static_assert(squares.size() == 3);
+/// static_assert(squares[0] == 4);
+/// @endcode
+/// @headerfile hyperion/mpl/static_vector.h
+/// @}
+
+#ifndef HYPERION_MPL_STATIC_VECTOR_H
+    #define HYPERION_MPL_STATIC_VECTOR_H
+
+namespace hyperion::mpl {
+
+    /// @brief How a `static_vector` handles operations that would exceed its capacity, or
+    /// that access an element out of bounds.
+    /// @ingroup static_vector
+    /// @headerfile hyperion/mpl/static_vector.h
+    enum class bounds_policy : u8 {
+        /// @brief Insertions into a full `static_vector` throw `std::length_error`, and
+        /// `at` with an out-of-bounds index throws `std::out_of_range`
+        checked,
+        /// @brief Insertions into a full `static_vector`, and `at` with an out-of-bounds
+        /// index, are undefined behavior
+        unchecked,
+    };
+
+    namespace detail {
+        /// @brief The smallest unsigned integer type that can represent every value in
+        /// `[0, TMaxValue]`
+        template<usize TMaxValue>
+        using smallest_unsigned_t = std::conditional_t<
+            (TMaxValue <= std::numeric_limits<u8>::max()),
+            u8,
+            std::conditional_t<(TMaxValue <= std::numeric_limits<u16>::max()),
+                               u16,
+                               std::conditional_t<(TMaxValue <= std::numeric_limits<u32>::max()),
+                                                  u32,
+                                                  u64>>>;
+
+        /// @brief Whether `static_vector<TType, ...>` stores its elements in a plain,
+        /// value-initialized `std::array`, making it trivially copyable and usable as the
+        /// value of a `constexpr` variable
+        ///
+        /// Elements are assigned into the array, so `TType` must be trivially copy
+        /// assignable, and its default constructor must be `noexcept` (e.g.
+        /// `std::string_view`) since every slot is constructed up front.
+        template<typename TType>
+        concept static_vector_plain = decltype_<TType>().is_trivially_copyable().value
+                                      && decltype_<TType>().is_trivially_copy_assignable().value
+                                      && std::is_nothrow_default_constructible_v<TType>;
+
+        /// @brief The element storage of a `static_vector` of trivial elements:
+        /// a value-initialized array
+        template<typename TType, usize TCapacity, bool TPlain = static_vector_plain<TType>>
+        struct static_vector_storage {
+            using iterator = TType*;
+            using const_iterator = const TType*;
+
+            std::array<TType, TCapacity> m_values = {};
+
+            [[nodiscard]] constexpr auto storage_begin() noexcept -> iterator {
+                return m_values.data();
+            }
+
+            [[nodiscard]] constexpr auto storage_begin() const noexcept -> const_iterator {
+                return m_values.data();
+            }
+        };
+
+        /// @brief The storage for one non-trivial element of a `static_vector`, which is not
+        /// constructed until the element is inserted
+        ///
+        /// Each element gets its own union, rather than sharing one union around the whole
+        /// array, so that inserting an element during constant evaluation constructs an
+        /// active union member, instead of a subobject of an inactive one.
+        template<typename TType>
+        union static_vector_slot {
+            TType value;
+
+            constexpr static_vector_slot() noexcept { // NOLINT(*-member-init)
+            }
+            constexpr ~static_vector_slot() noexcept { // NOLINT(*-use-equals-default)
+            }
+        };
+
+        /// @brief The iterator over the elements of a `static_vector` of non-trivial
+        /// elements
+        ///
+        /// Steps from slot to slot, since pointer arithmetic from the element in one slot
+        /// into the next is not allowed during constant evaluation.
+        ///
+        /// @tparam TType The type of the elements, `const`-qualified for a `const_iterator`
+        template<typename TType>
+        class static_vector_iterator {
+          private:
+            using slot = std::conditional_t<std::is_const_v<TType>,
+                                            const static_vector_slot<std::remove_const_t<TType>>,
+                                            static_vector_slot<TType>>;
+
+            template<typename TOther>
+            friend class static_vector_iterator;
+
+          public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::remove_const_t<TType>;
+            using difference_type = isize;
+            using pointer = TType*;
+            using reference = TType&;
+
+            constexpr static_vector_iterator() noexcept = default;
+
+            constexpr explicit static_vector_iterator(slot* current) noexcept
+                : m_current{current} {
+            }
+
+            /// @brief Converts an `iterator` to a `const_iterator`
+            template<typename TOther>
+                requires std::is_const_v<TType> && std::same_as<TOther, value_type>
+            constexpr static_vector_iterator( // NOLINT(*-explicit-conversions)
+                static_vector_iterator<TOther> other) noexcept
+                : m_current{other.m_current} {
+            }
+
+            [[nodiscard]] constexpr auto operator*() const noexcept -> reference {
+                return m_current->value;
+            }
+
+            [[nodiscard]] constexpr auto operator->() const noexcept -> pointer {
+                return std::addressof(m_current->value);
+            }
+
+            [[nodiscard]] constexpr auto
+            operator[](difference_type offset) const noexcept -> reference {
+                return m_current[offset].value;
+            }
+
+            constexpr auto operator++() noexcept -> static_vector_iterator& {
+                ++m_current;
+                return *this;
+            }
+
+            constexpr auto operator++(int) noexcept -> static_vector_iterator {
+                auto copy = *this;
+                ++m_current;
+                return copy;
+            }
+
+            constexpr auto operator--() noexcept -> static_vector_iterator& {
+                --m_current;
+                return *this;
+            }
+
+            constexpr auto operator--(int) noexcept -> static_vector_iterator {
+                auto copy = *this;
+                --m_current;
+                return copy;
+            }
+
+            constexpr auto operator+=(difference_type offset) noexcept -> static_vector_iterator& {
+                m_current += offset;
+                return *this;
+            }
+
+            constexpr auto operator-=(difference_type offset) noexcept -> static_vector_iterator& {
+                m_current -= offset;
+                return *this;
+            }
+
+            [[nodiscard]] friend constexpr auto
+            operator+(static_vector_iterator iter, difference_type offset) noexcept
+                -> static_vector_iterator {
+                return iter += offset;
+            }
+
+            [[nodiscard]] friend constexpr auto
+            operator+(difference_type offset, static_vector_iterator iter) noexcept
+                -> static_vector_iterator {
+                return iter += offset;
+            }
+
+            [[nodiscard]] friend constexpr auto
+            operator-(static_vector_iterator iter, difference_type offset) noexcept
+                -> static_vector_iterator {
+                return iter -= offset;
+            }
+
+            [[nodiscard]] friend constexpr auto
+            operator-(static_vector_iterator lhs, static_vector_iterator rhs) noexcept
+                -> difference_type {
+                return lhs.m_current - rhs.m_current;
+            }
+
+            [[nodiscard]] friend constexpr auto
+            operator==(static_vector_iterator lhs, static_vector_iterator rhs) noexcept
+                -> bool = default;
+
+            [[nodiscard]] friend constexpr auto
+            operator<=>(static_vector_iterator lhs, static_vector_iterator rhs) noexcept = default;
+
+          private:
+            slot* m_current = nullptr;
+        };
+
+        /// @brief The element storage of a `static_vector` of non-trivial elements:
+        /// an array of slots whose elements are not constructed until they are inserted
+        template<typename TType, usize TCapacity>
+        struct static_vector_storage<TType, TCapacity, false> {
+            static_assert(sizeof(static_vector_slot<TType>) == sizeof(TType),
+                          "hyperion::mpl::static_vector slots must be laid out like elements");
+
+            using iterator = static_vector_iterator<TType>;
+            using const_iterator = static_vector_iterator<const TType>;
+
+            std::array<static_vector_slot<TType>, TCapacity> m_slots;
+
+            constexpr static_vector_storage() noexcept = default;
+            constexpr static_vector_storage(const static_vector_storage&) noexcept { // NOLINT
+            }
+            constexpr static_vector_storage(static_vector_storage&&) noexcept { // NOLINT
+            }
+            constexpr ~static_vector_storage() noexcept = default;
+
+            [[nodiscard]] constexpr auto storage_begin() noexcept -> iterator {
+                return iterator{m_slots.data()};
+            }
+
+            [[nodiscard]] constexpr auto storage_begin() const noexcept -> const_iterator {
+                return const_iterator{m_slots.data()};
+            }
+        };
+    } // namespace detail
+
+    /// @brief `static_vector` is a vector of up to `TCapacity` elements of type `TType`,
+    /// stored inline.
+    ///
+    /// `static_vector` is usable in `constexpr` contexts. Its size is stored in the smallest
+    /// unsigned integer type that can represent `TCapacity`.
+    ///
+    /// If `TType` is trivially copyable, trivially copy assignable, and `noexcept` default
+    /// constructible, elements are stored in a value-initialized `std::array`, and the
+    /// `static_vector` is itself trivially copyable, so it is copied and moved with a single
+    /// `std::memcpy`, and element shifts in `insert` and `erase` use `std::memmove` outside
+    /// of constant evaluation. Otherwise, each element is stored in its own slot, left
+    /// uninitialized until the element is inserted and destroyed when it is removed, and
+    /// iterators step from slot to slot, so that elements can be inserted and iterated over
+    /// during constant evaluation.
+    ///
+    /// # Requirements
+    /// - `TType` must be a non-`const` object type
+    /// - `TCapacity` must be non-zero
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// auto names = static_vector<std::string, 4>{"b", "c"};
+    /// names.insert(names.begin(), "a");
+    /// names.pop_back();
+    /// // `names` is `{"a", "b"}`
+    /// @endcode
+    ///
+    /// @tparam TType The type of the elements
+    /// @tparam TCapacity The maximum number of elements
+    /// @tparam TPolicy How operations exceeding capacity or bounds are handled
+    /// @ingroup static_vector
+    /// @headerfile hyperion/mpl/static_vector.h
+    template<typename TType, usize TCapacity, bounds_policy TPolicy = bounds_policy::checked>
+        requires(std::is_object_v<TType>) && (!decltype_<TType>().is_const().value)
+                && (TCapacity != 0)
+    class static_vector : private detail::static_vector_storage<TType, TCapacity> {
+      private:
+        using storage = detail::static_vector_storage<TType, TCapacity>;
+        using storage::storage_begin;
+
+        static inline constexpr auto plain = detail::static_vector_plain<TType>;
+
+      public:
+        using value_type = TType;
+        using size_type = detail::smallest_unsigned_t<TCapacity>;
+        using difference_type = isize;
+        using reference = TType&;
+        using const_reference = const TType&;
+        using pointer = TType*;
+        using const_pointer = const TType*;
+        using iterator = typename storage::iterator;
+        using const_iterator = typename storage::const_iterator;
+
+        /// @brief Constructs an empty `static_vector`
+        constexpr static_vector() noexcept = default;
+
+        /// @brief Constructs a `static_vector` containing copies of the elements of `values`
+        /// @param values The elements to copy
+        constexpr static_vector(std::initializer_list<TType> values) {
+            if(values.size() > TCapacity) {
+                length_error();
+            }
+            unchecked_append(values.begin(), values.end());
+        }
+
+        constexpr static_vector(const static_vector& other) noexcept(
+            std::is_nothrow_copy_constructible_v<TType>)
+            requires plain
+        = default;
+
+        constexpr static_vector(const static_vector& other) noexcept(
+            std::is_nothrow_copy_constructible_v<TType>)
+            requires(!plain)
+            : storage{} {
+            unchecked_append(other.begin(), other.end());
+        }
+
+        constexpr static_vector(static_vector&& other) noexcept(
+            std::is_nothrow_move_constructible_v<TType>)
+            requires plain
+        = default;
+
+        constexpr static_vector(static_vector&& other) noexcept(
+            std::is_nothrow_move_constructible_v<TType>)
+            requires(!plain)
+            : storage{} {
+            unchecked_append(std::make_move_iterator(other.begin()),
+                             std::make_move_iterator(other.end()));
+        }
+
+        constexpr ~static_vector() noexcept
+            requires plain
+        = default;
+
+        constexpr ~static_vector() noexcept
+            requires(!plain)
+        {
+            clear();
+        }
+
+        constexpr auto operator=(const static_vector& other) noexcept(
+            std::is_nothrow_copy_constructible_v<TType>) -> static_vector&
+            requires plain
+        = default;
+
+        constexpr auto operator=(const static_vector& other) noexcept(
+            std::is_nothrow_copy_constructible_v<TType>) -> static_vector&
+            requires(!plain)
+        {
+            if(this != &other) {
+                clear();
+                for(const auto& value : other) {
+                    unchecked_emplace_back(value);
+                }
+            }
+            return *this;
+        }
+
+        constexpr auto operator=(static_vector&& other) noexcept(
+            std::is_nothrow_move_constructible_v<TType>) -> static_vector&
+            requires plain
+        = default;
+
+        constexpr auto operator=(static_vector&& other) noexcept(
+            std::is_nothrow_move_constructible_v<TType>) -> static_vector&
+            requires(!plain)
+        {
+            if(this != &other) {
+                clear();
+                for(auto& value : other) {
+                    unchecked_emplace_back(std::move(value));
+                }
+            }
+            return *this;
+        }
+
+        /// @brief Returns the maximum number of elements
+        /// @return `TCapacity`
+        [[nodiscard]] static constexpr auto capacity() noexcept -> size_type {
+            return static_cast<size_type>(TCapacity);
+        }
+
+        /// @brief Returns the maximum number of elements
+        /// @return `TCapacity`
+        [[nodiscard]] static constexpr auto max_size() noexcept -> size_type {
+            return capacity();
+        }
+
+        /// @brief Returns the number of elements
+        /// @return the number of elements
+        [[nodiscard]] constexpr auto size() const noexcept -> size_type {
+            return m_size;
+        }
+
+        /// @brief Returns whether this `static_vector` has no elements
+        /// @return whether this is empty
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+            return m_size == 0;
+        }
+
+        /// @brief Returns whether this `static_vector` is at capacity
+        /// @return whether this is full
+        [[nodiscard]] constexpr auto full() const noexcept -> bool {
+            return m_size == TCapacity;
+        }
+
+        /// @brief Returns a pointer to the first element
+        ///
+        /// Non-trivial elements are stored in slots laid out like a `TType[TCapacity]`, but
+        /// stepping from one to the next through this pointer is only valid outside of
+        /// constant evaluation; use the iterators during constant evaluation instead.
+        ///
+        /// @return a pointer to the first element
+        [[nodiscard]] constexpr auto data() noexcept -> pointer {
+            return std::addressof(*begin());
+        }
+
+        /// @brief Returns a pointer to the first element
+        ///
+        /// Non-trivial elements are stored in slots laid out like a `TType[TCapacity]`, but
+        /// stepping from one to the next through this pointer is only valid outside of
+        /// constant evaluation; use the iterators during constant evaluation instead.
+        ///
+        /// @return a pointer to the first element
+        [[nodiscard]] constexpr auto data() const noexcept -> const_pointer {
+            return std::addressof(*begin());
+        }
+
+        [[nodiscard]] constexpr auto begin() noexcept -> iterator {
+            return storage_begin();
+        }
+
+        [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator {
+            return storage_begin();
+        }
+
+        [[nodiscard]] constexpr auto end() noexcept -> iterator {
+            return begin() + m_size;
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept -> const_iterator {
+            return begin() + m_size;
+        }
+
+        /// @brief Returns the element at `index`, without bounds checking
+        ///
+        /// # Requirements
+        /// - `index` must be less than `size()`
+        ///
+        /// @param index The index of the element
+        /// @return a reference to the element
+        [[nodiscard]] constexpr auto operator[](usize index) noexcept -> reference {
+            return begin()[index];
+        }
+
+        /// @brief Returns the element at `index`, without bounds checking
+        ///
+        /// # Requirements
+        /// - `index` must be less than `size()`
+        ///
+        /// @param index The index of the element
+        /// @return a reference to the element
+        [[nodiscard]] constexpr auto operator[](usize index) const noexcept -> const_reference {
+            return begin()[index];
+        }
+
+        /// @brief Returns the element at `index`, checking bounds according to `TPolicy`
+        /// @param index The index of the element
+        /// @return a reference to the element
+        /// @throws std::out_of_range if `TPolicy` is `bounds_policy::checked` and `index` is
+        /// not less than `size()`
+        [[nodiscard]] constexpr auto at(usize index) -> reference {
+            check_index(index);
+            return begin()[index];
+        }
+
+        /// @brief Returns the element at `index`, checking bounds according to `TPolicy`
+        /// @param index The index of the element
+        /// @return a reference to the element
+        /// @throws std::out_of_range if `TPolicy` is `bounds_policy::checked` and `index` is
+        /// not less than `size()`
+        [[nodiscard]] constexpr auto at(usize index) const -> const_reference {
+            check_index(index);
+            return begin()[index];
+        }
+
+        [[nodiscard]] constexpr auto front() noexcept -> reference {
+            return begin()[0];
+        }
+
+        [[nodiscard]] constexpr auto front() const noexcept -> const_reference {
+            return begin()[0];
+        }
+
+        [[nodiscard]] constexpr auto back() noexcept -> reference {
+            return begin()[m_size - 1];
+        }
+
+        [[nodiscard]] constexpr auto back() const noexcept -> const_reference {
+            return begin()[m_size - 1];
+        }
+
+        /// @brief Constructs an element from `args` at the end
+        /// @param args The arguments to construct the element from
+        /// @return a reference to the new element
+        /// @throws std::length_error if `TPolicy` is `bounds_policy::checked` and this is full
+        template<typename... TArgs>
+            requires std::constructible_from<TType, TArgs&&...>
+        constexpr auto emplace_back(TArgs&&... args) -> reference {
+            if(full()) {
+                length_error();
+            }
+            return unchecked_emplace_back(std::forward<TArgs>(args)...);
+        }
+
+        /// @brief Appends a copy of `value`
+        /// @param value The value to append
+        /// @throws std::length_error if `TPolicy` is `bounds_policy::checked` and this is full
+        constexpr auto push_back(const TType& value) -> void {
+            emplace_back(value);
+        }
+
+        /// @brief Appends `value`
+        /// @param value The value to append
+        /// @throws std::length_error if `TPolicy` is `bounds_policy::checked` and this is full
+        constexpr auto push_back(TType&& value) -> void {
+            emplace_back(std::move(value));
+        }
+
+        /// @brief Constructs an element from `args` at the end, if this is not full
+        /// @param args The arguments to construct the element from
+        /// @return a pointer to the new element, or `nullptr` if this was full
+        template<typename... TArgs>
+            requires std::constructible_from<TType, TArgs&&...>
+        constexpr auto try_emplace_back(TArgs&&... args) noexcept(
+            std::is_nothrow_constructible_v<TType, TArgs&&...>) -> pointer {
+            if(full()) {
+                return nullptr;
+            }
+            return std::addressof(unchecked_emplace_back(std::forward<TArgs>(args)...));
+        }
+
+        /// @brief Removes the last element
+        ///
+        /// # Requirements
+        /// - This must not be empty
+        constexpr auto pop_back() noexcept -> void {
+            --m_size;
+            destroy(begin() + m_size, begin() + m_size + 1);
+        }
+
+        /// @brief Constructs an element from `args` before `position`, shifting the elements
+        /// from `position` onwards back by one
+        /// @param position The position to insert the element at
+        /// @param args The arguments to construct the element from
+        /// @return an iterator to the new element
+        /// @throws std::length_error if `TPolicy` is `bounds_policy::checked` and this is full
+        template<typename... TArgs>
+            requires std::constructible_from<TType, TArgs&&...>
+                     && std::is_nothrow_move_constructible_v<TType>
+                     && std::is_nothrow_move_assignable_v<TType>
+        constexpr auto emplace(const_iterator position, TArgs&&... args) -> iterator {
+            if(full()) {
+                length_error();
+            }
+
+            const auto index = static_cast<usize>(position - begin());
+            if(index == m_size) {
+                unchecked_emplace_back(std::forward<TArgs>(args)...);
+                return begin() + index;
+            }
+
+            // construct first, in case `args` refers to an element of this
+            auto value = TType(std::forward<TArgs>(args)...);
+            if constexpr(plain) {
+                if(!std::is_constant_evaluated()) {
+                    std::memmove(data() + index + 1,
+                                 data() + index,
+                                 (m_size - index) * sizeof(TType));
+                    ++m_size;
+                    data()[index] = std::move(value);
+                    return data() + index;
+                }
+            }
+
+            unchecked_emplace_back(std::move(back()));
+            std::move_backward(begin() + index, end() - 2, end() - 1);
+            begin()[index] = std::move(value);
+            return begin() + index;
+        }
+
+        /// @brief Inserts a copy of `value` before `position`
+        /// @param position The position to insert the element at
+        /// @param value The value to insert
+        /// @return an iterator to the new element
+        /// @throws std::length_error if `TPolicy` is `bounds_policy::checked` and this is full
+        constexpr auto insert(const_iterator position, const TType& value) -> iterator {
+            return emplace(position, value);
+        }
+
+        /// @brief Inserts `value` before `position`
+        /// @param position The position to insert the element at
+        /// @param value The value to insert
+        /// @return an iterator to the new element
+        /// @throws std::length_error if `TPolicy` is `bounds_policy::checked` and this is full
+        constexpr auto insert(const_iterator position, TType&& value) -> iterator {
+            return emplace(position, std::move(value));
+        }
+
+        /// @brief Removes the elements in `[first, last)`, shifting the following elements
+        /// forward
+        /// @param first The first element to remove
+        /// @param last One past the last element to remove
+        /// @return an iterator to the element following the removed elements
+        constexpr auto erase(const_iterator first, const_iterator last) noexcept(
+            std::is_nothrow_move_assignable_v<TType>) -> iterator {
+            const auto index = static_cast<usize>(first - begin());
+            const auto count = static_cast<usize>(last - first);
+            if(count == 0) {
+                return begin() + index;
+            }
+
+            if constexpr(plain) {
+                if(!std::is_constant_evaluated()) {
+                    std::memmove(data() + index,
+                                 data() + index + count,
+                                 (m_size - index - count) * sizeof(TType));
+                    m_size = static_cast<size_type>(m_size - count);
+                    return data() + index;
+                }
+            }
+
+            const auto new_end = std::move(begin() + index + count, end(), begin() + index);
+            destroy(new_end, end());
+            m_size = static_cast<size_type>(m_size - count);
+            return begin() + index;
+        }
+
+        /// @brief Removes the element at `position`, shifting the following elements forward
+        /// @param position The element to remove
+        /// @return an iterator to the element following the removed element
+        constexpr auto erase(const_iterator position) noexcept(
+            std::is_nothrow_move_assignable_v<TType>) -> iterator {
+            return erase(position, position + 1);
+        }
+
+        /// @brief Resizes this to `count` elements, value-initializing new elements and
+        /// destroying removed ones
+        /// @param count The new number of elements
+        /// @throws std::length_error if `TPolicy` is `bounds_policy::checked` and `count`
+        /// exceeds the capacity
+        constexpr auto resize(usize count) -> void {
+            if(count > TCapacity) {
+                length_error();
+            }
+            if(count < m_size) {
+                destroy(begin() + count, end());
+                m_size = static_cast<size_type>(count);
+            }
+            while(m_size < count) {
+                unchecked_emplace_back();
+            }
+        }
+
+        /// @brief Removes every element
+        constexpr auto clear() noexcept -> void {
+            destroy(begin(), end());
+            m_size = 0;
+        }
+
+        [[nodiscard]] friend constexpr auto
+        operator==(const static_vector& lhs, const static_vector& rhs) noexcept -> bool
+            requires std::equality_comparable<TType>
+        {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+      private:
+        size_type m_size = 0;
+
+        template<typename... TArgs>
+        constexpr auto unchecked_emplace_back(TArgs&&... args) -> reference {
+            auto* element = std::addressof(begin()[m_size]);
+            if constexpr(plain) {
+                *element = TType(std::forward<TArgs>(args)...);
+            }
+            else {
+                std::construct_at(element, std::forward<TArgs>(args)...);
+            }
+            ++m_size;
+            return *element;
+        }
+
+        /// @brief Appends the elements of `[first, last)`, for use in constructors.
+        ///
+        /// The destructor won't run for a constructor that throws, so if constructing an
+        /// element throws, the elements appended so far are destroyed before rethrowing.
+        template<typename TIterator>
+        constexpr auto unchecked_append(TIterator first, TIterator last) -> void {
+            try {
+                for(; first != last; ++first) {
+                    unchecked_emplace_back(*first);
+                }
+            }
+            catch(...) {
+                clear();
+                throw;
+            }
+        }
+
+        static constexpr auto destroy([[maybe_unused]] iterator first,
+                                      [[maybe_unused]] iterator last) noexcept -> void {
+            if constexpr(!plain && !std::is_trivially_destructible_v<TType>) {
+                std::destroy(first, last);
+            }
+        }
+
+        constexpr auto check_index([[maybe_unused]] usize index) const -> void {
+            if constexpr(TPolicy == bounds_policy::checked) {
+                if(index >= m_size) {
+                    throw std::out_of_range{"hyperion::mpl::static_vector index out of range"};
+                }
+            }
+        }
+
+        static constexpr auto length_error() -> void {
+            if constexpr(TPolicy == bounds_policy::checked) {
+                throw std::length_error{"hyperion::mpl::static_vector capacity exceeded"};
+            }
+        }
+    };
+
+    namespace _test::static_vector {
+        using ints = mpl::static_vector<int, 8>;
+
+        static_assert(std::same_as<ints::size_type, u8>,
+                      "hyperion::mpl::static_vector test case 1 (failing)");
+        static_assert(std::same_as<mpl::static_vector<u8, 256>::size_type, u16>,
+                      "hyperion::mpl::static_vector test case 2 (failing)");
+        static_assert(std::is_trivially_copyable_v<ints>,
+                      "hyperion::mpl::static_vector test case 3 (failing)");
+        static_assert(sizeof(mpl::static_vector<u8, 4>) == 5_usize,
+                      "hyperion::mpl::static_vector test case 4 (failing)");
+
+        [[nodiscard]] constexpr auto test_modifiers() -> bool {
+            auto values = ints{1, 2, 3};
+            values.push_back(5);
+            values.insert(values.begin() + 3, 4);
+            values.insert(values.begin(), 0);
+            values.erase(values.begin() + 1);
+            values.pop_back();
+            return values == ints{0, 2, 3, 4};
+        }
+
+        static_assert(test_modifiers(), "hyperion::mpl::static_vector test case 5 (failing)");
+
+        // NOLINTNEXTLINE(*-special-member-functions)
+        struct tracked {
+            int value = 0;
+            int* live = nullptr;
+
+            constexpr tracked(int init, int* counter) noexcept : value{init}, live{counter} {
+                ++*live;
+            }
+            constexpr tracked(const tracked& other) noexcept
+                : value{other.value}, live{other.live} {
+                ++*live;
+            }
+            constexpr auto operator=(const tracked& other) noexcept -> tracked& = default;
+            constexpr ~tracked() noexcept {
+                --*live;
+            }
+        };
+
+        [[nodiscard]] constexpr auto test_lifetimes() -> bool {
+            auto live = 0;
+            auto result = true;
+            {
+                auto values = mpl::static_vector<tracked, 4>{};
+                values.emplace_back(1, &live);
+                values.emplace_back(3, &live);
+                values.emplace(values.begin() + 1, 2, &live);
+                result = result && live == 3 && values[1].value == 2;
+
+                auto copy = values;
+                result = result && live == 6;
+
+                auto sum = 0;
+                for(const auto& value : copy) {
+                    sum += value.value;
+                }
+                result = result && sum == 6 && copy.end() - copy.begin() == 3;
+
+                copy.erase(copy.begin(), copy.begin() + 2);
+                result = result && live == 4 && copy.front().value == 3;
+                values.pop_back();
+                result = result && live == 3;
+            }
+            return result && live == 0;
+        }
+
+        static_assert(test_lifetimes(), "hyperion::mpl::static_vector test case 6 (failing)");
+        static_assert(not std::is_trivially_copyable_v<mpl::static_vector<tracked, 4>>,
+                      "hyperion::mpl::static_vector test case 7 (failing)");
+
+        [[nodiscard]] constexpr auto test_try_emplace() -> bool {
+            auto values = mpl::static_vector<int, 1, bounds_policy::unchecked>{};
+            return values.try_emplace_back(1) != nullptr && values.try_emplace_back(2) == nullptr;
+        }
+
+        static_assert(test_try_emplace(), "hyperion::mpl::static_vector test case 8 (failing)");
+
+        struct constant {
+            const int value = 0;
+        };
+
+        [[nodiscard]] constexpr auto test_const_member() -> bool {
+            auto values = mpl::static_vector<constant, 4>{};
+            values.emplace_back();
+            values.emplace_back(2);
+            values.pop_back();
+            return values.size() == 1_usize && values.front().value == 0;
+        }
+
+        static_assert(test_const_member(), "hyperion::mpl::static_vector test case 9 (failing)");
+        static_assert(not std::is_trivially_copyable_v<mpl::static_vector<constant, 4>>,
+                      "hyperion::mpl::static_vector test case 10 (failing)");
+        static_assert(std::is_trivially_copyable_v<mpl::static_vector<std::string_view, 4>>,
+                      "hyperion::mpl::static_vector test case 11 (failing)");
+        static_assert(
+            std::random_access_iterator<mpl::static_vector<tracked, 4>::iterator>
+                && std::random_access_iterator<mpl::static_vector<tracked, 4>::const_iterator>
+                && std::convertible_to<mpl::static_vector<tracked, 4>::iterator,
+                                       mpl::static_vector<tracked, 4>::const_iterator>,
+            "hyperion::mpl::static_vector test case 12 (failing)");
+
+        static_assert(std::same_as<mpl::detail::smallest_unsigned_t<255>, u8>,
+                      "hyperion::mpl::detail::smallest_unsigned_t test case 1 (failing)");
+        static_assert(std::same_as<mpl::detail::smallest_unsigned_t<256>, u16>,
+                      "hyperion::mpl::detail::smallest_unsigned_t test case 2 (failing)");
+        static_assert(std::same_as<mpl::detail::smallest_unsigned_t<65'536>, u32>,
+                      "hyperion::mpl::detail::smallest_unsigned_t test case 3 (failing)");
+        static_assert(std::same_as<mpl::detail::smallest_unsigned_t<(1_usize << 32U)>, u64>,
+                      "hyperion::mpl::detail::smallest_unsigned_t test case 4 (failing)");
+    } // namespace _test::static_vector
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_STATIC_VECTOR_H
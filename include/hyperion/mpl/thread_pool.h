@@ -0,0 +1,339 @@
+/// @file thread_pool.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Work-stealing thread pool for executing batches of independent jobs
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/concurrent_layout.h>
+#include <hyperion/mpl/list.h>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup thread_pool Work-Stealing Thread Pool
+/// Hyperion provides `mpl::work_stealing_pool` for executing batches of independent jobs
+/// in parallel. It is the default executor for `mpl::List::for_each_parallel`.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/thread_pool.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// auto pool = work_stealing_pool{};
+/// registry_types.for_each_parallel(
+///     [](MetaType auto type) { build_codec_table(type); },
+///     pool,
+///     [](MetaType auto type, std::chrono::nanoseconds elapsed) {
+///         log_init_time(type, elapsed);
+///     });
+/// @endcode
+/// @headerfile hyperion/mpl/thread_pool.h
+/// @}
+
+#ifndef HYPERION_MPL_THREAD_POOL_H
+    #define HYPERION_MPL_THREAD_POOL_H
+
+namespace hyperion::mpl {
+
+    /// @brief `work_stealing_pool` is a fixed-size thread pool that executes batches of
+    /// independent jobs.
+    ///
+    /// Each worker thread owns a job queue. `execute` distributes a batch of jobs
+    /// round-robin across the worker queues, and each worker runs jobs from its own queue
+    /// before stealing jobs from the queues of the other workers, so a worker that finishes
+    /// its share early keeps helping with the rest of the batch. The thread calling `execute`
+    /// also steals and runs jobs until the batch is complete, so `execute` may be called
+    /// from within a job without deadlocking.
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// auto pool = work_stealing_pool{3};
+    /// auto counter = std::atomic<int>{};
+    /// auto increment = [](void* context) noexcept {
+    ///     static_cast<std::atomic<int>*>(context)->fetch_add(1);
+    /// };
+    ///
+    /// auto jobs = std::array{work_stealing_pool::job{increment, &counter},
+    ///                        work_stealing_pool::job{increment, &counter}};
+    /// pool.execute(jobs);
+    /// // `counter` is now `2`
+    /// @endcode
+    ///
+    /// @ingroup thread_pool
+    /// @headerfile hyperion/mpl/thread_pool.h
+    class work_stealing_pool {
+      public:
+        /// @brief A unit of work executed by the pool, invoked as `invoke(context)`
+        struct job {
+            void (*invoke)(void* context) noexcept;
+            void* context;
+        };
+
+        /// @brief Returns the number of worker threads used by a default constructed
+        /// `work_stealing_pool`: one fewer than the number of hardware threads, since the
+        /// thread calling `execute` also runs jobs
+        /// @return The default number of worker threads
+        [[nodiscard]] static auto default_num_workers() noexcept -> usize {
+            const auto hardware_threads = static_cast<usize>(std::thread::hardware_concurrency());
+            return hardware_threads > 1_usize ? hardware_threads - 1_usize : 0_usize;
+        }
+
+        /// @brief Constructs a `work_stealing_pool` with `num_workers` worker threads.
+        ///
+        /// If `num_workers` is zero, `execute` runs every job on the calling thread.
+        /// If a worker thread fails to start, the workers already started are stopped
+        /// and joined before the exception propagates.
+        ///
+        /// @param num_workers The number of worker threads to start
+        explicit work_stealing_pool(usize num_workers = default_num_workers()) {
+            m_queues.reserve(num_workers);
+            for(auto index = 0_usize; index < num_workers; ++index) {
+                m_queues.push_back(std::make_unique<queue>());
+            }
+
+            m_workers.reserve(num_workers);
+            try {
+                for(auto index = 0_usize; index < num_workers; ++index) {
+                    m_workers.emplace_back([this, index]() { work(index); });
+                }
+            }
+            catch(...) {
+                stop();
+                throw;
+            }
+        }
+
+        work_stealing_pool(const work_stealing_pool&) = delete;
+        work_stealing_pool(work_stealing_pool&&) = delete;
+        auto operator=(const work_stealing_pool&) -> work_stealing_pool& = delete;
+        auto operator=(work_stealing_pool&&) -> work_stealing_pool& = delete;
+
+        /// @brief Stops and joins the worker threads.
+        /// No call to `execute` may be in progress.
+        ~work_stealing_pool() noexcept {
+            stop();
+        }
+
+        /// @brief Returns the number of worker threads in this pool
+        /// @return The number of worker threads
+        [[nodiscard]] auto num_workers() const noexcept -> usize {
+            return m_workers.size();
+        }
+
+        /// @brief Executes every job in `jobs`, returning once all of them have completed.
+        ///
+        /// Jobs may run concurrently with each other, in any order, on any of the worker
+        /// threads or the calling thread.
+        ///
+        /// If queueing the jobs fails, the jobs not yet started are withdrawn, and
+        /// `execute` waits for the ones already started to complete before the exception
+        /// propagates. Each job has then either run once or not at all.
+        ///
+        /// @param jobs The jobs to execute
+        auto execute(std::span<const job> jobs) -> void {
+            if(jobs.empty()) {
+                return;
+            }
+
+            if(m_queues.empty()) {
+                for(const auto& work : jobs) {
+                    work.invoke(work.context);
+                }
+                return;
+            }
+
+            auto owner = batch{jobs.size()};
+            const auto num_queues = m_queues.size();
+            const auto first = m_next_queue.fetch_add(1_usize, std::memory_order_relaxed);
+            auto published = 0_usize;
+            try {
+                for(auto offset = 0_usize; offset < num_queues && offset < jobs.size(); ++offset) {
+                    auto& target = *m_queues[(first + offset) % num_queues];
+                    const auto guard = std::scoped_lock{target.lock};
+                    for(auto index = offset; index < jobs.size(); index += num_queues) {
+                        target.tasks.push_back(task{&jobs[index], &owner});
+                        ++published;
+                    }
+                }
+            }
+            catch(...) {
+                withdraw(owner, jobs.size() - published);
+                throw;
+            }
+            signal_workers();
+
+            for(;;) {
+                const auto completed = m_completed_batches.load(std::memory_order_acquire);
+                if(owner.remaining.load(std::memory_order_acquire) == 0_usize) {
+                    break;
+                }
+
+                if(auto stolen = steal(num_queues)) {
+                    run(*stolen);
+                }
+                else {
+                    m_completed_batches.wait(completed, std::memory_order_acquire);
+                }
+            }
+        }
+
+      private:
+        /// @brief Tracks the number of jobs of a single call to `execute`
+        /// that have not yet completed
+        struct batch {
+            std::atomic<usize> remaining;
+        };
+
+        struct task {
+            const job* work;
+            batch* owner;
+        };
+
+        struct alignas(hardware_destructive_interference_size) queue {
+            std::mutex lock;
+            std::deque<task> tasks;
+        };
+
+        std::vector<std::unique_ptr<queue>> m_queues;
+        std::vector<std::thread> m_workers;
+        std::atomic<usize> m_next_queue = 0_usize;
+        /// @brief Incremented whenever new tasks are queued, or the pool is stopping,
+        /// to wake idle workers
+        alignas(hardware_destructive_interference_size) std::atomic<u32> m_generation = 0_u32;
+        /// @brief Incremented whenever a batch completes, to wake the threads waiting in
+        /// `execute`. Lives in the pool rather than the batch so that notifying it can't
+        /// race with the batch going out of scope
+        alignas(hardware_destructive_interference_size) std::atomic<u32> m_completed_batches
+            = 0_u32;
+        std::atomic<bool> m_stopping = false;
+
+        auto signal_workers() noexcept -> void {
+            m_generation.fetch_add(1_u32, std::memory_order_release);
+            m_generation.notify_all();
+        }
+
+        /// @brief Stops and joins the worker threads started so far
+        auto stop() noexcept -> void {
+            m_stopping.store(true, std::memory_order_release);
+            signal_workers();
+            for(auto& worker : m_workers) {
+                worker.join();
+            }
+        }
+
+        /// @brief Removes the still-queued tasks of `owner` from every queue, then waits
+        /// until the tasks of `owner` already taken by other threads have completed
+        /// @param owner The batch whose tasks to withdraw
+        /// @param unpublished The number of tasks of `owner` that were never queued
+        auto withdraw(batch& owner, usize unpublished) noexcept -> void {
+            auto never_run = unpublished;
+            for(auto& target : m_queues) {
+                const auto guard = std::scoped_lock{target->lock};
+                never_run += static_cast<usize>(std::erase_if(
+                    target->tasks,
+                    [&owner](const task& queued) noexcept { return queued.owner == &owner; }));
+            }
+
+            // the batch can't complete, since some of its tasks will never run, so
+            // `m_completed_batches` won't be notified for it and we have to poll
+            while(owner.remaining.load(std::memory_order_acquire) != never_run) {
+                std::this_thread::yield();
+            }
+        }
+
+        auto run(task current) noexcept -> void {
+            current.work->invoke(current.work->context);
+            if(current.owner->remaining.fetch_sub(1_usize, std::memory_order_acq_rel) == 1_usize) {
+                m_completed_batches.fetch_add(1_u32, std::memory_order_release);
+                m_completed_batches.notify_all();
+            }
+        }
+
+        [[nodiscard]] auto pop(usize index) -> std::optional<task> {
+            auto& own = *m_queues[index];
+            const auto guard = std::scoped_lock{own.lock};
+            if(own.tasks.empty()) {
+                return std::nullopt;
+            }
+
+            auto popped = own.tasks.back();
+            own.tasks.pop_back();
+            return popped;
+        }
+
+        /// @brief Steals the oldest task from the first non-empty queue,
+        /// starting at the queue after `thief`
+        [[nodiscard]] auto steal(usize thief) -> std::optional<task> {
+            const auto num_queues = m_queues.size();
+            for(auto offset = 1_usize; offset <= num_queues; ++offset) {
+                auto& victim = *m_queues[(thief + offset) % num_queues];
+                const auto guard = std::scoped_lock{victim.lock};
+                if(not victim.tasks.empty()) {
+                    auto stolen = victim.tasks.front();
+                    victim.tasks.pop_front();
+                    return stolen;
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        auto work(usize index) -> void {
+            for(;;) {
+                const auto generation = m_generation.load(std::memory_order_acquire);
+                if(auto current = pop(index)) {
+                    run(*current);
+                }
+                else if(auto stolen = steal(index)) {
+                    run(*stolen);
+                }
+                else if(m_stopping.load(std::memory_order_acquire)) {
+                    return;
+                }
+                else {
+                    m_generation.wait(generation, std::memory_order_acquire);
+                }
+            }
+        }
+    };
+
+    namespace _test::thread_pool {
+        static_assert(detail::job_executor<work_stealing_pool>,
+                      "hyperion::mpl::work_stealing_pool test case 1 (failing)");
+    } // namespace _test::thread_pool
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_THREAD_POOL_H
@@ -29,6 +29,7 @@
 #include <hyperion/platform/types.h>
 //
 #include <hyperion/mpl/metatypes.h>
+#include <hyperion/mpl/type_traits/std_supplemental.h>
 
 #include <concepts>
 #include <type_traits>
@@ -1575,6 +1576,126 @@ namespace hyperion::mpl {
         template<typename TDelay = type>
         [[nodiscard]] constexpr auto sizeof_() const noexcept
             -> std::enable_if_t<std::same_as<TDelay, type>, Value<sizeof(TDelay), usize>>;
+
+        /// @brief Returns the `alignof` the type `this` `Type` specialization represents,
+        /// as a `Value` specialization.
+        /// @return the `alignof` the type `this` represents, as a `Value` specialization
+        template<typename TDelay = type>
+        [[nodiscard]] constexpr auto alignof_() const noexcept
+            -> std::enable_if_t<std::same_as<TDelay, type>, Value<alignof(TDelay), usize>>;
+
+        /// @brief Returns whether the type `this` `Type` specialization represents is trivially
+        /// copyable, as a `Value` specialization.
+        ///
+        /// Objects of a trivially copyable type can be copied by copying their underlying
+        /// bytes, e.g. with `std::memcpy`.
+        ///
+        /// # Example
+        /// @code {.cpp}
+        /// struct trivially_copyable {
+        ///     int value;
+        /// };
+        /// struct not_trivially_copyable {
+        ///     not_trivially_copyable(const not_trivially_copyable&);
+        /// };
+        ///
+        /// static_assert(decltype_<int>().is_trivially_copyable());
+        /// static_assert(decltype_<trivially_copyable>().is_trivially_copyable());
+        /// static_assert(not decltype_<not_trivially_copyable>().is_trivially_copyable());
+        /// @endcode
+        ///
+        /// @return whether the type `this` represents is trivially copyable, as a
+        /// `Value` specialization
+        template<typename TDelay = type>
+        [[nodiscard]] constexpr auto is_trivially_copyable() const noexcept
+            -> std::enable_if_t<std::same_as<TDelay, type>,
+                                Value<std::is_trivially_copyable_v<TDelay>, bool>>;
+
+        /// @brief Returns whether the type `this` `Type` specialization represents is a
+        /// standard-layout type, as a `Value` specialization.
+        ///
+        /// # Example
+        /// @code {.cpp}
+        /// struct standard_layout {
+        ///     int first;
+        ///     int second;
+        /// };
+        /// struct not_standard_layout {
+        ///     int first;
+        ///   private:
+        ///     int second;
+        /// };
+        ///
+        /// static_assert(decltype_<standard_layout>().is_standard_layout());
+        /// static_assert(not decltype_<not_standard_layout>().is_standard_layout());
+        /// @endcode
+        ///
+        /// @return whether the type `this` represents is a standard-layout type, as a
+        /// `Value` specialization
+        template<typename TDelay = type>
+        [[nodiscard]] constexpr auto is_standard_layout() const noexcept
+            -> std::enable_if_t<std::same_as<TDelay, type>,
+                                Value<std::is_standard_layout_v<TDelay>, bool>>;
+
+        /// @brief Returns whether the type `this` `Type` specialization represents has unique
+        /// object representations, as a `Value` specialization.
+        ///
+        /// Two objects of a type with unique object representations have the same value if and
+        /// only if they have the same underlying bytes, so they can be compared with
+        /// `std::memcmp` and hashed bytewise. Types with padding bits and floating point types do
+        /// not have unique object representations.
+        ///
+        /// # Example
+        /// @code {.cpp}
+        /// struct packed {
+        ///     u32 first;
+        ///     u32 second;
+        /// };
+        /// struct padded {
+        ///     u8 first;
+        ///     u32 second;
+        /// };
+        ///
+        /// static_assert(decltype_<packed>().has_unique_object_representations());
+        /// static_assert(not decltype_<padded>().has_unique_object_representations());
+        /// static_assert(not decltype_<float>().has_unique_object_representations());
+        /// @endcode
+        ///
+        /// @return whether the type `this` represents has unique object representations, as a
+        /// `Value` specialization
+        template<typename TDelay = type>
+        [[nodiscard]] constexpr auto has_unique_object_representations() const noexcept
+            -> std::enable_if_t<std::same_as<TDelay, type>,
+                                Value<std::has_unique_object_representations_v<TDelay>, bool>>;
+
+        /// @brief Returns whether the type `this` `Type` specialization represents is an
+        /// implicit-lifetime type, as a `Value` specialization.
+        ///
+        /// Objects of an implicit-lifetime type are implicitly created by operations such as
+        /// `std::memcpy` and `std::malloc`, so their storage can be populated bytewise.
+        /// Determined as if by `type_traits::is_implicit_lifetime_v<type>`.
+        ///
+        /// # Example
+        /// @code {.cpp}
+        /// struct aggregate {
+        ///     int value;
+        /// };
+        /// struct not_implicit_lifetime {
+        ///     not_implicit_lifetime();
+        ///     ~not_implicit_lifetime();
+        /// };
+        ///
+        /// static_assert(decltype_<int>().is_implicit_lifetime());
+        /// static_assert(decltype_<aggregate>().is_implicit_lifetime());
+        /// static_assert(not decltype_<not_implicit_lifetime>().is_implicit_lifetime());
+        /// @endcode
+        ///
+        /// @return whether the type `this` represents is an implicit-lifetime type, as a
+        /// `Value` specialization
+        template<typename TDelay = type>
+        [[nodiscard]] constexpr auto is_implicit_lifetime() const noexcept
+            -> std::enable_if_t<std::same_as<TDelay, type>,
+                                Value<type_traits::is_implicit_lifetime_v<TDelay>, bool>>;
     };
 
     /// @brief Returns an `mpl::Type` representing the type of the given argument
@@ -2024,6 +2145,45 @@ namespace hyperion::mpl {
         return {};
     }
 
+    template<typename TType>
+    template<typename TDelay>
+    [[nodiscard]] constexpr auto Type<TType>::alignof_() const noexcept
+        -> std::enable_if_t<std::same_as<TDelay, type>, Value<alignof(TDelay), usize>> {
+        return {};
+    }
+
+    template<typename TType>
+    template<typename TDelay>
+    [[nodiscard]] constexpr auto Type<TType>::is_trivially_copyable() const noexcept
+        -> std::enable_if_t<std::same_as<TDelay, type>,
+                            Value<std::is_trivially_copyable_v<TDelay>, bool>> {
+        return {};
+    }
+
+    template<typename TType>
+    template<typename TDelay>
+    [[nodiscard]] constexpr auto Type<TType>::is_standard_layout() const noexcept
+        -> std::enable_if_t<std::same_as<TDelay, type>,
+                            Value<std::is_standard_layout_v<TDelay>, bool>> {
+        return {};
+    }
+
+    template<typename TType>
+    template<typename TDelay>
+    [[nodiscard]] constexpr auto Type<TType>::has_unique_object_representations() const noexcept
+        -> std::enable_if_t<std::same_as<TDelay, type>,
+                            Value<std::has_unique_object_representations_v<TDelay>, bool>> {
+        return {};
+    }
+
+    template<typename TType>
+    template<typename TDelay>
+    [[nodiscard]] constexpr auto Type<TType>::is_implicit_lifetime() const noexcept
+        -> std::enable_if_t<std::same_as<TDelay, type>,
+                            Value<type_traits::is_implicit_lifetime_v<TDelay>, bool>> {
+        return {};
+    }
+
     namespace _test::type {
         constexpr int test_val = 1;
 
@@ -2925,6 +3085,76 @@ namespace hyperion::mpl {
                       "hyperion::mpl::Type::sizeof_ test case 2 (failing)");
         static_assert(decltype_<char>().sizeof_() == 1_usize,
                       "hyperion::mpl::Type::sizeof_ test case 3 (failing)");
+
+        static_assert(decltype_<int>().alignof_() == alignof(int),
+                      "hyperion::mpl::Type::alignof_ test case 1 (failing)");
+        static_assert(decltype_<double>().alignof_() == alignof(double),
+                      "hyperion::mpl::Type::alignof_ test case 2 (failing)");
+        static_assert(decltype_<char>().alignof_() == 1_usize,
+                      "hyperion::mpl::Type::alignof_ test case 3 (failing)");
+
+        struct packed {
+            u32 first;
+            u32 second;
+        };
+
+        struct padded {
+            u8 first;
+            u32 second;
+        };
+
+        // NOLINTNEXTLINE(*-special-member-functions)
+        struct not_trivially_copyable {
+            not_trivially_copyable(const not_trivially_copyable& other);
+        };
+
+        class not_standard_layout {
+          public:
+            int first;
+
+          private:
+            [[maybe_unused]] int second;
+        };
+
+        // NOLINTNEXTLINE(*-special-member-functions)
+        struct not_implicit_lifetime {
+            not_implicit_lifetime();
+            ~not_implicit_lifetime();
+        };
+
+        static_assert(decltype_<int>().is_trivially_copyable(),
+                      "hyperion::mpl::Type::is_trivially_copyable test case 1 (failing)");
+        static_assert(decltype_<padded>().is_trivially_copyable(),
+                      "hyperion::mpl::Type::is_trivially_copyable test case 2 (failing)");
+        static_assert(!decltype_<not_trivially_copyable>().is_trivially_copyable(),
+                      "hyperion::mpl::Type::is_trivially_copyable test case 3 (failing)");
+
+        static_assert(decltype_<packed>().is_standard_layout(),
+                      "hyperion::mpl::Type::is_standard_layout test case 1 (failing)");
+        static_assert(!decltype_<not_standard_layout>().is_standard_layout(),
+                      "hyperion::mpl::Type::is_standard_layout test case 2 (failing)");
+
+        static_assert(decltype_<int>().has_unique_object_representations(),
+                      "hyperion::mpl::Type::has_unique_object_representations test case 1 "
+                      "(failing)");
+        static_assert(decltype_<packed>().has_unique_object_representations(),
+                      "hyperion::mpl::Type::has_unique_object_representations test case 2 "
+                      "(failing)");
+        static_assert(!decltype_<padded>().has_unique_object_representations(),
+                      "hyperion::mpl::Type::has_unique_object_representations test case 3 "
+                      "(failing)");
+        static_assert(!decltype_<float>().has_unique_object_representations(),
+                      "hyperion::mpl::Type::has_unique_object_representations test case 4 "
+                      "(failing)");
+
+        static_assert(decltype_<int>().is_implicit_lifetime(),
+                      "hyperion::mpl::Type::is_implicit_lifetime test case 1 (failing)");
+        static_assert(decltype_<padded>().is_implicit_lifetime(),
+                      "hyperion::mpl::Type::is_implicit_lifetime test case 2 (failing)");
+        static_assert(decltype_<int[4]>().is_implicit_lifetime(), // NOLINT(*-avoid-c-arrays)
+                      "hyperion::mpl::Type::is_implicit_lifetime test case 3 (failing)");
+        static_assert(!decltype_<not_implicit_lifetime>().is_implicit_lifetime(),
+                      "hyperion::mpl::Type::is_implicit_lifetime test case 4 (failing)");
     } // namespace _test::type
 } // namespace hyperion::mpl
 
@@ -103,6 +103,46 @@ namespace hyperion::mpl::type_traits {
     template<typename TType>
     static inline constexpr auto is_trivially_movable_v = is_trivially_movable<TType>::value;
 
+    /// @brief Type trait requiring that the type `TType` is an implicit-lifetime type.
+    /// Objects of implicit-lifetime types are implicitly created by operations that begin
+    /// the lifetime of an array of bytes, such as `std::memcpy` and `std::malloc`.
+    ///
+    /// Scalar types, arrays, and aggregates are implicit-lifetime types, as are class types
+    /// with a trivial, non-deleted destructor and at least one trivial constructor.
+    /// Uses `std::is_implicit_lifetime` when the standard library provides it. Otherwise,
+    /// aggregates with non-trivial destructors are conservatively not considered
+    /// implicit-lifetime types, because a user-provided destructor can't be detected.
+    ///
+    /// @tparam TType The type to check
+    /// @ingroup std_supplemental_traits
+    /// @headerfile hyperion/mpl/type_traits/std_supplemental.h
+    template<typename TType>
+    struct is_implicit_lifetime
+#if defined(__cpp_lib_is_implicit_lifetime) && __cpp_lib_is_implicit_lifetime >= 202302L
+        : public std::is_implicit_lifetime<TType> {
+    };
+#else
+        : public std::bool_constant<
+              std::is_scalar_v<TType> || std::is_array_v<TType>
+              || (std::is_class_v<TType> && std::is_trivially_destructible_v<TType>
+                  && (std::is_aggregate_v<TType>
+                      || std::is_trivially_default_constructible_v<TType>
+                      || std::is_trivially_copy_constructible_v<TType>
+                      || std::is_trivially_move_constructible_v<TType>))> {
+    };
+#endif
+
+    /// @brief Value of the type trait `is_implicit_lifetime`.
+    /// Requires that the type `TType` is an implicit-lifetime type.
+    /// Objects of implicit-lifetime types are implicitly created by operations that begin
+    /// the lifetime of an array of bytes, such as `std::memcpy` and `std::malloc`.
+    ///
+    /// @tparam TType The type to check
+    /// @ingroup std_supplemental_traits
+    /// @headerfile hyperion/mpl/type_traits/std_supplemental.h
+    template<typename TType>
+    static inline constexpr auto is_implicit_lifetime_v = is_implicit_lifetime<TType>::value;
+
     namespace _test {
         struct trivially_move_but_not_copyable {
             trivially_move_but_not_copyable() = default;
@@ -129,6 +169,27 @@ namespace hyperion::mpl::type_traits {
                       "hyperion::mpl::type_traits::is_trivially_movable test case 1 (failing)");
         static_assert(!is_trivially_movable_v<not_trivially_movable>,
                       "hyperion::mpl::type_traits::is_trivially_movable test case 2 (failing)");
+
+        struct implicit_lifetime_aggregate {
+            int value;
+        };
+
+        // NOLINTNEXTLINE(*-special-member-functions)
+        struct not_implicit_lifetime {
+            not_implicit_lifetime();
+            ~not_implicit_lifetime();
+        };
+
+        static_assert(is_implicit_lifetime_v<int>,
+                      "hyperion::mpl::type_traits::is_implicit_lifetime test case 1 (failing)");
+        static_assert(is_implicit_lifetime_v<implicit_lifetime_aggregate>,
+                      "hyperion::mpl::type_traits::is_implicit_lifetime test case 2 (failing)");
+        static_assert(is_implicit_lifetime_v<not_trivially_movable>,
+                      "hyperion::mpl::type_traits::is_implicit_lifetime test case 3 (failing)");
+        static_assert(!is_implicit_lifetime_v<not_implicit_lifetime>,
+                      "hyperion::mpl::type_traits::is_implicit_lifetime test case 4 (failing)");
+        static_assert(!is_implicit_lifetime_v<int&>,
+                      "hyperion::mpl::type_traits::is_implicit_lifetime test case 5 (failing)");
     } // namespace _test
 } // namespace hyperion::mpl::type_traits
 
@@ -0,0 +1,676 @@
+/// @file when_all.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Coroutine combinators for awaiting a heterogeneous `List` of awaitables
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+//
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/metatypes.h>
+#include <hyperion/mpl/type.h>
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+/// @ingroup mpl
+/// @{
+/// @defgroup when_all Coroutine Combinators
+/// Hyperion provides `mpl::when_all` and `mpl::when_any` for concurrently awaiting a
+/// heterogeneous set of awaitables from a C++20 coroutine.
+///
+/// The result types of the combinators are computed from the `mpl::List` of awaitable
+/// types at compile time. Completion of the awaited operations is tracked with a single
+/// atomic counter, and results are stored inline in the combinator itself, as are the
+/// frames of the internal coroutines used to await each operation, so awaiting a
+/// combinator does not allocate.
+///
+/// # Example
+/// @code {.cpp}
+/// #include <hyperion/mpl/when_all.h>
+///
+/// using namespace hyperion::mpl;
+///
+/// auto fan_out(client& users, client& orders) -> task<void> {
+///     // `user` is a `user_record`, `history` is a `std::vector<order>`
+///     auto [user, history] = co_await when_all(users.fetch(id), orders.fetch_all(id));
+///     // `fastest` is a `std::variant<user_record, user_record>`
+///     auto fastest = co_await when_any(users.fetch(id), users.fetch_replica(id));
+/// }
+/// @endcode
+/// @headerfile hyperion/mpl/when_all.h
+/// @}
+
+#ifndef HYPERION_MPL_WHEN_ALL_H
+    #define HYPERION_MPL_WHEN_ALL_H
+
+namespace hyperion::mpl {
+
+    namespace detail {
+        /// @brief Returns the awaiter used when `co_await`ing `awaitable`,
+        /// following the same lookup rules as a `co_await` expression
+        /// (minus `await_transform`)
+        template<typename TAwaitable>
+        constexpr auto get_awaiter(TAwaitable&& awaitable) -> decltype(auto) {
+            if constexpr(requires { std::forward<TAwaitable>(awaitable).operator co_await(); }) {
+                return std::forward<TAwaitable>(awaitable).operator co_await();
+            }
+            else if constexpr(requires { operator co_await(std::forward<TAwaitable>(awaitable)); })
+            {
+                return operator co_await(std::forward<TAwaitable>(awaitable));
+            }
+            else {
+                return std::forward<TAwaitable>(awaitable);
+            }
+        }
+
+        template<typename TAwaiter>
+        concept awaiter = requires(TAwaiter& awaiter) {
+            { awaiter.await_ready() } -> std::convertible_to<bool>;
+            awaiter.await_resume();
+        };
+
+        template<typename TAwaitable>
+        concept awaitable = requires(TAwaitable&& awaitable) {
+            { get_awaiter(std::forward<TAwaitable>(awaitable)) } -> awaiter;
+        };
+
+        /// @brief The type of the awaiter `co_await`ed when awaiting a `TAwaitable`.
+        /// A reference if the awaitable is its own awaiter
+        template<typename TAwaitable>
+        using awaiter_t = decltype(get_awaiter(std::declval<TAwaitable>()));
+
+        template<typename TAwaitable>
+        using await_resume_t = decltype(std::declval<awaiter_t<TAwaitable>&>().await_resume());
+
+        /// @brief The number of bytes reserved in a combinator for the frame of the internal
+        /// coroutine awaiting a `TAwaitable`: room for the awaiter, if it is not the
+        /// awaitable itself, and the result, plus the frame's own bookkeeping
+        template<typename TAwaitable>
+        static inline constexpr auto combinator_frame_size
+            = ((sizeof(std::remove_reference_t<awaiter_t<TAwaitable>>)
+                + sizeof(std::conditional_t<std::is_void_v<await_resume_t<TAwaitable>>,
+                                            std::monostate,
+                                            std::remove_cvref_t<await_resume_t<TAwaitable>>>)
+                + 16_usize * sizeof(void*) + __STDCPP_DEFAULT_NEW_ALIGNMENT__ - 1_usize)
+               / __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+              * __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+        /// @brief Storage reserved inline in a combinator for the frame of one of its
+        /// internal coroutines
+        template<usize TSize>
+        struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) combinator_frame {
+            std::array<std::byte, TSize> bytes;
+        };
+
+        /// @brief A minimal, lazily started coroutine used by the combinators to await
+        /// each of their awaitables. On completion, notifies its owning combinator
+        /// (`TState`) by calling `TState::complete`, and transfers execution to the
+        /// coroutine handle it returns.
+        ///
+        /// The coroutine must take its owning combinator and a `std::span<std::byte>` as its
+        /// arguments. Its frame is placed in the span, which must be aligned to
+        /// `__STDCPP_DEFAULT_NEW_ALIGNMENT__`. If the frame does not fit, it is allocated with
+        /// the global `operator new` instead.
+        template<typename TState>
+        class combinator_task {
+          public:
+            struct promise_type {
+                TState* state;
+
+                explicit promise_type(TState& _state, [[maybe_unused]] auto&&... args) noexcept
+                    : state(&_state) {
+                }
+
+                [[nodiscard]] static auto operator new(usize size,
+                                                       [[maybe_unused]] TState& _state,
+                                                       std::span<std::byte> storage) -> void* {
+                    // the pointer after the frame records the heap allocation holding it, if
+                    // the frame did not fit in `storage`
+                    const auto total = size + sizeof(void*);
+                    void* heap = nullptr;
+                    auto* frame = storage.data();
+                    if(total > storage.size()) {
+                        heap = ::operator new(total);
+                        frame = static_cast<std::byte*>(heap);
+                    }
+                    // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                    std::memcpy(frame + size, &heap, sizeof(void*));
+                    return frame;
+                }
+
+                static auto operator delete(void* frame, usize size) noexcept -> void {
+                    void* heap = nullptr;
+                    // NOLINTNEXTLINE(*-pro-bounds-pointer-arithmetic)
+                    std::memcpy(&heap, static_cast<std::byte*>(frame) + size, sizeof(void*));
+                    ::operator delete(heap);
+                }
+
+                struct final_awaiter {
+                    [[nodiscard]] auto await_ready() const noexcept -> bool {
+                        return false;
+                    }
+
+                    [[nodiscard]] auto
+                    await_suspend(std::coroutine_handle<promise_type> handle) const noexcept
+                        -> std::coroutine_handle<> {
+                        return handle.promise().state->complete();
+                    }
+
+                    auto await_resume() const noexcept -> void {
+                    }
+                };
+
+                [[nodiscard]] auto get_return_object() noexcept -> combinator_task {
+                    return combinator_task{
+                        std::coroutine_handle<promise_type>::from_promise(*this)};
+                }
+
+                [[nodiscard]] auto initial_suspend() const noexcept -> std::suspend_always {
+                    return {};
+                }
+
+                [[nodiscard]] auto final_suspend() const noexcept -> final_awaiter {
+                    return {};
+                }
+
+                auto return_void() const noexcept -> void {
+                }
+
+                // exceptions from the awaited operations are caught in the coroutine body
+                // and stored in the owning combinator, so this is unreachable
+                [[noreturn]] auto unhandled_exception() const noexcept -> void {
+                    std::terminate();
+                }
+            };
+
+            [[nodiscard]] auto release() noexcept -> std::coroutine_handle<promise_type> {
+                return std::exchange(m_handle, nullptr);
+            }
+
+          private:
+            std::coroutine_handle<promise_type> m_handle;
+
+            explicit combinator_task(std::coroutine_handle<promise_type> handle) noexcept
+                : m_handle(handle) {
+            }
+        };
+    } // namespace detail
+
+    /// @brief Metafunction returning the `mpl::Type` of the value produced by `co_await`ing
+    /// an expression of type `typename decltype(awaitable)::type`, as stored by
+    /// `mpl::when_all` and `mpl::when_any`.
+    ///
+    /// The result is cv-ref unqualified, and `void` results are mapped to `std::monostate`.
+    ///
+    /// # Requirements
+    /// - `typename decltype(awaitable)::type` must be awaitable
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// static_assert(await_result(decltype_<std::suspend_never>()) == decltype_<std::monostate>());
+    /// static_assert(List<task<int>, task<void>>{}.apply(await_result)
+    ///               == List<int, std::monostate>{});
+    /// @endcode
+    ///
+    /// @param awaitable The `mpl::Type` of the awaitable
+    /// @return The `mpl::Type` of the stored result of `co_await`ing `awaitable`
+    /// @ingroup when_all
+    /// @headerfile hyperion/mpl/when_all.h
+    static inline constexpr auto await_result = [](MetaType auto awaitable) noexcept {
+        using awaitable_type = typename decltype(awaitable)::type;
+        static_assert(detail::awaitable<awaitable_type>,
+                      "mpl::await_result requires an awaitable type");
+
+        using result
+            = decltype(detail::get_awaiter(std::declval<awaitable_type>()).await_resume());
+        if constexpr(std::is_void_v<result>) {
+            return decltype_<std::monostate>();
+        }
+        else {
+            return decltype_<std::remove_cvref_t<result>>();
+        }
+    };
+
+    template<typename TAwaitables>
+    class when_all_awaitable;
+
+    /// @brief `when_all_awaitable` concurrently awaits each of the awaitables in
+    /// `TAwaitables`, and produces a `std::tuple` of their results once all have completed.
+    ///
+    /// `when_all_awaitable`s are created by `mpl::when_all`. When `co_await`ed, each
+    /// awaitable is awaited, in order, from an internal coroutine started on the awaiting
+    /// thread. Once every awaitable has completed, the awaiting coroutine is resumed on the
+    /// thread that completed last. The result of the `co_await` expression is a
+    /// `std::tuple` of the results of each awaitable, with types given by
+    /// `List<TAwaitables...>{}.apply(await_result)`. If any awaitable completed with an
+    /// exception, the exception of the first such awaitable (in `List` order) is rethrown
+    /// instead.
+    ///
+    /// A `when_all_awaitable` may only be `co_await`ed once.
+    ///
+    /// @note GCC 12 may relocate the prvalue operand of a `co_await` expression with a
+    /// bitwise copy, which is invalid for awaitables holding e.g. `std::string`s.
+    /// When targeting GCC 12, bind the result of `when_all` to a local before awaiting it.
+    ///
+    /// @tparam TAwaitables The `List` of awaitable types to await
+    /// @ingroup when_all
+    /// @headerfile hyperion/mpl/when_all.h
+    template<typename... TAwaitables>
+        requires(detail::awaitable<TAwaitables> && ...)
+    class when_all_awaitable<List<TAwaitables...>> {
+      public:
+        /// @brief The `List` of the types of the results of each awaitable
+        using results = decltype(List<TAwaitables...>{}.apply(await_result));
+        /// @brief The type produced by `co_await`ing this
+        using result_type = std::tuple<typename decltype(decltype_<TAwaitables>().apply(
+            await_result))::type...>;
+
+        /// @brief Constructs a `when_all_awaitable` from the awaitables to await
+        /// @param awaitables The awaitables to await
+        template<typename... TArgs>
+            requires(sizeof...(TArgs) == sizeof...(TAwaitables))
+        explicit when_all_awaitable(TArgs&&... awaitables) noexcept(
+            (std::is_nothrow_constructible_v<TAwaitables, TArgs&&> && ...))
+            : m_awaitables(std::forward<TArgs>(awaitables)...) {
+        }
+
+        when_all_awaitable(const when_all_awaitable&) = delete;
+        when_all_awaitable(when_all_awaitable&&) = delete;
+        auto operator=(const when_all_awaitable&) -> when_all_awaitable& = delete;
+        auto operator=(when_all_awaitable&&) -> when_all_awaitable& = delete;
+
+        ~when_all_awaitable() noexcept {
+            for(auto child : m_children) {
+                if(child) {
+                    child.destroy();
+                }
+            }
+        }
+
+        [[nodiscard]] auto await_ready() const noexcept -> bool {
+            return sizeof...(TAwaitables) == 0;
+        }
+
+        [[nodiscard]] auto await_suspend(std::coroutine_handle<> continuation) -> bool {
+            m_continuation = continuation;
+            [this]<usize... TIndices>([[maybe_unused]] std::index_sequence<TIndices...> indices) {
+                ((m_children[TIndices] // NOLINT(*-pro-bounds-constant-array-index)
+                  = await_one<TIndices>(*this,
+                                        std::span<std::byte>{std::get<TIndices>(m_frames).bytes})
+                        .release()),
+                 ...);
+            }(std::index_sequence_for<TAwaitables...>{});
+
+            for(auto child : m_children) {
+                child.resume();
+            }
+
+            // the awaiting coroutine holds the last reference to the counter. If every
+            // awaitable completed synchronously, resume the awaiting coroutine immediately
+            return m_remaining.fetch_sub(1_usize, std::memory_order_acq_rel) != 1_usize;
+        }
+
+        auto await_resume() -> result_type {
+            return [this]<usize... TIndices>(
+                       [[maybe_unused]] std::index_sequence<TIndices...> indices) -> result_type {
+                (rethrow_if_failed(std::get<TIndices>(m_slots)), ...);
+                return result_type{std::get<1>(std::move(std::get<TIndices>(m_slots)))...};
+            }(std::index_sequence_for<TAwaitables...>{});
+        }
+
+      private:
+        template<typename TResult>
+        using slot = std::variant<std::monostate, TResult, std::exception_ptr>;
+
+        friend class detail::combinator_task<when_all_awaitable>;
+        using task = detail::combinator_task<when_all_awaitable>;
+
+        std::tuple<TAwaitables...> m_awaitables;
+        std::tuple<slot<typename decltype(decltype_<TAwaitables>().apply(await_result))::type>...>
+            m_slots;
+        std::tuple<detail::combinator_frame<detail::combinator_frame_size<TAwaitables>>...>
+            m_frames;
+        std::array<std::coroutine_handle<typename task::promise_type>, sizeof...(TAwaitables)>
+            m_children = {};
+        std::coroutine_handle<> m_continuation;
+        std::atomic<usize> m_remaining = sizeof...(TAwaitables) + 1_usize;
+
+        template<usize TIndex>
+        static auto await_one(when_all_awaitable& self, [[maybe_unused]] std::span<std::byte> frame)
+            -> task {
+            using awaitable_type = std::tuple_element_t<TIndex, std::tuple<TAwaitables...>>;
+            auto& result = std::get<TIndex>(self.m_slots);
+            try {
+                // resolve the awaiter up front and await it as an lvalue, so it is never
+                // copied into the coroutine frame
+                auto&& awaiter = detail::get_awaiter(
+                    std::forward<awaitable_type>(std::get<TIndex>(self.m_awaitables)));
+                if constexpr(std::is_void_v<decltype(awaiter.await_resume())>) {
+                    co_await awaiter;
+                    result.template emplace<1>();
+                }
+                else {
+                    result.template emplace<1>(co_await awaiter);
+                }
+            }
+            catch(...) {
+                result.template emplace<2>(std::current_exception());
+            }
+        }
+
+        [[nodiscard]] auto complete() noexcept -> std::coroutine_handle<> {
+            if(m_remaining.fetch_sub(1_usize, std::memory_order_acq_rel) == 1_usize) {
+                return m_continuation;
+            }
+
+            return std::noop_coroutine();
+        }
+
+        template<typename TSlot>
+        static auto rethrow_if_failed(const TSlot& slot) -> void {
+            if(slot.index() == 2) {
+                std::rethrow_exception(std::get<2>(slot));
+            }
+        }
+    };
+
+    template<typename TAwaitables>
+    class when_any_awaitable;
+
+    /// @brief `when_any_awaitable` concurrently awaits each of the awaitables in
+    /// `TAwaitables`, and produces the result of whichever completed first.
+    ///
+    /// `when_any_awaitable`s are created by `mpl::when_any`. When `co_await`ed, each
+    /// awaitable is awaited, in order, from an internal coroutine started on the awaiting
+    /// thread. The result of the first awaitable to complete is stored, and the results of
+    /// the others are discarded. Because the awaitables cannot be cancelled, the awaiting
+    /// coroutine is only resumed once every awaitable has completed, on the thread that
+    /// completed last.
+    ///
+    /// The result of the `co_await` expression is a `std::variant` of the result types of
+    /// each awaitable, as given by `List<TAwaitables...>{}.apply(await_result)`, holding the
+    /// result of the first awaitable to complete at the index of that awaitable. If the first
+    /// awaitable to complete did so with an exception, that exception is rethrown instead.
+    ///
+    /// A `when_any_awaitable` may only be `co_await`ed once.
+    /// The same GCC 12 caveat as for `when_all_awaitable` applies.
+    ///
+    /// @tparam TAwaitables The `List` of awaitable types to await
+    /// @ingroup when_all
+    /// @headerfile hyperion/mpl/when_all.h
+    template<typename... TAwaitables>
+        requires(sizeof...(TAwaitables) != 0) && (detail::awaitable<TAwaitables> && ...)
+    class when_any_awaitable<List<TAwaitables...>> {
+      public:
+        /// @brief The `List` of the types of the results of each awaitable
+        using results = decltype(List<TAwaitables...>{}.apply(await_result));
+        /// @brief The type produced by `co_await`ing this
+        using result_type = std::variant<typename decltype(decltype_<TAwaitables>().apply(
+            await_result))::type...>;
+
+        /// @brief Constructs a `when_any_awaitable` from the awaitables to await
+        /// @param awaitables The awaitables to await
+        template<typename... TArgs>
+            requires(sizeof...(TArgs) == sizeof...(TAwaitables))
+        explicit when_any_awaitable(TArgs&&... awaitables) noexcept(
+            (std::is_nothrow_constructible_v<TAwaitables, TArgs&&> && ...))
+            : m_awaitables(std::forward<TArgs>(awaitables)...) {
+        }
+
+        when_any_awaitable(const when_any_awaitable&) = delete;
+        when_any_awaitable(when_any_awaitable&&) = delete;
+        auto operator=(const when_any_awaitable&) -> when_any_awaitable& = delete;
+        auto operator=(when_any_awaitable&&) -> when_any_awaitable& = delete;
+
+        ~when_any_awaitable() noexcept {
+            for(auto child : m_children) {
+                if(child) {
+                    child.destroy();
+                }
+            }
+        }
+
+        [[nodiscard]] auto await_ready() const noexcept -> bool {
+            return false;
+        }
+
+        [[nodiscard]] auto await_suspend(std::coroutine_handle<> continuation) -> bool {
+            m_continuation = continuation;
+            [this]<usize... TIndices>([[maybe_unused]] std::index_sequence<TIndices...> indices) {
+                ((m_children[TIndices] // NOLINT(*-pro-bounds-constant-array-index)
+                  = await_one<TIndices>(*this,
+                                        std::span<std::byte>{std::get<TIndices>(m_frames).bytes})
+                        .release()),
+                 ...);
+            }(std::index_sequence_for<TAwaitables...>{});
+
+            for(auto child : m_children) {
+                child.resume();
+            }
+
+            return m_state.fetch_sub(completion, std::memory_order_acq_rel) >> 1_usize != 1_usize;
+        }
+
+        auto await_resume() -> result_type {
+            if(m_exception) {
+                std::rethrow_exception(m_exception);
+            }
+
+            // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+            return std::move(*m_result);
+        }
+
+      private:
+        friend class detail::combinator_task<when_any_awaitable>;
+        using task = detail::combinator_task<when_any_awaitable>;
+
+        /// @brief The low bit of `m_state` is set by the first awaitable to complete, which
+        /// thereby claims the result. The remaining bits count the outstanding completions
+        /// (one per awaitable, plus one for the awaiting coroutine), in units of `completion`
+        static inline constexpr auto claimed = 1_usize;
+        static inline constexpr auto completion = 2_usize;
+
+        std::tuple<TAwaitables...> m_awaitables;
+        std::tuple<detail::combinator_frame<detail::combinator_frame_size<TAwaitables>>...>
+            m_frames;
+        std::optional<result_type> m_result;
+        std::exception_ptr m_exception;
+        std::array<std::coroutine_handle<typename task::promise_type>, sizeof...(TAwaitables)>
+            m_children = {};
+        std::coroutine_handle<> m_continuation;
+        std::atomic<usize> m_state = (sizeof...(TAwaitables) + 1_usize) * completion;
+
+        [[nodiscard]] auto try_claim() noexcept -> bool {
+            return (m_state.fetch_or(claimed, std::memory_order_relaxed) & claimed) == 0_usize;
+        }
+
+        template<usize TIndex, typename TResult>
+        auto claim(TResult&& result) -> void {
+            if(try_claim()) {
+                m_result.emplace(std::in_place_index<TIndex>, std::forward<TResult>(result));
+            }
+        }
+
+        template<usize TIndex>
+        static auto await_one(when_any_awaitable& self, [[maybe_unused]] std::span<std::byte> frame)
+            -> task {
+            using awaitable_type = std::tuple_element_t<TIndex, std::tuple<TAwaitables...>>;
+            try {
+                // resolve the awaiter up front and await it as an lvalue, so it is never
+                // copied into the coroutine frame
+                auto&& awaiter = detail::get_awaiter(
+                    std::forward<awaitable_type>(std::get<TIndex>(self.m_awaitables)));
+                if constexpr(std::is_void_v<decltype(awaiter.await_resume())>) {
+                    co_await awaiter;
+                    self.template claim<TIndex>(std::monostate{});
+                }
+                else {
+                    self.template claim<TIndex>(co_await awaiter);
+                }
+            }
+            catch(...) {
+                if(self.try_claim()) {
+                    self.m_exception = std::current_exception();
+                }
+            }
+        }
+
+        [[nodiscard]] auto complete() noexcept -> std::coroutine_handle<> {
+            if(m_state.fetch_sub(completion, std::memory_order_acq_rel) >> 1_usize == 1_usize) {
+                return m_continuation;
+            }
+
+            return std::noop_coroutine();
+        }
+    };
+
+    /// @brief Returns an awaitable that concurrently awaits each of `awaitables`, producing
+    /// a `std::tuple` of their results once all have completed.
+    ///
+    /// Lvalue awaitables are referenced by the returned awaitable, and must outlive it.
+    /// Rvalue awaitables are moved into it. See `when_all_awaitable` for details.
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// // `a` is an `int`, `b` is a `std::monostate`, `c` is a `std::string`
+    /// auto [a, b, c] = co_await when_all(fetch_int(), send_request(), fetch_name());
+    /// @endcode
+    ///
+    /// @tparam TAwaitables The types of the awaitables
+    /// @param awaitables The awaitables to await
+    /// @return A `when_all_awaitable` awaiting `awaitables`
+    /// @ingroup when_all
+    /// @headerfile hyperion/mpl/when_all.h
+    template<typename... TAwaitables>
+        requires(detail::awaitable<TAwaitables> && ...)
+    [[nodiscard]] auto when_all(TAwaitables&&... awaitables) noexcept(
+        std::is_nothrow_constructible_v<when_all_awaitable<List<TAwaitables...>>, TAwaitables&&...>)
+        -> when_all_awaitable<List<TAwaitables...>> {
+        return when_all_awaitable<List<TAwaitables...>>{std::forward<TAwaitables>(awaitables)...};
+    }
+
+    /// @brief Returns an awaitable that concurrently awaits each of `awaitables`, producing
+    /// a `std::variant` holding the result of whichever completed first.
+    ///
+    /// Lvalue awaitables are referenced by the returned awaitable, and must outlive it.
+    /// Rvalue awaitables are moved into it. See `when_any_awaitable` for details.
+    ///
+    /// # Example
+    /// @code {.cpp}
+    /// auto result = co_await when_any(fetch_from_primary(), fetch_from_replica());
+    /// // `result.index()` is the index of whichever fetch completed first
+    /// @endcode
+    ///
+    /// @tparam TAwaitables The types of the awaitables
+    /// @param awaitables The awaitables to await
+    /// @return A `when_any_awaitable` awaiting `awaitables`
+    /// @ingroup when_all
+    /// @headerfile hyperion/mpl/when_all.h
+    template<typename... TAwaitables>
+        requires(sizeof...(TAwaitables) != 0) && (detail::awaitable<TAwaitables> && ...)
+    [[nodiscard]] auto when_any(TAwaitables&&... awaitables) noexcept(
+        std::is_nothrow_constructible_v<when_any_awaitable<List<TAwaitables...>>, TAwaitables&&...>)
+        -> when_any_awaitable<List<TAwaitables...>> {
+        return when_any_awaitable<List<TAwaitables...>>{std::forward<TAwaitables>(awaitables)...};
+    }
+
+    namespace _test::when_all {
+        struct void_awaitable {
+            [[nodiscard]] auto await_ready() const noexcept -> bool {
+                return true;
+            }
+            auto await_suspend(std::coroutine_handle<> handle) const noexcept -> void {
+                static_cast<void>(handle);
+            }
+            auto await_resume() const noexcept -> void {
+            }
+        };
+
+        struct int_awaitable {
+            [[nodiscard]] auto operator co_await() const noexcept {
+                struct awaiter {
+                    [[nodiscard]] auto await_ready() const noexcept -> bool {
+                        return true;
+                    }
+                    auto await_suspend(std::coroutine_handle<> handle) const noexcept -> void {
+                        static_cast<void>(handle);
+                    }
+                    [[nodiscard]] auto await_resume() const noexcept -> const int& {
+                        return value;
+                    }
+
+                    int value;
+                };
+
+                return awaiter{1};
+            }
+        };
+
+        static_assert(await_result(decltype_<void_awaitable>()) == decltype_<std::monostate>(),
+                      "hyperion::mpl::await_result test case 1 (failing)");
+        static_assert(await_result(decltype_<int_awaitable>()) == decltype_<int>(),
+                      "hyperion::mpl::await_result test case 2 (failing)");
+        static_assert(await_result(decltype_<int_awaitable&>()) == decltype_<int>(),
+                      "hyperion::mpl::await_result test case 3 (failing)");
+        static_assert(await_result(decltype_<std::suspend_never>())
+                          == decltype_<std::monostate>(),
+                      "hyperion::mpl::await_result test case 4 (failing)");
+
+        static_assert(std::same_as<decltype(mpl::when_all(int_awaitable{}, void_awaitable{})),
+                                   when_all_awaitable<List<int_awaitable, void_awaitable>>>,
+                      "hyperion::mpl::when_all test case 1 (failing)");
+        static_assert(
+            std::same_as<when_all_awaitable<List<int_awaitable, void_awaitable>>::result_type,
+                         std::tuple<int, std::monostate>>,
+            "hyperion::mpl::when_all test case 2 (failing)");
+        static_assert(when_all_awaitable<List<int_awaitable&, void_awaitable>>::results{}
+                          == List<int, std::monostate>{},
+                      "hyperion::mpl::when_all test case 3 (failing)");
+        static_assert(std::same_as<when_all_awaitable<List<>>::result_type, std::tuple<>>,
+                      "hyperion::mpl::when_all test case 4 (failing)");
+
+        static_assert(std::same_as<decltype(mpl::when_any(int_awaitable{}, void_awaitable{})),
+                                   when_any_awaitable<List<int_awaitable, void_awaitable>>>,
+                      "hyperion::mpl::when_any test case 1 (failing)");
+        static_assert(
+            std::same_as<when_any_awaitable<List<int_awaitable, int_awaitable>>::result_type,
+                         std::variant<int, int>>,
+            "hyperion::mpl::when_any test case 2 (failing)");
+    } // namespace _test::when_all
+} // namespace hyperion::mpl
+
+#endif // HYPERION_MPL_WHEN_ALL_H
@@ -0,0 +1,174 @@
+/// @file aggregate_hash.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Cost of `mpl::aggregate_hash` and `mpl::aggregate_equal` for 16, 32 and 64-byte keys
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/aggregate_hash.h>
+#include <hyperion/platform/types.h>
+
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "bench.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    constexpr auto num_keys = 1'000'000_usize;
+
+    struct key16 {
+        u64 first;
+        u64 second;
+    };
+
+    struct key32 {
+        u64 first;
+        u64 second;
+        u64 third;
+        u64 fourth;
+    };
+
+    struct key64 {
+        u64 first;
+        u64 second;
+        u64 third;
+        u64 fourth;
+        u64 fifth;
+        u64 sixth;
+        u64 seventh;
+        u64 eighth;
+    };
+
+    using key16_fields = List<Value<&key16::first>, Value<&key16::second>>;
+    using key32_fields = List<Value<&key32::first>,
+                              Value<&key32::second>,
+                              Value<&key32::third>,
+                              Value<&key32::fourth>>;
+    using key64_fields = List<Value<&key64::first>,
+                              Value<&key64::second>,
+                              Value<&key64::third>,
+                              Value<&key64::fourth>,
+                              Value<&key64::fifth>,
+                              Value<&key64::sixth>,
+                              Value<&key64::seventh>,
+                              Value<&key64::eighth>>;
+
+    /// @brief The hand-written equality these keys would otherwise get: `==` on each field
+    template<typename TFields>
+    struct fieldwise_equal;
+
+    template<auto... TMembers, typename... TTypes>
+    struct fieldwise_equal<List<Value<TMembers, TTypes>...>> {
+        template<typename TKey>
+        auto operator()(const TKey& lhs, const TKey& rhs) const noexcept -> bool {
+            return ((lhs.*TMembers == rhs.*TMembers) && ...);
+        }
+    };
+
+    /// @brief The hand-written hash these keys would otherwise get: `std::hash` of each
+    /// field, combined as by `boost::hash_combine`
+    template<typename TFields>
+    struct fieldwise_hash;
+
+    template<auto... TMembers, typename... TTypes>
+    struct fieldwise_hash<List<Value<TMembers, TTypes>...>> {
+        template<typename TKey>
+        auto operator()(const TKey& key) const noexcept -> usize {
+            auto seed = 0_usize;
+            ((seed ^= std::hash<u64>{}(key.*TMembers) + 0x9e3779b9_usize + (seed << 6U)
+                      + (seed >> 2U)),
+             ...);
+            return seed;
+        }
+    };
+
+    /// @brief Returns the time per key, in nanoseconds, to hash every key in `keys`,
+    /// and to insert every key into, then look every key up in, an `std::unordered_set`
+    template<typename TKey, typename THash, typename TEqual>
+    auto measure(const std::vector<TKey>& keys) -> std::pair<f64, f64> {
+        const auto hash_ns = bench::best_of(5, [&]() {
+            auto sum = 0_usize;
+            for(const auto& key : keys) {
+                sum += THash{}(key);
+            }
+            bench::do_not_optimize(sum);
+        });
+
+        const auto set_ns = bench::best_of(3, [&]() {
+            auto set = std::unordered_set<TKey, THash, TEqual>{};
+            set.reserve(keys.size());
+            for(const auto& key : keys) {
+                set.insert(key);
+            }
+            auto found = 0_usize;
+            for(const auto& key : keys) {
+                found += set.count(key);
+            }
+            bench::do_not_optimize(found);
+        });
+
+        const auto count = static_cast<f64>(keys.size());
+        return {hash_ns / count, set_ns / count};
+    }
+
+    template<typename TKey, typename TFields>
+    auto report() -> void {
+        static_assert(aggregate_hash<TFields>::is_bytewise);
+
+        auto engine = std::mt19937_64{sizeof(TKey)};
+        auto keys = std::vector<TKey>(num_keys);
+        for(auto& key : keys) {
+            auto* words = reinterpret_cast<u64*>(&key); // NOLINT(*-reinterpret-cast)
+            for(auto index = 0_usize; index < sizeof(TKey) / sizeof(u64); ++index) {
+                words[index] = engine(); // NOLINT(*-pointer-arithmetic)
+            }
+        }
+
+        const auto [bytewise_hash, bytewise_set]
+            = measure<TKey, aggregate_hash<TFields>, aggregate_equal<TFields>>(keys);
+        const auto [fieldwise_hash_ns, fieldwise_set]
+            = measure<TKey, fieldwise_hash<TFields>, fieldwise_equal<TFields>>(keys);
+
+        std::printf("%2zu-byte keys: hash %5.2f ns (field-wise %5.2f ns), "
+                    "unordered_set insert + find %6.2f ns (field-wise %6.2f ns)\n",
+                    sizeof(TKey),
+                    bytewise_hash,
+                    fieldwise_hash_ns,
+                    bytewise_set,
+                    fieldwise_set);
+    }
+} // namespace
+
+auto main() -> i32 {
+    report<key16, key16_fields>();
+    report<key32, key32_fields>();
+    report<key64, key64_fields>();
+
+    return 0;
+}
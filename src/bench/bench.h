@@ -0,0 +1,79 @@
+/// @file bench.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Minimal timing helpers shared by the benchmark executables
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_MPL_BENCH_BENCH_H
+    #define HYPERION_MPL_BENCH_BENCH_H
+
+#include <hyperion/platform/def.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+namespace hyperion::mpl::bench {
+
+    /// @brief Prevents the compiler from optimizing away the computation of `value`
+    /// @param value The value to keep
+    template<typename TType>
+    inline auto do_not_optimize(TType&& value) noexcept -> void {
+    #if HYPERION_PLATFORM_COMPILER_IS_CLANG || HYPERION_PLATFORM_COMPILER_IS_GCC
+        asm volatile("" : : "r"(&value) : "memory");
+    #else
+        static const volatile void* sink = nullptr;
+        sink = &value;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    #endif // HYPERION_PLATFORM_COMPILER_IS_CLANG || HYPERION_PLATFORM_COMPILER_IS_GCC
+    }
+
+    /// @brief Returns the current time of the monotonic clock, in nanoseconds
+    /// @return the current time
+    [[nodiscard]] inline auto now_ns() noexcept -> u64 {
+        return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::steady_clock::now().time_since_epoch())
+                                    .count());
+    }
+
+    /// @brief Invokes `func` `repetitions` times, and returns the fastest of the invocations,
+    /// in nanoseconds
+    /// @param repetitions The number of times to invoke `func`
+    /// @param func The function to time
+    /// @return the fastest time
+    template<typename TFunc>
+    [[nodiscard]] auto best_of(usize repetitions, TFunc&& func) -> f64 {
+        auto best = std::numeric_limits<f64>::max();
+        for(auto repetition = 0_usize; repetition < repetitions; ++repetition) {
+            const auto start = now_ns();
+            func();
+            best = std::min(best, static_cast<f64>(now_ns() - start));
+        }
+        return best;
+    }
+} // namespace hyperion::mpl::bench
+
+#endif // HYPERION_MPL_BENCH_BENCH_H
@@ -0,0 +1,97 @@
+/// @file list_algorithms.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Compile-time benchmark corpus: `List` algorithms over many distinct `List`s
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+// Measured by compiling, not by running: see `measure.py`.
+// Runs the predicate-based algorithms, `pop_front`, and `pop_back` on
+// `HYPERION_MPL_BENCH_LIST_COUNT` distinct `List`s of `HYPERION_MPL_BENCH_LIST_SIZE` elements,
+// where a third of the elements are `const`, to measure the per-`List` instantiation cost of
+// their internals.
+
+#include <hyperion/mpl/list.h>
+#include <hyperion/mpl/metapredicates.h>
+#include <hyperion/platform/types.h>
+
+#include <type_traits>
+#include <utility>
+
+#ifndef HYPERION_MPL_BENCH_LIST_COUNT
+    #define HYPERION_MPL_BENCH_LIST_COUNT 12
+#endif // HYPERION_MPL_BENCH_LIST_COUNT
+
+#ifndef HYPERION_MPL_BENCH_LIST_SIZE
+    #define HYPERION_MPL_BENCH_LIST_SIZE 64
+#endif // HYPERION_MPL_BENCH_LIST_SIZE
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    template<usize TList, usize TIndex>
+    struct element_tag { };
+
+    template<usize TList, usize TIndex>
+    using element = std::conditional_t<TIndex % 3 == 0,
+                                       const element_tag<TList, TIndex>,
+                                       element_tag<TList, TIndex>>;
+
+    template<usize TList, usize... TIndices>
+    auto make_list([[maybe_unused]] std::index_sequence<TIndices...> indices)
+        -> List<element<TList, TIndices>...>;
+
+    template<usize TList>
+    using elements
+        = decltype(make_list<TList>(std::make_index_sequence<HYPERION_MPL_BENCH_LIST_SIZE>{}));
+
+    inline constexpr auto all_const = [](MetaList auto list) {
+        return list.all_of(is_const);
+    };
+
+    template<usize TList>
+    [[nodiscard]] consteval auto run_algorithms() -> bool {
+        constexpr auto list = elements<TList>{};
+        constexpr auto size = usize{HYPERION_MPL_BENCH_LIST_SIZE};
+        constexpr auto num_const = (size + 2) / 3;
+        return list.filter(is_const).size() == num_const
+               && list.remove_if(is_const).size() == size - num_const
+               && list.count_if(is_const) == num_const && list.index_if(is_const) == 0_usize
+               && list.pop_front().size() == size - 1 && list.pop_back().size() == size - 1
+               && not list.satisfies(all_const)
+               && list.filter(is_const).satisfies(all_const);
+    }
+
+    template<usize... TLists>
+    [[nodiscard]] consteval auto
+    run_all([[maybe_unused]] std::index_sequence<TLists...> lists) -> bool {
+        return (run_algorithms<TLists>() && ...);
+    }
+
+    static_assert(run_all(std::make_index_sequence<HYPERION_MPL_BENCH_LIST_COUNT>{}));
+} // namespace
+
+auto main() -> i32 {
+    return 0;
+}
@@ -0,0 +1,86 @@
+/// @file list_symbols.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Compile-time benchmark corpus: the symbols emitted for `List`s of many elements
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+// Measured by compiling, not by running: see `measure.py`.
+// Calls `List` operations that are emitted as out-of-line functions by default, on a `List`
+// of `HYPERION_MPL_BENCH_LIST_SIZE` elements, to compare object sizes, mangled symbol
+// lengths, and link times between checkouts.
+
+#include <hyperion/mpl/list.h>
+#include <hyperion/platform/types.h>
+
+#include <cstdio>
+#include <span>
+#include <utility>
+
+#ifndef HYPERION_MPL_BENCH_LIST_SIZE
+    #define HYPERION_MPL_BENCH_LIST_SIZE 256
+#endif // HYPERION_MPL_BENCH_LIST_SIZE
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    template<usize TIndex>
+    struct element_tag { };
+
+    template<usize... TIndices>
+    auto make_list([[maybe_unused]] std::index_sequence<TIndices...> indices)
+        -> List<element_tag<TIndices>...>;
+
+    using elements
+        = decltype(make_list(std::make_index_sequence<HYPERION_MPL_BENCH_LIST_SIZE>{}));
+
+    /// @brief Runs each job in order on the calling thread
+    struct serial_executor {
+        struct job {
+            void (*invoke)(void*) noexcept;
+            void* context;
+        };
+
+        auto execute(std::span<const job> jobs) noexcept -> void {
+            for(const auto& current : jobs) {
+                current.invoke(current.context);
+            }
+        }
+    };
+} // namespace
+
+auto main() -> i32 {
+    auto count = 0_usize;
+    const auto visit = [&count]([[maybe_unused]] MetaType auto type) { ++count; };
+
+    constexpr auto list = elements{};
+    list.apply([](MetaType auto type) { return type.as_const(); }).for_each(visit);
+    list.for_each_n(visit, 10_value);
+    auto executor = serial_executor{};
+    list.for_each_parallel(visit, executor);
+    list.zip(list).for_each([&count]([[maybe_unused]] auto pair) { ++count; });
+
+    std::printf("%zu\n", count);
+    return 0;
+}
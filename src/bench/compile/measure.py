@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""Measures the compile-time benchmark corpora in this directory.
+
+Each corpus is compiled once per `--include` directory (e.g. the `include` directories of two
+checkouts, to compare them) and once per `--define` configuration, and the script reports:
+
+- the wall time of the compile
+- with GCC, the template instantiation and total time and memory from `-ftime-report`
+- the size of the object file
+- the number of defined symbols, and the total and maximum length of their mangled names
+- the median wall time of linking the object file into an executable
+
+Example, comparing a baseline checkout to this one at two `List` sizes:
+
+    src/bench/compile/measure.py \\
+        --include base=../baseline/include --include head=include \\
+        --define HYPERION_MPL_BENCH_LIST_SIZE=64 --define HYPERION_MPL_BENCH_LIST_SIZE=256 \\
+        --flags="-I<hyperion_platform>/include -O0 -g" list_symbols
+
+MIT License
+Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+"""
+
+import argparse
+import os
+import re
+import shlex
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+CORPUS_DIR = Path(__file__).resolve().parent
+# e.g. " template instantiation :   7.92 ( 75%)   1.44 ( 68%)   9.24 ( 72%)   526M ( 78%)"
+# captures the phase, the wall time (the last time column), and the memory
+TIME_REPORT_LINE = re.compile(r"^\s*(template instantiation|TOTAL)\s*:.*?([\d.]+)"
+                              r"(?:\s*\(\s*\d+%\))?\s+([\d.]+[kMG]?)\s*(?:\(\s*\d+%\))?\s*$")
+
+
+def parse_time_report(stderr: str) -> dict[str, tuple[float, str]]:
+    """Returns the wall time and memory of the interesting `-ftime-report` phases"""
+    phases = {}
+    for line in stderr.splitlines():
+        match = TIME_REPORT_LINE.match(line)
+        if match is not None:
+            phases[match.group(1)] = (float(match.group(2)), match.group(3))
+    return phases
+
+
+def symbol_stats(compiler: str, obj: Path) -> tuple[int, int, int]:
+    """Returns the number of defined symbols in `obj`, and the total and maximum length of
+    their mangled names"""
+    nm = "nm" if "clang" not in compiler else "llvm-nm"
+    output = subprocess.run([nm, "--defined-only", str(obj)],
+                            capture_output=True, text=True, check=True).stdout
+    names = [line.split()[-1] for line in output.splitlines() if line.strip()]
+    return len(names), sum(map(len, names)), max(map(len, names), default=0)
+
+
+def link_time(compiler: str, flags: list[str], obj: Path, runs: int) -> float:
+    """Returns the median wall time of `runs` links of `obj` into an executable"""
+    times = []
+    for _ in range(runs):
+        start = time.monotonic()
+        result = subprocess.run([compiler, *flags, str(obj), "-o", str(obj.with_suffix(""))],
+                                capture_output=True, text=True)
+        times.append(time.monotonic() - start)
+        if result.returncode != 0:
+            sys.exit(f"failed to link {obj.name}:\n{result.stderr}")
+    return statistics.median(times)
+
+
+def measure(compiler: str, flags: list[str], corpus: Path, obj: Path, link_runs: int) -> str:
+    start = time.monotonic()
+    result = subprocess.run([compiler, "-std=c++20", *flags, "-ftime-report", "-c",
+                             str(corpus), "-o", str(obj)],
+                            capture_output=True, text=True)
+    wall = time.monotonic() - start
+    if result.returncode != 0:
+        sys.exit(f"failed to compile {corpus.name}:\n{result.stderr}")
+
+    phases = parse_time_report(result.stderr)
+    report = f"wall {wall:6.2f} s"
+    for phase in ("template instantiation", "TOTAL"):
+        if phase in phases:
+            seconds, memory = phases[phase]
+            report += f" | {phase} {seconds:6.2f} s {memory:>5}"
+    count, total, longest = symbol_stats(compiler, obj)
+    report += (f" | object {os.path.getsize(obj):10,} B"
+               f" | {count:5} symbols, {total:9,} B of names, longest {longest:6,} B")
+    if link_runs > 0:
+        report += f" | link {link_time(compiler, flags, obj, link_runs):6.3f} s"
+    return report
+
+
+def main() -> None:
+    corpora = sorted(path.stem for path in CORPUS_DIR.glob("*.cpp"))
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("corpus", nargs="*", default=corpora,
+                        help=f"the corpora to measure, of {', '.join(corpora)} (default: all)")
+    parser.add_argument("--include", action="append", metavar="[LABEL=]DIR",
+                        help="a hyperion_mpl include directory to measure with (repeatable, "
+                        "default: this checkout's)")
+    parser.add_argument("--define", action="append", default=[], metavar="NAME=VALUE",
+                        help="a configuration to measure, as a macro definition (repeatable)")
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "g++"))
+    parser.add_argument("--link-runs", type=int, default=5,
+                        help="the number of links to take the median time of, or 0 to skip "
+                        "linking (default: %(default)s)")
+    parser.add_argument("--flags", default="-O0",
+                        help="additional compiler flags, e.g. the hyperion_platform include "
+                        "directory (default: %(default)s)")
+    args = parser.parse_args()
+    for corpus in args.corpus:
+        if corpus not in corpora:
+            parser.error(f"unknown corpus {corpus}")
+
+    includes = []
+    for include in args.include or [f"head={CORPUS_DIR.parents[2] / 'include'}"]:
+        label, _, directory = include.rpartition("=")
+        includes.append((label or directory, directory))
+    defines = args.define or [None]
+
+    with tempfile.TemporaryDirectory() as scratch:
+        obj = Path(scratch) / "corpus.o"
+        for corpus in args.corpus:
+            print(f"{corpus}:")
+            for label, directory in includes:
+                for define in defines:
+                    flags = [f"-I{directory}", *shlex.split(args.flags)]
+                    if define is not None:
+                        flags.append(f"-D{define}")
+                    name = label if define is None else f"{label} {define}"
+                    report = measure(args.compiler, flags, CORPUS_DIR / f"{corpus}.cpp", obj,
+                                     args.link_runs)
+                    print(f"  {name:40} {report}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,139 @@
+/// @file delta.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Wire size, encode, and apply time of `mpl::record_delta` patches
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/delta.h>
+#include <hyperion/platform/types.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "bench.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    using quote_delta = record_delta<List<u64,
+                                          u64,
+                                          double,
+                                          double,
+                                          double,
+                                          double,
+                                          u32,
+                                          u32,
+                                          i32,
+                                          i32,
+                                          u16,
+                                          u16,
+                                          u8,
+                                          u8,
+                                          u64,
+                                          double>>;
+    using quote = quote_delta::record_type;
+
+    constexpr auto num_records = 200'000_usize;
+
+    /// @brief Returns `num_records` pairs of random records, where each field of the second
+    /// of a pair differs from the first with probability `probability`
+    auto make_records(f64 probability) -> std::pair<std::vector<quote>, std::vector<quote>> {
+        auto rng = std::mt19937_64{7_u64}; // NOLINT(*-msc51-cpp)
+        auto changed = std::bernoulli_distribution{probability};
+        auto previous = std::vector<quote>(num_records);
+        auto current = std::vector<quote>(num_records);
+        for(auto index = 0_usize; index < num_records; ++index) {
+            [&]<usize... TIndices>([[maybe_unused]] std::index_sequence<TIndices...> indices) {
+                ((previous[index].template get<TIndices>()
+                  = static_cast<quote::field_type<TIndices>>(rng() % 1'000'000_u64)),
+                 ...);
+                current[index] = previous[index];
+                ((changed(rng) ? static_cast<void>(current[index].template get<TIndices>() += 1)
+                               : static_cast<void>(0)),
+                 ...);
+            }(std::make_index_sequence<quote::size()>{});
+        }
+        return {std::move(previous), std::move(current)};
+    }
+
+    /// @brief Reports the average wire size of, and time to encode and apply, patches
+    /// between records with each field changed with probability `probability`
+    auto report(f64 probability) -> void {
+        const auto [previous, current] = make_records(probability);
+        auto wire = std::vector<std::byte>(num_records * quote_delta::max_encoded_size());
+        auto sizes = std::vector<usize>(num_records);
+        auto wire_size = 0_usize;
+
+        const auto encode_ns = bench::best_of(5, [&]() {
+            auto offset = 0_usize;
+            for(auto index = 0_usize; index < num_records; ++index) {
+                sizes[index] = quote_delta::encode(
+                    previous[index],
+                    current[index],
+                    std::span{wire}.subspan(offset, quote_delta::max_encoded_size()));
+                offset += sizes[index];
+            }
+            wire_size = offset;
+        });
+
+        // applying a patch again leaves the record unchanged, so every repetition after the
+        // first applies the patches to their own results
+        auto targets = previous;
+        const auto apply_ns = bench::best_of(5, [&]() {
+            auto offset = 0_usize;
+            for(auto index = 0_usize; index < num_records; ++index) {
+                offset += quote_delta::apply(
+                    targets[index],
+                    std::span<const std::byte>{wire}.subspan(offset, sizes[index]));
+            }
+            bench::do_not_optimize(targets);
+        });
+
+        if(targets != current) {
+            std::printf("patches did not reproduce the current records\n");
+            return;
+        }
+
+        std::printf("%4.0f%% of fields changed: %5.1f bytes/record (full record %zu), "
+                    "encode %5.1f ns/record, apply %5.1f ns/record\n",
+                    probability * 100.0,
+                    static_cast<f64>(wire_size) / static_cast<f64>(num_records),
+                    sizeof(quote),
+                    encode_ns / static_cast<f64>(num_records),
+                    apply_ns / static_cast<f64>(num_records));
+    }
+} // namespace
+
+auto main() -> i32 {
+    for(const auto probability : {0.01, 0.10, 0.50}) {
+        report(probability);
+    }
+
+    return 0;
+}
@@ -0,0 +1,165 @@
+/// @file event_bus.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Publish latency of `mpl::event_bus` compared to a type-erased event bus
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/event_bus.h>
+#include <hyperion/platform/types.h>
+
+#include <cstdio>
+#include <functional>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "bench.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    constexpr auto num_publishes = 10'000'000_usize;
+
+    struct order_filled {
+        u64 id;
+        i64 quantity;
+    };
+
+    struct order_cancelled {
+        u64 id;
+    };
+
+    struct price_changed {
+        i64 price;
+    };
+
+    /// @brief The state updated by the handlers, shared by every bus so that they all do
+    /// the same work
+    struct book {
+        i64 position = 0_i64;
+        u64 cancels = 0_u64;
+        i64 last_price = 0_i64;
+    };
+
+    struct position_handler {
+        book* state = nullptr;
+
+        auto operator()(const order_filled& event) const noexcept -> void {
+            state->position += event.quantity;
+        }
+    };
+
+    struct cancel_handler {
+        book* state = nullptr;
+
+        auto operator()(const order_cancelled& event) const noexcept -> void {
+            state->cancels += event.id & 1_u64;
+        }
+    };
+
+    struct price_handler {
+        book* state = nullptr;
+
+        auto operator()(const price_changed& event) const noexcept -> void {
+            state->last_price = event.price;
+        }
+    };
+
+    /// @brief The event bus `event_bus` replaces: subscribers type-erased into
+    /// `std::function`s, in vectors looked up by the event's type on every publish
+    class erased_bus {
+      public:
+        template<typename TEvent, typename THandler>
+        auto subscribe(THandler handler) -> void {
+            m_subscribers[std::type_index{typeid(TEvent)}].emplace_back(
+                [handler](const void* event) { handler(*static_cast<const TEvent*>(event)); });
+        }
+
+        template<typename TEvent>
+        auto publish(const TEvent& event) -> void {
+            const auto found = m_subscribers.find(std::type_index{typeid(TEvent)});
+            if(found != m_subscribers.end()) {
+                for(const auto& subscriber : found->second) {
+                    subscriber(&event);
+                }
+            }
+        }
+
+      private:
+        std::unordered_map<std::type_index, std::vector<std::function<void(const void*)>>>
+            m_subscribers;
+    };
+
+    /// @brief Publishes `num_publishes` events, cycling through the three event types,
+    /// and returns the average time per publish, in nanoseconds
+    template<typename TPublish>
+    auto measure(book& state, TPublish publish) -> f64 {
+        const auto nanoseconds = bench::best_of(5, [&]() {
+            for(auto index = 0_usize; index < num_publishes; index += 3_usize) {
+                const auto value = static_cast<i64>(index);
+                publish(order_filled{index, value & 7_i64});
+                publish(order_cancelled{index});
+                publish(price_changed{value});
+            }
+            bench::do_not_optimize(state);
+        });
+        return nanoseconds / static_cast<f64>(num_publishes);
+    }
+} // namespace
+
+auto main() -> i32 {
+    auto state = book{};
+
+    using subscriptions = List<Pair<order_filled, position_handler>,
+                               Pair<order_cancelled, cancel_handler>,
+                               Pair<price_changed, price_handler>>;
+    auto static_bus = event_bus<subscriptions>{position_handler{&state},
+                                               cancel_handler{&state},
+                                               price_handler{&state}};
+    const auto static_ns
+        = measure(state, [&static_bus](const auto& event) { static_bus.publish(event); });
+
+    // the same handlers, all subscribed at runtime through the overflow path
+    auto overflow_bus
+        = event_bus<List<>, List<order_filled, order_cancelled, price_changed>>{};
+    overflow_bus.subscribe<order_filled>(position_handler{&state});
+    overflow_bus.subscribe<order_cancelled>(cancel_handler{&state});
+    overflow_bus.subscribe<price_changed>(price_handler{&state});
+    const auto overflow_ns
+        = measure(state, [&overflow_bus](const auto& event) { overflow_bus.publish(event); });
+
+    auto baseline = erased_bus{};
+    baseline.subscribe<order_filled>(position_handler{&state});
+    baseline.subscribe<order_cancelled>(cancel_handler{&state});
+    baseline.subscribe<price_changed>(price_handler{&state});
+    const auto erased_ns
+        = measure(state, [&baseline](const auto& event) { baseline.publish(event); });
+
+    std::printf("event_bus, static subscribers:     %6.2f ns/publish\n", static_ns);
+    std::printf("event_bus, runtime subscribers:    %6.2f ns/publish\n", overflow_ns);
+    std::printf("type_index map of std::functions:  %6.2f ns/publish\n", erased_ns);
+
+    return 0;
+}
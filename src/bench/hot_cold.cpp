@@ -0,0 +1,112 @@
+/// @file hot_cold.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Scan over the hot fields of 10M records, split by `mpl::hot_cold_array` or not
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/fixed_string.h>
+#include <hyperion/mpl/hot_cold.h>
+#include <hyperion/mpl/record.h>
+#include <hyperion/platform/types.h>
+
+#include <cstdio>
+#include <vector>
+
+#include "bench.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    constexpr auto num_orders = 10'000'000_usize;
+
+    using order_fields = List<Pair<u64, Value<false>>,              // id
+                              Pair<i64, Value<true>>,               // price
+                              Pair<u32, Value<true>>,               // quantity
+                              Pair<fixed_string<16>, Value<false>>, // client
+                              Pair<u64, Value<false>>>;             // timestamp
+
+    /// @brief The same fields, all in one record
+    using order = record<List<u64, i64, u32, fixed_string<16>, u64>>;
+
+    [[nodiscard]] auto price_of(usize index) noexcept -> i64 {
+        return static_cast<i64>(index % 1'000_usize) + 100_i64;
+    }
+
+    [[nodiscard]] auto quantity_of(usize index) noexcept -> u32 {
+        return static_cast<u32>(index % 13_usize) + 1_u32;
+    }
+
+    template<typename TScan>
+    auto report(const char* name, usize bytes_per_order, TScan scan) -> void {
+        const auto nanoseconds = bench::best_of(5, scan);
+        std::printf("%-30s %3zu bytes/order, %7.2f ms per scan, %5.2f ns/order\n",
+                    name,
+                    bytes_per_order,
+                    nanoseconds / 1.0e6,
+                    nanoseconds / static_cast<f64>(num_orders));
+    }
+} // namespace
+
+auto main() -> i32 {
+    auto combined = std::vector<order>(num_orders);
+    auto split = hot_cold_array<order_fields>{};
+    split.resize(num_orders);
+    for(auto index = 0_usize; index < num_orders; ++index) {
+        auto& current = combined[index];
+        current.get<0>() = index;
+        current.get<1>() = price_of(index);
+        current.get<2>() = quantity_of(index);
+        current.get<4>() = index * 3_usize;
+        split.get<0>(index) = index;
+        split.get<1>(index) = price_of(index);
+        split.get<2>(index) = quantity_of(index);
+        split.get<4>(index) = index * 3_usize;
+    }
+
+    using split_type = hot_cold_array<order_fields>;
+    report("std::vector<record>", sizeof(order), [&]() {
+        auto notional = 0_i64;
+        for(const auto& current : combined) {
+            notional += current.get<1>() * static_cast<i64>(current.get<2>());
+        }
+        bench::do_not_optimize(notional);
+    });
+    report("hot_cold_array::hot()", sizeof(split_type::hot_type), [&]() {
+        auto notional = 0_i64;
+        for(const auto& hot : split.hot()) {
+            notional += split_type::get<1>(hot) * static_cast<i64>(split_type::get<2>(hot));
+        }
+        bench::do_not_optimize(notional);
+    });
+    report("hot_cold_array::get<I>(index)", sizeof(split_type::hot_type), [&]() {
+        auto notional = 0_i64;
+        for(auto index = 0_usize; index < split.size(); ++index) {
+            notional += split.get<1>(index) * static_cast<i64>(split.get<2>(index));
+        }
+        bench::do_not_optimize(notional);
+    });
+
+    return 0;
+}
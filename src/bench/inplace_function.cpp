@@ -0,0 +1,121 @@
+/// @file inplace_function.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Construction and invocation cost of `mpl::inplace_function` and the `std` wrappers
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/inplace_function.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <cstdio>
+#include <functional>
+#include <version>
+
+#include "bench.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    constexpr auto iterations = 10'000'000_usize;
+
+    /// @brief A callable small enough for `std::function`'s small buffer in libstdc++,
+    /// libc++ and MSVC's STL
+    struct small_callable {
+        i64 offset;
+
+        auto operator()(i64 value) const noexcept -> i64 {
+            return value + offset;
+        }
+    };
+
+    /// @brief A callable too large for `std::function`'s small buffer, like a lambda
+    /// capturing several values
+    struct large_callable {
+        std::array<i64, 6> coefficients;
+
+        auto operator()(i64 value) const noexcept -> i64 {
+            return value * coefficients[0] + coefficients[5];
+        }
+    };
+
+    using inplace = inplace_function<i64(i64), List<small_callable, large_callable>>;
+
+    /// @brief Returns the average time, in nanoseconds, to construct a `TFunction` from a
+    /// `TCallable` and destroy it
+    template<typename TFunction, typename TCallable>
+    auto construct_ns(const TCallable& callable) -> f64 {
+        const auto nanoseconds = bench::best_of(5, [&]() {
+            for(auto index = 0_usize; index < iterations; ++index) {
+                auto func = TFunction{callable};
+                bench::do_not_optimize(func);
+            }
+        });
+        return nanoseconds / static_cast<f64>(iterations);
+    }
+
+    /// @brief Returns the average time, in nanoseconds, to invoke a `TFunction` holding a
+    /// `TCallable`
+    template<typename TFunction, typename TCallable>
+    auto invoke_ns(const TCallable& callable) -> f64 {
+        auto func = TFunction{callable};
+        const auto nanoseconds = bench::best_of(5, [&]() {
+            auto total = 0_i64;
+            for(auto index = 0_usize; index < iterations; ++index) {
+                // hide the held callable from the optimizer, so every call is indirect
+                bench::do_not_optimize(func);
+                total += func(static_cast<i64>(index));
+            }
+            bench::do_not_optimize(total);
+        });
+        return nanoseconds / static_cast<f64>(iterations);
+    }
+
+    template<typename TFunction>
+    auto report(const char* name) -> void {
+        const auto small = small_callable{3_i64};
+        const auto large = large_callable{{2_i64, 0_i64, 0_i64, 0_i64, 0_i64, 1_i64}};
+        std::printf("%-28s construct %5.2f ns (small) %6.2f ns (large), "
+                    "invoke %5.2f ns (small) %5.2f ns (large)\n",
+                    name,
+                    construct_ns<TFunction>(small),
+                    construct_ns<TFunction>(large),
+                    invoke_ns<TFunction>(small),
+                    invoke_ns<TFunction>(large));
+    }
+} // namespace
+
+auto main() -> i32 {
+    report<inplace>("mpl::inplace_function");
+    report<std::function<i64(i64)>>("std::function");
+#if defined(__cpp_lib_move_only_function)
+    report<std::move_only_function<i64(i64) const>>("std::move_only_function");
+#else
+    std::printf("std::move_only_function      not available in this standard library "
+                "and language mode\n");
+#endif // defined(__cpp_lib_move_only_function)
+
+    return 0;
+}
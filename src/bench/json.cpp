@@ -0,0 +1,167 @@
+/// @file json.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Decoding throughput of `mpl::json_record`, and of nlohmann::json when it is available
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/fixed_string.h>
+#include <hyperion/mpl/json.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if __has_include(<nlohmann/json.hpp>)
+    #include <nlohmann/json.hpp>
+    #define HYPERION_MPL_BENCH_HAS_NLOHMANN_JSON 1
+#else
+    #define HYPERION_MPL_BENCH_HAS_NLOHMANN_JSON 0
+#endif // __has_include(<nlohmann/json.hpp>)
+
+#include "bench.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    using order = json_record<List<Pair<Value<fixed_string{"id"}>, Type<u64>>,
+                                   Pair<Value<fixed_string{"price"}>, Type<double>>,
+                                   Pair<Value<fixed_string{"quantity"}>, Type<i32>>,
+                                   Pair<Value<fixed_string{"symbol"}>, Type<fixed_string<8>>>,
+                                   Pair<Value<fixed_string{"side"}>, Type<std::string_view>>,
+                                   Pair<Value<fixed_string{"is_open"}>, Type<bool>>>>;
+
+    /// @brief Generates `count` order objects with six known fields and three unknown ones,
+    /// including a nested array and a free text note of `note_size` characters
+    auto make_documents(usize count, usize note_size) -> std::vector<std::string> {
+        constexpr auto symbols
+            = std::array<const char*, 6>{"AAPL", "MSFT", "GOOG", "AMZN", "NVDA", "TSLA"};
+        auto rng = std::mt19937_64{42_u64}; // NOLINT(*-msc51-cpp)
+        const auto note = std::string(note_size, 'x');
+        auto documents = std::vector<std::string>{};
+        documents.reserve(count);
+        for(auto index = 0_usize; index < count; ++index) {
+            auto buffer = std::array<char, 256>{};
+            const auto length = std::snprintf(
+                buffer.data(),
+                buffer.size(),
+                R"({"id": %llu, "venue": "XNAS", "symbol": "%s", "price": %.2f, "quantity": %d, )"
+                R"("side": "%s", "tags": ["a", "b", {"nested": [1, 2, 3]}], "is_open": %s, )",
+                static_cast<unsigned long long>(rng()),
+                symbols[rng() % symbols.size()], // NOLINT(*-pro-bounds-constant-array-index)
+                static_cast<f64>(rng() % 100'000_u64) / 100.0,
+                static_cast<i32>(rng() % 1000_u64) - 500,
+                rng() % 2_u64 == 0_u64 ? "buy" : "sell",
+                rng() % 2_u64 == 0_u64 ? "true" : "false");
+            documents.push_back(std::string{buffer.data(), static_cast<usize>(length)}
+                                + R"("note": ")" + note + "\"}");
+        }
+        return documents;
+    }
+
+    /// @brief Returns the total size of `documents`, in bytes
+    auto total_bytes(const std::vector<std::string>& documents) -> usize {
+        auto bytes = 0_usize;
+        for(const auto& document : documents) {
+            bytes += document.size();
+        }
+        return bytes;
+    }
+
+    /// @brief Returns the throughput, in MB/s, of decoding `documents` with `json_record`
+    auto json_record_throughput(const std::vector<std::string>& documents) -> f64 {
+        const auto nanoseconds = bench::best_of(5, [&]() {
+            auto checksum = 0_u64;
+            for(const auto& document : documents) {
+                auto value = order{};
+                if(not value.decode(document)) {
+                    std::printf("failed to decode: %s\n", document.c_str());
+                    return;
+                }
+                checksum += value.get<"id">() + value.get<"side">().size()
+                            + static_cast<u64>(value.get<"symbol">().view().front());
+            }
+            bench::do_not_optimize(checksum);
+        });
+        return static_cast<f64>(total_bytes(documents)) / nanoseconds * 1.0e3;
+    }
+
+#if HYPERION_MPL_BENCH_HAS_NLOHMANN_JSON
+    /// @brief The fields of an order, as they would be copied out of an `nlohmann::json`
+    struct plain_order {
+        u64 id;
+        f64 price;
+        i32 quantity;
+        std::string symbol;
+        std::string side;
+        bool is_open;
+    };
+
+    /// @brief Returns the throughput, in MB/s, of parsing `documents` with `nlohmann::json`
+    /// and copying the known fields out of the document tree
+    auto nlohmann_throughput(const std::vector<std::string>& documents) -> f64 {
+        const auto nanoseconds = bench::best_of(5, [&]() {
+            auto checksum = 0_u64;
+            for(const auto& document : documents) {
+                const auto json = nlohmann::json::parse(document);
+                const auto value = plain_order{json["id"].get<u64>(),
+                                               json["price"].get<f64>(),
+                                               json["quantity"].get<i32>(),
+                                               json["symbol"].get<std::string>(),
+                                               json["side"].get<std::string>(),
+                                               json["is_open"].get<bool>()};
+                checksum += value.id + value.side.size() + static_cast<u64>(value.symbol.front());
+            }
+            bench::do_not_optimize(checksum);
+        });
+        return static_cast<f64>(total_bytes(documents)) / nanoseconds * 1.0e3;
+    }
+#endif // HYPERION_MPL_BENCH_HAS_NLOHMANN_JSON
+
+    auto report(usize note_size) -> void {
+        const auto documents = make_documents(100'000_usize, note_size);
+        std::printf("%zu-byte note, %zu bytes per object on average:\n",
+                    note_size,
+                    total_bytes(documents) / documents.size());
+        std::printf("    json_record:                 %8.1f MB/s\n",
+                    json_record_throughput(documents));
+#if HYPERION_MPL_BENCH_HAS_NLOHMANN_JSON
+        std::printf("    nlohmann::json parse + copy: %8.1f MB/s\n",
+                    nlohmann_throughput(documents));
+#else
+        std::printf("    nlohmann::json not found, skipping it\n");
+#endif // HYPERION_MPL_BENCH_HAS_NLOHMANN_JSON
+    }
+} // namespace
+
+auto main() -> i32 {
+    report(16_usize);
+    report(600_usize);
+
+    return 0;
+}
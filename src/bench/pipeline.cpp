@@ -0,0 +1,133 @@
+/// @file pipeline.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Throughput and latency of `mpl::pipeline` with 1 to 8 stages
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/pipeline.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "bench.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    struct add_one {
+        auto operator()(u64 value) const noexcept -> u64 {
+            return value + 1_u64;
+        }
+    };
+
+    template<usize TIndex, typename TType>
+    using repeat = TType;
+
+    template<usize... TIndices>
+    auto make_stages([[maybe_unused]] std::index_sequence<TIndices...> indices)
+        -> List<repeat<TIndices, add_one>...>;
+
+    template<usize TNumStages, usize TBatchSize>
+    using bench_pipeline = pipeline<u64,
+                                    decltype(make_stages(std::make_index_sequence<TNumStages>{})),
+                                    1024,
+                                    TBatchSize>;
+
+    /// @brief Returns the number of messages per second through `TNumStages` stages,
+    /// with the default batch size
+    template<usize TNumStages>
+    auto throughput() -> f64 {
+        static constexpr auto count = 2'000'000_u64;
+        auto stages = bench_pipeline<TNumStages, 64>{};
+        const auto nanoseconds = bench::best_of(5, [&]() {
+            auto next = 0_u64;
+            auto sum = 0_u64;
+            stages.run(
+                [&next](u64& input) {
+                    input = next++;
+                    return input < count;
+                },
+                [&sum](u64 output) { sum += output; });
+            bench::do_not_optimize(sum);
+        });
+        return static_cast<f64>(count) / nanoseconds * 1.0e9;
+    }
+
+    /// @brief Measures the end-to-end latency of single messages through `TNumStages`
+    /// stages, without batching, sending each message once the previous one has arrived
+    /// @return the median and 99th percentile latencies, in nanoseconds
+    template<usize TNumStages>
+    auto latency() -> std::pair<u64, u64> {
+        static constexpr auto count = 20'000_usize;
+        auto stages = bench_pipeline<TNumStages, 1>{};
+        auto latencies = std::vector<u64>{};
+        latencies.reserve(count);
+        auto sent_at = 0_u64;
+        auto arrived = std::atomic<usize>{0_usize};
+
+        auto sent = 0_usize;
+        stages.run(
+            [&](u64& input) {
+                // wait until the previous message has left the pipeline
+                while(arrived.load(std::memory_order_acquire) != sent) {
+                    std::this_thread::yield();
+                }
+                sent_at = bench::now_ns();
+                input = 0_u64;
+                return sent++ < count;
+            },
+            [&]([[maybe_unused]] u64 output) {
+                latencies.push_back(bench::now_ns() - sent_at);
+                arrived.fetch_add(1_usize, std::memory_order_release);
+            });
+
+        std::sort(latencies.begin(), latencies.end());
+        return {latencies[latencies.size() / 2], latencies[latencies.size() * 99 / 100]};
+    }
+
+    template<usize TNumStages>
+    auto report() -> void {
+        const auto messages_per_second = throughput<TNumStages>();
+        const auto [median, p99] = latency<TNumStages>();
+        std::printf("%zu stage(s): %8.2f M messages/s, latency median %6llu ns, p99 %7llu ns\n",
+                    TNumStages,
+                    messages_per_second / 1.0e6,
+                    static_cast<unsigned long long>(median),
+                    static_cast<unsigned long long>(p99));
+    }
+} // namespace
+
+auto main() -> i32 {
+    []<usize... TIndices>([[maybe_unused]] std::index_sequence<TIndices...> indices) {
+        (report<TIndices + 1_usize>(), ...);
+    }(std::make_index_sequence<8>{});
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+/// @file record_batch.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Scans over `mpl::record_batch` columns compared to an array of row structs
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/record_batch.h>
+#include <hyperion/platform/types.h>
+
+#include <cstdio>
+#include <random>
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include "bench.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    /// @brief A trade, as stored in an array of rows
+    struct trade {
+        u64 id;
+        f64 price;
+        u32 quantity;
+        u32 venue;
+        f64 bid;
+        f64 ask;
+        f64 high;
+        f64 low;
+    };
+
+    using trades = record_batch<List<u64, f64, u32, u32, f64, f64, f64, f64>>;
+    using trade_row = std::tuple<u64, f64, u32, u32, f64, f64, f64, f64>;
+
+    constexpr auto num_rows = 4'000'000_usize;
+    constexpr auto min_quantity = 500_u32;
+} // namespace
+
+auto main() -> i32 {
+    auto rng = std::mt19937_64{1_u64}; // NOLINT(*-msc51-cpp)
+    auto rows = std::vector<trade>(num_rows);
+    auto tuples = std::vector<trade_row>{};
+    tuples.reserve(num_rows);
+    for(auto& row : rows) {
+        row = trade{rng(),
+                    static_cast<f64>(rng() % 10'000_u64) / 10.0,
+                    static_cast<u32>(rng() % 1000_u64),
+                    static_cast<u32>(rng() % 8_u64),
+                    1.0,
+                    2.0,
+                    3.0,
+                    4.0};
+        tuples.emplace_back(row.id,
+                            row.price,
+                            row.quantity,
+                            row.venue,
+                            row.bid,
+                            row.ask,
+                            row.high,
+                            row.low);
+    }
+
+    auto batch = trades{};
+    const auto append_ns = bench::best_of(5, [&]() {
+        batch = trades{};
+        batch.append(std::span<const trade_row>{tuples});
+    });
+
+    // the notional value of the trades of more than `min_quantity`
+    const auto rows_ns = bench::best_of(5, [&]() {
+        auto notional = 0.0;
+        for(const auto& row : rows) {
+            if(row.quantity > min_quantity) {
+                notional += row.price * static_cast<f64>(row.quantity);
+            }
+        }
+        bench::do_not_optimize(notional);
+    });
+
+    const auto where_ns = bench::best_of(5, [&]() {
+        const auto selection = batch.where<2>([](u32 quantity) { return quantity > min_quantity; });
+        bench::do_not_optimize(selection);
+    });
+
+    const auto batch_ns = bench::best_of(5, [&]() {
+        const auto priced = batch.select<1, 2>();
+        const auto large
+            = priced.filter(priced.where<1>([](u32 quantity) { return quantity > min_quantity; }));
+        const auto prices = large.column<0>();
+        const auto quantities = large.column<1>();
+        auto notional = 0.0;
+        for(auto index = 0_usize; index < large.size(); ++index) {
+            notional += prices[index] * static_cast<f64>(quantities[index]);
+        }
+        bench::do_not_optimize(notional);
+    });
+
+    const auto per_row = [](f64 nanoseconds) {
+        return nanoseconds / static_cast<f64>(num_rows);
+    };
+    std::printf("%zu rows of %zu bytes\n", num_rows, sizeof(trade));
+    std::printf("append:                        %6.2f ns/row\n", per_row(append_ns));
+    std::printf("row scan and sum:              %6.2f ns/row\n", per_row(rows_ns));
+    std::printf("batch where:                   %6.2f ns/row\n", per_row(where_ns));
+    std::printf("batch select, filter, and sum: %6.2f ns/row\n", per_row(batch_ns));
+
+    return 0;
+}
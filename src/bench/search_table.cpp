@@ -0,0 +1,110 @@
+/// @file search_table.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Lookup cost of `mpl::search_table` compared to `std::lower_bound`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/search_table.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "bench.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    constexpr auto num_lookups = 1'000'000_usize;
+
+    /// @brief Returns `num_lookups` random keys, half of which are in a table whose keys
+    /// are the first `TSize` odd numbers
+    template<usize TSize>
+    auto make_lookups() -> std::vector<u32> {
+        auto engine = std::mt19937{TSize};
+        auto distribution = std::uniform_int_distribution<u32>{0_u32, 2_u32 * TSize};
+        auto lookups = std::vector<u32>(num_lookups);
+        std::generate(lookups.begin(), lookups.end(), [&]() { return distribution(engine); });
+        return lookups;
+    }
+
+    /// @brief Reports the average time per lookup in a table of `TSize` entries, for both
+    /// `search_table::find` and `std::lower_bound` over the sorted keys
+    template<usize TSize>
+    auto report() -> void {
+        // the table is built at runtime here, since a `List` of 64K `Pair`s is far beyond
+        // what is reasonable to build at compile time; lookups are the same either way
+        using entry = std::pair<u32, u32>;
+        auto entries = std::make_unique<std::array<entry, TSize>>();
+        auto keys = std::vector<u32>(TSize);
+        auto values = std::vector<u32>(TSize);
+        for(auto index = 0_usize; index < TSize; ++index) {
+            const auto key = static_cast<u32>(2_usize * index + 1_usize);
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            (*entries)[index] = entry{key, static_cast<u32>(index)};
+            keys[index] = key;
+            values[index] = static_cast<u32>(index);
+        }
+        std::shuffle(entries->begin(), entries->end(), std::mt19937{1_u32});
+        const auto table = std::make_unique<search_table<u32, u32, TSize>>(*entries);
+        const auto lookups = make_lookups<TSize>();
+
+        const auto table_ns = bench::best_of(5, [&]() {
+            auto sum = 0_u32;
+            for(const auto key : lookups) {
+                sum += table->value_or(key, 0_u32);
+            }
+            bench::do_not_optimize(sum);
+        });
+        const auto lower_bound_ns = bench::best_of(5, [&]() {
+            auto sum = 0_u32;
+            for(const auto key : lookups) {
+                const auto found = std::lower_bound(keys.begin(), keys.end(), key);
+                if(found != keys.end() && *found == key) {
+                    sum += values[static_cast<usize>(found - keys.begin())];
+                }
+            }
+            bench::do_not_optimize(sum);
+        });
+
+        std::printf("%6zu keys: search_table %6.2f ns/lookup, std::lower_bound %6.2f ns/lookup\n",
+                    TSize,
+                    table_ns / static_cast<f64>(num_lookups),
+                    lower_bound_ns / static_cast<f64>(num_lookups));
+    }
+} // namespace
+
+auto main() -> i32 {
+    report<64>();
+    report<4096>();
+    report<65536>();
+
+    return 0;
+}
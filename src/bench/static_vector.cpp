@@ -0,0 +1,140 @@
+/// @file static_vector.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Small hot-loop buffers: `mpl::static_vector` compared to `std::vector` with `reserve`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/static_vector.h>
+#include <hyperion/platform/types.h>
+
+#include <concepts>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    constexpr auto iterations = 2'000'000_usize;
+    constexpr auto capacity = 16_usize;
+
+    /// @brief Returns the number of elements to put in the buffer on iteration `index`,
+    /// between 1 and `capacity`
+    [[nodiscard]] auto count_of(usize index) noexcept -> usize {
+        return (index * 7_usize) % capacity + 1_usize;
+    }
+
+    template<typename TType>
+    [[nodiscard]] auto make(usize index) -> TType {
+        if constexpr(std::same_as<TType, std::string>) {
+            // short enough for the small string optimization, so only the buffer allocates
+            return std::string(index % 15_usize + 1_usize, 'x');
+        }
+        else {
+            return static_cast<TType>(index);
+        }
+    }
+
+    template<typename TType>
+    [[nodiscard]] auto weight(const TType& value) noexcept -> usize {
+        if constexpr(std::same_as<TType, std::string>) {
+            return value.size();
+        }
+        else {
+            return static_cast<usize>(value);
+        }
+    }
+
+    /// @brief Fills a buffer created by `make_buffer` on every iteration, then sums it.
+    /// Returns the average time per iteration, in nanoseconds
+    template<typename TType, typename TMakeBuffer>
+    auto fill_ns(TMakeBuffer make_buffer) -> f64 {
+        const auto nanoseconds = bench::best_of(5, [&]() {
+            auto total = 0_usize;
+            for(auto index = 0_usize; index < iterations; ++index) {
+                auto buffer = make_buffer();
+                for(auto element = 0_usize; element < count_of(index); ++element) {
+                    buffer.push_back(make<TType>(index + element));
+                }
+                for(const auto& value : buffer) {
+                    total += weight(value);
+                }
+                bench::do_not_optimize(buffer);
+            }
+            bench::do_not_optimize(total);
+        });
+        return nanoseconds / static_cast<f64>(iterations);
+    }
+
+    /// @brief Copies a filled buffer on every iteration. Returns the average time per copy,
+    /// in nanoseconds
+    template<typename TBuffer>
+    auto copy_ns(const TBuffer& source) -> f64 {
+        const auto nanoseconds = bench::best_of(5, [&]() {
+            for(auto index = 0_usize; index < iterations; ++index) {
+                auto copy = source;
+                bench::do_not_optimize(copy);
+            }
+        });
+        return nanoseconds / static_cast<f64>(iterations);
+    }
+
+    template<typename TType>
+    auto report(const char* name) -> void {
+        const auto fresh_static = fill_ns<TType>([] { return static_vector<TType, capacity>{}; });
+        const auto fresh_vector = fill_ns<TType>([] {
+            auto buffer = std::vector<TType>{};
+            buffer.reserve(capacity);
+            return buffer;
+        });
+
+        auto static_source = static_vector<TType, capacity>{};
+        auto vector_source = std::vector<TType>{};
+        vector_source.reserve(capacity);
+        for(auto index = 0_usize; index < capacity / 2_usize; ++index) {
+            static_source.push_back(make<TType>(index));
+            vector_source.push_back(make<TType>(index));
+        }
+
+        std::printf("%-12s fill + sum: static_vector %6.2f ns, std::vector + reserve %6.2f ns"
+                    " | copy of %zu: static_vector %6.2f ns, std::vector %6.2f ns\n",
+                    name,
+                    fresh_static,
+                    fresh_vector,
+                    capacity / 2_usize,
+                    copy_ns(static_source),
+                    copy_ns(vector_source));
+    }
+} // namespace
+
+auto main() -> i32 {
+    report<u32>("u32");
+    report<u64>("u64");
+    report<std::string>("std::string");
+
+    return 0;
+}
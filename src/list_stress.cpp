@@ -0,0 +1,200 @@
+/// @file list_stress.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Stress test exercising every `mpl::List` operation on large `List`s
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+// This translation unit is intentionally built with the compiler's default
+// `-ftemplate-depth`/`-fconstexpr-steps` (and equivalent) limits, so that it fails to compile
+// if any `List` operation regresses to recursion or work that grows too quickly with the
+// size of the `List`.
+
+#include <hyperion/mpl/list.h>
+#include <hyperion/platform/types.h>
+
+#include <ranges>
+#include <span>
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+    template<usize TIndex>
+    struct element_tag { };
+
+    template<typename TIndexSequence>
+    struct make_lists;
+
+    template<usize... TIndices>
+    struct make_lists<std::index_sequence<TIndices...>> {
+        using types = List<element_tag<TIndices>...>;
+        using values = List<Value<TIndices, usize>...>;
+    };
+
+    // `List<element_tag<0>, ..., element_tag<TSize - 1>>`
+    template<usize TSize>
+    using types = typename make_lists<std::make_index_sequence<TSize>>::types;
+
+    // `List<Value<0>, ..., Value<TSize - 1>>`
+    template<usize TSize>
+    using values = typename make_lists<std::make_index_sequence<TSize>>::values;
+
+    // selects the elements in the upper half of a `values<TSize>`
+    template<usize TSize>
+    struct upper_half {
+        [[nodiscard]] constexpr auto operator()(MetaValue auto value) const noexcept {
+            return Value<(decltype(value)::value >= TSize / 2), bool>{};
+        }
+    };
+
+    struct counter {
+        [[nodiscard]] constexpr auto
+        operator()(MetaValue auto state, [[maybe_unused]] auto element) const noexcept {
+            return state + 1_value;
+        }
+    };
+
+    struct serial_executor {
+        struct job {
+            void (*invoke)(void* context) noexcept;
+            void* context;
+        };
+
+        auto execute(std::span<const job> jobs) noexcept -> void {
+            for(const auto& work : jobs) {
+                work.invoke(work.context);
+            }
+        }
+    };
+
+    template<usize TSize>
+    [[nodiscard]] constexpr auto stress_queries() noexcept -> bool {
+        constexpr auto type_list = types<TSize>{};
+        constexpr auto value_list = values<TSize>{};
+        constexpr auto last = Value<TSize - 1, usize>{};
+
+        static_assert(type_list.size() == TSize);
+        static_assert(not type_list.is_empty());
+        static_assert(type_list.max_sizeof() == 1_usize);
+        static_assert(type_list.max_alignof() == 1_usize);
+        static_assert(type_list.all_trivially_copyable());
+        static_assert(type_list.all_standard_layout());
+        static_assert(type_list.all_implicit_lifetime());
+        static_assert(not type_list.all_unique_object_representations());
+        static_assert(type_list.satisfies([](MetaList auto) { return Value<true>{}; }));
+
+        static_assert(type_list.template at<TSize - 1>() == decltype_<element_tag<TSize - 1>>());
+        static_assert(type_list.at(last) == decltype_<element_tag<TSize - 1>>());
+        static_assert(type_list.front() == decltype_<element_tag<0>>());
+        static_assert(type_list.back() == decltype_<element_tag<TSize - 1>>());
+
+        static_assert(value_list.accumulate(0_value) == (TSize * (TSize - 1)) / 2);
+        static_assert(type_list.accumulate(0_value, counter{}) == TSize);
+
+        static_assert(type_list.find(decltype_<element_tag<TSize - 1>>())
+                      == decltype_<element_tag<TSize - 1>>());
+        static_assert(type_list.find(decltype_<element_tag<TSize>>())
+                      == decltype_<not_found_tag>());
+        static_assert(value_list.find_if(upper_half<TSize>{}) == Value<TSize / 2, usize>{});
+        static_assert(value_list.count_if(upper_half<TSize>{}) == TSize / 2);
+        static_assert(type_list.count(decltype_<element_tag<TSize / 2>>()) == 1_usize);
+        static_assert(type_list.contains(decltype_<element_tag<TSize - 1>>()));
+        static_assert(not type_list.contains(decltype_<element_tag<TSize>>()));
+        static_assert(type_list.all_of(trivially_copyable));
+        static_assert(value_list.any_of(upper_half<TSize>{}));
+        static_assert(type_list.none_of(is_const));
+        static_assert(value_list.index_if(upper_half<TSize>{}) == TSize / 2);
+        static_assert(type_list.index_of(decltype_<element_tag<TSize - 1>>()) == last);
+        static_assert(value_list.unwrap([](MetaValue auto... elements) {
+            return (0_usize + ... + decltype(elements)::value);
+        }) == (TSize * (TSize - 1)) / 2);
+
+        return true;
+    }
+
+    template<usize TSize>
+    [[nodiscard]] constexpr auto stress_transformations() noexcept -> bool {
+        constexpr auto type_list = types<TSize>{};
+        constexpr auto value_list = values<TSize>{};
+
+        static_assert(value_list.filter(upper_half<TSize>{}).size() == TSize / 2);
+        static_assert(value_list.filter(upper_half<TSize>{}).front() == Value<TSize / 2>{});
+        static_assert(value_list.remove_if(upper_half<TSize>{}).size() == TSize / 2);
+        static_assert(value_list.remove_if(upper_half<TSize>{}).back() == Value<TSize / 2 - 1>{});
+        static_assert(type_list.remove(decltype_<element_tag<0>>()).size() == TSize - 1);
+        static_assert(type_list.sift(value_list) == type_list);
+        static_assert(type_list.apply([](MetaType auto type) { return type.as_const(); })
+                          .all_of(is_const));
+
+        static_assert(type_list.push_front(1_value).size() == TSize + 1);
+        static_assert(type_list.push_back(1_value).size() == TSize + 1);
+        static_assert(type_list.push_front(type_list).size() == 2 * TSize);
+        static_assert(type_list.push_back(type_list).size() == 2 * TSize);
+        static_assert(type_list.pop_front().front() == decltype_<element_tag<1>>());
+        static_assert(type_list.pop_back().back() == decltype_<element_tag<TSize - 2>>());
+        static_assert(type_list.pop_back().size() == TSize - 1);
+
+        static_assert(type_list.zip(value_list).back()
+                      == Pair<element_tag<TSize - 1>, Value<TSize - 1, usize>>{});
+        static_assert(type_list == types<TSize>{});
+        static_assert(type_list != type_list.pop_back().push_back(decltype_<element_tag<TSize>>()));
+
+    #if __cpp_lib_ranges >= 202110L
+        static_assert((value_list | std::views::filter(upper_half<TSize>{})).size() == TSize / 2);
+        static_assert((type_list | std::views::reverse).front()
+                      == decltype_<element_tag<TSize - 1>>());
+        static_assert((type_list | std::views::drop(1_value)) == type_list.pop_front());
+    #endif // __cpp_lib_ranges >= 202110L
+
+        return true;
+    }
+
+    template<usize TSize>
+    [[nodiscard]] auto stress_iteration() noexcept -> bool {
+        auto visited = 0_usize;
+        types<TSize>{}.for_each([&visited](MetaType auto) { ++visited; });
+        types<TSize>{}.for_each_n([&visited](MetaType auto) { ++visited; }, Value<TSize / 2>{});
+
+        auto executor = serial_executor{};
+        types<TSize>{}.for_each_parallel([&visited](MetaType auto) { ++visited; }, executor);
+
+        return visited == TSize + TSize / 2 + TSize;
+    }
+
+    static_assert(stress_queries<1024>());
+    static_assert(stress_queries<4096>());
+    static_assert(stress_queries<16384>());
+
+    static_assert(stress_transformations<1024>());
+    static_assert(stress_transformations<4096>());
+    static_assert(stress_transformations<16384>());
+} // namespace
+
+[[nodiscard]] auto
+main([[maybe_unused]] i32 argc, [[maybe_unused]] const char* const* argv) -> i32 {
+    const auto passed
+        = stress_iteration<1024>() && stress_iteration<4096>() && stress_iteration<16384>();
+    return passed ? 0 : 1;
+}
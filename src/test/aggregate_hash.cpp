@@ -0,0 +1,189 @@
+/// @file aggregate_hash.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::aggregate_equal` and `mpl::aggregate_hash`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/aggregate_hash.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <span>
+#include <string>
+#include <unordered_set>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    struct packed {
+        u64 first;
+        u32 second;
+        u32 third;
+    };
+
+    struct padded {
+        u8 first;
+        u32 second;
+    };
+
+    struct with_float {
+        u32 first;
+        float second;
+    };
+
+    struct with_string {
+        u32 first;
+        std::string second;
+    };
+
+    using packed_fields
+        = List<Value<&packed::first>, Value<&packed::second>, Value<&packed::third>>;
+    using partial_fields = List<Value<&packed::first>, Value<&packed::second>>;
+    using padded_fields = List<Value<&padded::first>, Value<&padded::second>>;
+    using with_float_fields = List<Value<&with_float::first>, Value<&with_float::second>>;
+    using with_string_fields = List<Value<&with_string::first>, Value<&with_string::second>>;
+
+    /// @brief Checks that the bytewise path tells apart keys differing in any field
+    auto bytewise() -> void {
+        static_assert(aggregate_hash<packed_fields>::is_bytewise);
+        const auto equal = aggregate_equal<packed_fields>{};
+        const auto hash = aggregate_hash<packed_fields>{};
+
+        const auto key = packed{1_u64, 2_u32, 3_u32};
+        test::check(equal(key, packed{1_u64, 2_u32, 3_u32}));
+        test::check(hash(key) == hash(packed{1_u64, 2_u32, 3_u32}));
+
+        for(const auto& other : {packed{0_u64, 2_u32, 3_u32},
+                                 packed{1_u64, 0_u32, 3_u32},
+                                 packed{1_u64, 2_u32, 0_u32}})
+        {
+            test::check(not equal(key, other));
+            test::check(hash(key) != hash(other));
+        }
+    }
+
+    /// @brief Checks that fields missing from the `List` are ignored
+    auto partial() -> void {
+        static_assert(not aggregate_hash<partial_fields>::is_bytewise);
+        const auto equal = aggregate_equal<partial_fields>{};
+        const auto hash = aggregate_hash<partial_fields>{};
+
+        const auto key = packed{1_u64, 2_u32, 3_u32};
+        const auto unlisted_differs = packed{1_u64, 2_u32, 4_u32};
+        test::check(equal(key, unlisted_differs));
+        test::check(hash(key) == hash(unlisted_differs));
+        test::check(not equal(key, packed{1_u64, 3_u32, 3_u32}));
+    }
+
+    /// @brief Checks that padding bytes take no part in equality or hashing
+    auto padding() -> void {
+        static_assert(not aggregate_hash<padded_fields>::is_bytewise);
+        const auto equal = aggregate_equal<padded_fields>{};
+        const auto hash = aggregate_hash<padded_fields>{};
+
+        alignas(padded) auto lhs_storage = std::array<std::byte, sizeof(padded)>{};
+        alignas(padded) auto rhs_storage = std::array<std::byte, sizeof(padded)>{};
+        lhs_storage.fill(std::byte{0x00});
+        rhs_storage.fill(std::byte{0xFF});
+        // default-initializing leaves the padding bytes as they were in the storage
+        auto* lhs = ::new(lhs_storage.data()) padded;
+        auto* rhs = ::new(rhs_storage.data()) padded;
+        lhs->first = rhs->first = 7_u8;
+        lhs->second = rhs->second = 42_u32;
+
+        test::check(std::memcmp(lhs, rhs, sizeof(padded)) != 0);
+        test::check(equal(*lhs, *rhs));
+        test::check(hash(*lhs) == hash(*rhs));
+        test::check(not equal(*lhs, padded{7_u8, 43_u32}));
+    }
+
+    /// @brief Checks that floating point fields are compared by value, not by bytes
+    auto floating_point() -> void {
+        const auto equal = aggregate_equal<with_float_fields>{};
+        const auto hash = aggregate_hash<with_float_fields>{};
+
+        const auto positive_zero = with_float{1_u32, 0.0F};
+        const auto negative_zero = with_float{1_u32, -0.0F};
+        test::check(equal(positive_zero, negative_zero));
+        test::check(hash(positive_zero) == hash(negative_zero));
+        test::check(not equal(positive_zero, with_float{1_u32, 1.0F}));
+    }
+
+    /// @brief Checks fields hashed with `std::hash`, through an `std::unordered_set`
+    auto std_hash_fields() -> void {
+        auto set = std::unordered_set<with_string,
+                                      aggregate_hash<with_string_fields>,
+                                      aggregate_equal<with_string_fields>>{};
+        test::check(set.insert(with_string{1_u32, "one"}).second);
+        test::check(set.insert(with_string{2_u32, "one"}).second);
+        test::check(set.insert(with_string{1_u32, "two"}).second);
+        test::check(not set.insert(with_string{1_u32, "one"}).second);
+        test::check(set.size() == 3_usize);
+        test::check(set.contains(with_string{2_u32, "one"}));
+        test::check(not set.contains(with_string{2_u32, "two"}));
+    }
+
+    /// @brief Hashes every length from 0 to 128 bytes, covering each of the byte hash's
+    /// size classes, and checks that changing any one byte changes the hash
+    auto byte_hash_lengths() -> void {
+        auto bytes = std::array<std::byte, 128>{};
+        for(auto index = 0_usize; index < bytes.size(); ++index) {
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            bytes[index] = static_cast<std::byte>(index * 7_usize + 1_usize);
+        }
+
+        auto sensitive = true;
+        for(auto size = 0_usize; size <= bytes.size(); ++size) {
+            const auto view = std::span<const std::byte>{bytes}.first(size);
+            const auto hash = mpl::detail::hash_bytes(view);
+            sensitive = sensitive && hash == mpl::detail::hash_bytes(view);
+            for(auto index = 0_usize; index < size; ++index) {
+                auto changed = bytes;
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                changed[index] ^= std::byte{0x01};
+                sensitive = sensitive
+                            && hash != mpl::detail::hash_bytes(std::span<const std::byte>{changed}
+                                                              .first(size));
+            }
+        }
+        test::check(sensitive);
+    }
+} // namespace
+
+auto main() -> i32 {
+    bytewise();
+    partial();
+    padding();
+    floating_point();
+    std_hash_fields();
+    byte_hash_lengths();
+
+    return test::result();
+}
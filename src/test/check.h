@@ -0,0 +1,68 @@
+/// @file check.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Minimal runtime checking shared by the runtime test executables
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HYPERION_MPL_TEST_CHECK_H
+    #define HYPERION_MPL_TEST_CHECK_H
+
+#include <hyperion/platform/types.h>
+
+#include <atomic>
+#include <cstdio>
+#include <source_location>
+
+namespace hyperion::mpl::test {
+
+    /// @brief The number of checks that have failed in this test executable
+    inline std::atomic<i32> failures = 0; // NOLINT(*-avoid-non-const-global-variables)
+
+    /// @brief Records a failure, reporting the location of the check, if `condition` is
+    /// `false`. May be called from any thread
+    /// @param condition The checked condition
+    /// @param location The location of the check
+    /// @return `condition`
+    inline auto check(bool condition,
+                      const std::source_location location = std::source_location::current())
+        -> bool {
+        if(not condition) {
+            failures.fetch_add(1, std::memory_order_relaxed);
+            std::fprintf(stderr, // NOLINT(*-vararg)
+                         "%s:%u: check failed in `%s`\n",
+                         location.file_name(),
+                         static_cast<unsigned>(location.line()),
+                         location.function_name());
+        }
+        return condition;
+    }
+
+    /// @brief Returns the exit code of the test executable: `0` if every check passed
+    /// @return the exit code
+    [[nodiscard]] inline auto result() noexcept -> i32 {
+        return failures.load(std::memory_order_relaxed) == 0 ? 0 : 1;
+    }
+} // namespace hyperion::mpl::test
+
+#endif // HYPERION_MPL_TEST_CHECK_H
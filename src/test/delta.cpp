@@ -0,0 +1,254 @@
+/// @file delta.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::record_delta`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/delta.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    /// @brief A field with internal padding, compared with `operator==`
+    struct padded {
+        u8 tag;
+        u32 count;
+
+        friend constexpr auto operator==(const padded&, const padded&) noexcept -> bool
+            = default;
+    };
+
+    using quote = record_delta<List<u64, u32, u32, double, u8, u64, padded, i16, i16>>;
+    using state = quote::record_type;
+    using patch_buffer = std::array<std::byte, quote::max_encoded_size()>;
+
+    constexpr auto num_fields = 9_usize;
+    constexpr auto bitmap_size = 2_usize;
+
+    /// @brief Returns a `state` with every field drawn from `rng`
+    auto random_state(std::mt19937_64& rng) -> state {
+        return state{rng(),
+                     static_cast<u32>(rng()),
+                     static_cast<u32>(rng()),
+                     static_cast<double>(rng() % 1000_u64) / 8.0,
+                     static_cast<u8>(rng()),
+                     rng(),
+                     padded{static_cast<u8>(rng()), static_cast<u32>(rng())},
+                     static_cast<i16>(rng()),
+                     static_cast<i16>(rng())};
+    }
+
+    /// @brief Returns a copy of `previous` with the fields flagged in `mask` taken from
+    /// `replacement`
+    auto mix(const state& previous, const state& replacement, u64 mask) -> state {
+        auto result = previous;
+        [&]<usize... TIndices>([[maybe_unused]] std::index_sequence<TIndices...> indices) {
+            ((((mask >> TIndices) & 1_u64) != 0_u64
+                  ? static_cast<void>(result.template get<TIndices>()
+                                      = replacement.template get<TIndices>())
+                  : static_cast<void>(0)),
+             ...);
+        }(std::make_index_sequence<num_fields>{});
+        return result;
+    }
+
+    /// @brief A trivially copyable field that is not standard layout, with tail padding
+    struct derived_tail : padded {
+        u8 extra;
+    };
+
+    /// @brief A trivially copyable field with private members and tail padding
+    class private_tail {
+      public:
+        constexpr private_tail() noexcept = default;
+
+      private:
+        [[maybe_unused]] u32 m_count = 0_u32;
+        [[maybe_unused]] u8 m_tag = 0_u8;
+    };
+
+    /// @brief Checks that the offset `TDelta` computes for each field, which determines the
+    /// bytes compared and copied for each run, is where `record_type::get` places the field
+    template<typename TDelta>
+    auto offsets_match_fields() -> void {
+        auto value = typename TDelta::record_type{};
+        const auto offset = [&value](const auto& field) {
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            return static_cast<usize>(reinterpret_cast<const std::byte*>(&field)
+                                      - reinterpret_cast<const std::byte*>(&value));
+        };
+        [&]<usize... TIndices>([[maybe_unused]] std::index_sequence<TIndices...> indices) {
+            (test::check(offset(value.template get<TIndices>())
+                         == TDelta::template offset_of<TIndices>()),
+             ...);
+        }(std::make_index_sequence<TDelta::record_type::size()>{});
+    }
+
+    /// @brief Checks the field offsets of records with padding between fields, fields with
+    /// tail padding, and fields that are not standard layout
+    auto field_offsets() -> void {
+        offsets_match_fields<quote>();
+        offsets_match_fields<record_delta<List<u8, u16, u8, u64>>>();
+        offsets_match_fields<record_delta<List<derived_tail, u8, u8, u16, double>>>();
+        offsets_match_fields<record_delta<List<private_tail, u8, i16, u8, private_tail>>>();
+        offsets_match_fields<record_delta<List<u32>>>();
+    }
+
+    /// @brief Encodes and applies patches between random states differing in random
+    /// subsets of fields, checking that applying each patch reproduces the new state
+    auto round_trip() -> void {
+        auto rng = std::mt19937_64{7_u64}; // NOLINT(*-msc51-cpp)
+        auto all_matched = true;
+        for(auto iteration = 0_usize; iteration < 20'000_usize; ++iteration) {
+            const auto previous = random_state(rng);
+            const auto current = mix(previous, random_state(rng), rng());
+
+            auto patch = patch_buffer{};
+            const auto size = quote::encode(previous, current, patch);
+            auto target = previous;
+            const auto applied = quote::apply(target, std::span{patch}.first(size));
+            all_matched = all_matched && size >= bitmap_size && applied == size
+                          && target == current;
+        }
+        test::check(all_matched);
+    }
+
+    /// @brief Checks the exact size of patches with no, one, and every field changed
+    auto patch_sizes() -> void {
+        auto rng = std::mt19937_64{11_u64}; // NOLINT(*-msc51-cpp)
+        const auto previous = random_state(rng);
+        auto patch = patch_buffer{};
+
+        auto size = quote::encode(previous, previous, patch);
+        test::check(size == bitmap_size);
+        test::check(patch[0] == std::byte{0} && patch[1] == std::byte{0});
+
+        auto current = previous;
+        current.get<3>() += 1.0;
+        size = quote::encode(previous, current, patch);
+        test::check(size == bitmap_size + sizeof(double));
+        test::check(patch[0] == std::byte{0b1000} && patch[1] == std::byte{0});
+
+        const auto different = state{~previous.get<0>(),
+                                     ~previous.get<1>(),
+                                     ~previous.get<2>(),
+                                     previous.get<3>() + 1.0,
+                                     static_cast<u8>(~previous.get<4>()),
+                                     ~previous.get<5>(),
+                                     padded{static_cast<u8>(~previous.get<6>().tag), 0_u32},
+                                     static_cast<i16>(~previous.get<7>()),
+                                     static_cast<i16>(~previous.get<8>())};
+        size = quote::encode(previous, different, patch);
+        test::check(size == quote::max_encoded_size());
+
+        auto too_small = std::array<std::byte, quote::max_encoded_size() - 1_usize>{};
+        test::check(quote::encode(previous, current, too_small) == 0_usize);
+    }
+
+    /// @brief Checks that floating point fields are compared by representation, and fields
+    /// with padding by `operator==`
+    auto field_comparison() -> void {
+        auto previous = state{};
+        auto patch = patch_buffer{};
+
+        auto current = previous;
+        current.get<3>() = -0.0;
+        auto size = quote::encode(previous, current, patch);
+        test::check(size == bitmap_size + sizeof(double));
+        auto target = previous;
+        test::check(quote::apply(target, std::span{patch}.first(size)) == size);
+        test::check(std::signbit(target.get<3>()));
+
+        previous.get<3>() = std::numeric_limits<double>::quiet_NaN();
+        current = previous;
+        test::check(quote::encode(previous, current, patch) == bitmap_size);
+
+        // only the padding of the `padded` field differs
+        auto with_padding = std::array<std::byte, sizeof(state)>{};
+        with_padding.fill(std::byte{0xAB});
+        auto* const padded_previous = ::new(with_padding.data()) state;
+        *padded_previous = state{};
+        padded_previous->get<6>() = padded{1_u8, 2_u32};
+        current = state{};
+        current.get<6>() = padded{1_u8, 2_u32};
+        test::check(quote::encode(*padded_previous, current, patch) == bitmap_size);
+    }
+
+    /// @brief Checks that truncated and malformed patches are rejected without changing the
+    /// target
+    auto rejected_patches() -> void {
+        auto rng = std::mt19937_64{13_u64}; // NOLINT(*-msc51-cpp)
+        const auto previous = random_state(rng);
+        const auto current = mix(previous, random_state(rng), 0b1'0110'1011_u64);
+        auto patch = patch_buffer{};
+        const auto size = quote::encode(previous, current, patch);
+
+        auto all_rejected = true;
+        for(auto length = 0_usize; length < size; ++length) {
+            auto target = previous;
+            all_rejected = all_rejected
+                           && quote::apply(target, std::span{patch}.first(length)) == 0_usize
+                           && target == previous;
+        }
+        test::check(all_rejected);
+
+        // bits past the last field must be clear
+        auto malformed = patch;
+        malformed[1] |= std::byte{0b10};
+        auto target = previous;
+        test::check(quote::apply(target, std::span{malformed}.first(size)) == 0_usize);
+        test::check(target == previous);
+
+        // trailing bytes after a patch are not consumed
+        auto stream = std::vector<std::byte>(size + bitmap_size);
+        std::copy_n(patch.begin(), size, stream.begin());
+        test::check(quote::apply(target, stream) == size && target == current);
+        test::check(quote::apply(target, std::span{stream}.subspan(size)) == bitmap_size);
+        test::check(target == current);
+    }
+} // namespace
+
+auto main() -> i32 {
+    field_offsets();
+    round_trip();
+    patch_sizes();
+    field_comparison();
+    rejected_patches();
+
+    return test::result();
+}
@@ -0,0 +1,173 @@
+/// @file event_bus.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for the runtime subscribers of `mpl::event_bus`
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <hyperion/mpl/event_bus.h>
+#include <hyperion/platform/types.h>
+
+#include <string>
+#include <vector>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    struct filled {
+        u64 id;
+    };
+    struct cancelled {
+        u64 id;
+    };
+    struct ignored { };
+
+    /// @brief Records each event it handles into a shared log, tagged with its name
+    struct logger {
+        std::vector<std::string>* log;
+        std::string name;
+
+        auto operator()(const filled& event) const -> void {
+            log->push_back(name + ":filled " + std::to_string(event.id));
+        }
+        auto operator()(const cancelled& event) const -> void {
+            log->push_back(name + ":cancelled " + std::to_string(event.id));
+        }
+    };
+
+    using bus_type = event_bus<List<Pair<filled, logger>, Pair<filled, logger>>,
+                               List<filled, cancelled>>;
+
+    /// @brief Checks that static subscribers are invoked in listed order, followed by the
+    /// runtime subscribers in order of subscription
+    auto delivery_order() -> void {
+        auto log = std::vector<std::string>{};
+        auto bus = bus_type{logger{&log, "static0"}, logger{&log, "static1"}};
+        bus.subscribe<filled>(logger{&log, "runtime0"});
+        bus.subscribe<filled>(logger{&log, "runtime1"});
+
+        bus.publish(filled{7_u64});
+        test::check(log
+                    == std::vector<std::string>{"static0:filled 7",
+                                                "static1:filled 7",
+                                                "runtime0:filled 7",
+                                                "runtime1:filled 7"});
+    }
+
+    /// @brief Checks that publishing events without subscribers invokes nothing, whether or
+    /// not the event accepts runtime subscribers
+    auto no_subscribers() -> void {
+        auto log = std::vector<std::string>{};
+        auto bus = bus_type{logger{&log, "static0"}, logger{&log, "static1"}};
+        bus.subscribe<filled>(logger{&log, "runtime0"});
+
+        // no static subscribers, and accepts runtime subscribers but has none
+        bus.publish(cancelled{1_u64});
+        // neither a static subscriber nor accepts runtime subscribers
+        bus.publish(ignored{});
+        test::check(log.empty());
+
+        bus.subscribe<cancelled>(logger{&log, "runtime1"});
+        bus.publish(cancelled{2_u64});
+        test::check(log == std::vector<std::string>{"runtime1:cancelled 2"});
+    }
+
+    /// @brief Checks that unsubscribing removes exactly the given runtime subscriber,
+    /// keeping the order of the rest, and that stale or mismatched ids are rejected
+    auto unsubscribe() -> void {
+        auto log = std::vector<std::string>{};
+        auto bus = bus_type{logger{&log, "static0"}, logger{&log, "static1"}};
+        const auto first = bus.subscribe<filled>(logger{&log, "runtime0"});
+        const auto second = bus.subscribe<filled>(logger{&log, "runtime1"});
+        const auto third = bus.subscribe<filled>(logger{&log, "runtime2"});
+        const auto other = bus.subscribe<cancelled>(logger{&log, "runtime3"});
+        test::check(first != second && second != third && third != other);
+
+        test::check(bus.unsubscribe<filled>(second));
+        test::check(not bus.unsubscribe<filled>(second));
+        // `other` is a subscription to `cancelled`, not `filled`
+        test::check(not bus.unsubscribe<filled>(other));
+
+        bus.publish(filled{3_u64});
+        bus.publish(cancelled{4_u64});
+        test::check(log
+                    == std::vector<std::string>{"static0:filled 3",
+                                                "static1:filled 3",
+                                                "runtime0:filled 3",
+                                                "runtime2:filled 3",
+                                                "runtime3:cancelled 4"});
+
+        test::check(bus.unsubscribe<filled>(first) && bus.unsubscribe<filled>(third)
+                    && bus.unsubscribe<cancelled>(other));
+        log.clear();
+        bus.publish(filled{5_u64});
+        bus.publish(cancelled{6_u64});
+        test::check(log == std::vector<std::string>{"static0:filled 5", "static1:filled 5"});
+
+        // ids are not reused after unsubscribing
+        const auto fourth = bus.subscribe<filled>(logger{&log, "runtime4"});
+        test::check(fourth != first && fourth != second && fourth != third && fourth != other);
+    }
+
+    /// @brief Checks that a runtime subscriber can subscribe while an event is being
+    /// published, and that the new subscribers only receive later events
+    auto subscribe_while_publishing() -> void {
+        auto log = std::vector<std::string>{};
+        auto bus = bus_type{logger{&log, "static0"}, logger{&log, "static1"}};
+        bus.subscribe<filled>([&](const filled& event) {
+            log.push_back("runtime0:filled " + std::to_string(event.id));
+            // enough subscribers to outgrow any initial allocation
+            for(auto index = 0_usize; index < 64_usize; ++index) {
+                bus.subscribe<filled>(logger{&log, "late"});
+            }
+            log.push_back("runtime0:subscribed " + std::to_string(event.id));
+        });
+        bus.subscribe<filled>(logger{&log, "runtime1"});
+
+        bus.publish(filled{1_u64});
+        test::check(log
+                    == std::vector<std::string>{"static0:filled 1",
+                                                "static1:filled 1",
+                                                "runtime0:filled 1",
+                                                "runtime0:subscribed 1",
+                                                "runtime1:filled 1"});
+
+        log.clear();
+        bus.publish(filled{2_u64});
+        test::check(log.size() == 2_usize + 2_usize + 64_usize + 1_usize
+                    && log[4] == "runtime1:filled 2" && log[5] == "late:filled 2");
+    }
+} // namespace
+
+auto main() -> i32 {
+    delivery_order();
+    no_subscribers();
+    unsubscribe();
+    subscribe_while_publishing();
+
+    return test::result();
+}
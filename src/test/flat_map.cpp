@@ -0,0 +1,149 @@
+/// @file flat_map.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::flat_map`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <hyperion/mpl/flat_map.h>
+#include <hyperion/platform/types.h>
+
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    /// @brief A value whose construction from a negative number throws
+    struct picky {
+        std::string text;
+
+        explicit picky(i32 value) : text{std::to_string(value)} {
+            if(value < 0) {
+                throw std::invalid_argument{"negative"};
+            }
+        }
+    };
+
+    /// @brief Checks that a value constructor throwing in `try_emplace` leaves the map
+    /// unchanged, with its keys and values still in step
+    auto throwing_value_constructor() -> void {
+        auto map = flat_map<i32, picky, 4>{};
+        test::check(map.try_emplace(1, 1));
+        test::check(map.try_emplace(3, 3));
+
+        auto threw = false;
+        try {
+            static_cast<void>(map.try_emplace(2, -2));
+        }
+        catch(const std::invalid_argument&) {
+            threw = true;
+        }
+        test::check(threw);
+        test::check(map.size() == 2_usize && map.values().size() == 2_usize);
+        test::check(not map.contains(2));
+        test::check(map.at(1).text == "1" && map.at(3).text == "3");
+
+        test::check(map.try_emplace(2, 2));
+        test::check(map.at(2).text == "2" && map.at(3).text == "3");
+    }
+
+    /// @brief Checks that `try_emplace` on a full map throws without changing it
+    auto full_map() -> void {
+        auto map = flat_map<std::string, i32, 2>{{"a", 1}, {"c", 3}};
+        auto threw = false;
+        try {
+            static_cast<void>(map.try_emplace("b", 2));
+        }
+        catch(const std::length_error&) {
+            threw = true;
+        }
+        test::check(threw);
+        test::check(map.size() == 2_usize && map.at("a") == 1 && map.at("c") == 3);
+        test::check(not map.try_emplace("a", 10) && map.at("a") == 1);
+    }
+
+    /// @brief Checks bulk construction from ranges that are not random access, and that
+    /// oversized and unsorted ranges throw
+    auto range_construction() -> void {
+        const auto entries = std::list<std::pair<std::string, i32>>{{"c", 3}, {"a", 1}, {"c", 30}};
+        const auto map = flat_map<std::string, i32, 4>{entries};
+        test::check(map.size() == 2_usize && map.keys()[0] == "a" && map.at("c") == 3);
+
+        const auto keys = std::list<i32>{1, 4, 9};
+        test::check(flat_set<i32, 4>{sorted_unique, keys} == flat_set<i32, 4>{9, 4, 1});
+
+        auto threw = false;
+        try {
+            static_cast<void>(flat_set<i32, 2>{keys});
+        }
+        catch(const std::length_error&) {
+            threw = true;
+        }
+        test::check(threw);
+
+        threw = false;
+        try {
+            static_cast<void>(flat_map<i32, i32, 4>{
+                sorted_unique,
+                std::vector<std::pair<i32, i32>>{{2, 0}, {1, 0}}});
+        }
+        catch(const std::invalid_argument&) {
+            threw = true;
+        }
+        test::check(threw);
+    }
+
+    /// @brief Checks that a `flat_set` of non-trivial keys can be built, searched,
+    /// iterated and modified
+    auto string_set() -> void {
+        test::check(flat_set<std::string, 4>{"b", "a"}.contains(std::string{"a"}));
+
+        auto set = flat_set<std::string, 4>{"c", "a", "c"};
+        test::check(set.size() == 2_usize && *set.begin() == "a");
+        test::check(set.insert("b") && not set.insert("a"));
+        test::check(set.erase(std::string{"c"}) && not set.contains(std::string{"c"}));
+
+        auto joined = std::string{};
+        for(const auto& key : set) {
+            joined += key;
+        }
+        test::check(joined == "ab");
+    }
+} // namespace
+
+auto main() -> i32 {
+    throwing_value_constructor();
+    full_map();
+    range_construction();
+    string_set();
+
+    return test::result();
+}
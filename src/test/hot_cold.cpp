@@ -0,0 +1,205 @@
+/// @file hot_cold.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::hot_cold_array`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/hot_cold.h>
+#include <hyperion/platform/types.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    /// @brief Hot and cold fields interleaved, so that neither block stores them in
+    /// declaration order
+    using order_fields = List<Pair<u8, Value<false>>,
+                              Pair<i64, Value<true>>,
+                              Pair<u64, Value<false>>,
+                              Pair<u32, Value<true>>,
+                              Pair<std::string, Value<false>>,
+                              Pair<u8, Value<true>>>;
+    using orders = hot_cold_array<order_fields>;
+
+    /// @brief Appends records with distinct values in every field, and checks that
+    /// `get<I>(index)` returns each of them, from both the hot and the cold block
+    auto push_back_round_trips() -> void {
+        constexpr auto count = 100_usize;
+        auto values = orders{};
+        values.reserve(count);
+        for(auto index = 0_usize; index < count; ++index) {
+            values.push_back(static_cast<u8>(index),
+                             -static_cast<i64>(index) * 1'000'000'007,
+                             static_cast<u64>(index) << 40U,
+                             static_cast<u32>(index * 3),
+                             std::to_string(index),
+                             static_cast<u8>(255 - index));
+        }
+
+        test::check(values.size() == count);
+        test::check(values.hot().size() == count && values.cold().size() == count);
+
+        auto matches = true;
+        for(auto index = 0_usize; index < count; ++index) {
+            matches = matches && values.get<0>(index) == static_cast<u8>(index)
+                      && values.get<1>(index) == -static_cast<i64>(index) * 1'000'000'007
+                      && values.get<2>(index) == static_cast<u64>(index) << 40U
+                      && values.get<3>(index) == static_cast<u32>(index * 3)
+                      && values.get<4>(index) == std::to_string(index)
+                      && values.get<5>(index) == static_cast<u8>(255 - index);
+        }
+        test::check(matches);
+
+        const auto& constant = values;
+        test::check(constant.get<2>(count - 1) == static_cast<u64>(count - 1) << 40U);
+        test::check(constant.get<5>(count - 1) == static_cast<u8>(255 - (count - 1)));
+    }
+
+    /// @brief Checks that writes through `get<I>(index)` land in the block that stores the
+    /// field, and that writes to a block are visible through `get<I>(index)`
+    auto writes_reach_blocks() -> void {
+        auto values = orders{};
+        values.push_back(1_u8, 2_i64, 3_u64, 4_u32, std::string{"five"}, 6_u8);
+        values.push_back(7_u8, 8_i64, 9_u64, 10_u32, std::string{"eleven"}, 12_u8);
+
+        values.get<1>(1) = 80_i64;
+        values.get<4>(1) += "!";
+        test::check(orders::get<1>(values.hot()[1]) == 80_i64);
+        test::check(orders::get<4>(values.cold()[1]) == "eleven!");
+
+        orders::get<3>(values.hot()[0]) = 40_u32;
+        orders::get<0>(values.cold()[0]) = 10_u8;
+        test::check(values.get<3>(0) == 40_u32);
+        test::check(values.get<0>(0) == 10_u8);
+
+        // the other record is untouched
+        test::check(values.get<1>(0) == 2_i64 && values.get<4>(0) == "five");
+        test::check(values.get<3>(1) == 10_u32 && values.get<0>(1) == 7_u8);
+    }
+
+    /// @brief Checks that `push_back` forwards its arguments, moving from rvalues
+    auto push_back_forwards() -> void {
+        using fields = List<Pair<std::unique_ptr<i32>, Value<false>>, Pair<i32, Value<true>>>;
+        auto values = hot_cold_array<fields>{};
+        auto owned = std::make_unique<i32>(42);
+        values.push_back(std::move(owned), 7);
+
+        test::check(owned == nullptr); // NOLINT(*-use-after-move, *-invalid-access-moved)
+        test::check(values.get<0>(0) != nullptr && *values.get<0>(0) == 42);
+        test::check(values.get<1>(0) == 7);
+    }
+
+    /// @brief Checks an array with no cold fields, which stores no cold blocks
+    auto all_hot() -> void {
+        auto values = hot_cold_array<List<Pair<u32, Value<true>>, Pair<u16, Value<true>>>>{};
+        values.push_back(1_u32, 2_u16);
+        values.push_back(3_u32, 4_u16);
+
+        test::check(values.size() == 2_usize && values.cold().empty());
+        test::check(values.get<0>(1) == 3_u32 && values.get<1>(1) == 4_u16);
+
+        values.resize(3_usize);
+        test::check(values.get<0>(2) == 0_u32 && values.get<1>(2) == 0_u16);
+        values.clear();
+        test::check(values.empty());
+    }
+
+    /// @brief A field that can be made to throw from its default, copy, and move
+    /// constructors
+    // NOLINTNEXTLINE(*-special-member-functions)
+    struct fragile {
+        static inline auto armed = false; // NOLINT(*-avoid-non-const-global-variables)
+
+        i32 number = 0;
+
+        fragile() {
+            throw_if_armed();
+        }
+        fragile(i32 init) noexcept : number{init} { // NOLINT(*-explicit-conversions)
+        }
+        fragile(const fragile& other) : number{other.number} {
+            throw_if_armed();
+        }
+        fragile(fragile&& other) : number{other.number} { // NOLINT(*-noexcept-move*)
+            throw_if_armed();
+        }
+        auto operator=(const fragile& other) -> fragile& = default;
+        auto operator=(fragile&& other) noexcept -> fragile& = default;
+        ~fragile() noexcept = default;
+
+        static auto throw_if_armed() -> void {
+            if(armed) {
+                throw std::runtime_error{"fragile field construction failed"};
+            }
+        }
+    };
+
+    /// @brief Checks that the hot and cold blocks keep the same size when growing the cold
+    /// block throws
+    auto throwing_cold_field() -> void {
+        using fields = List<Pair<i32, Value<true>>, Pair<fragile, Value<false>>>;
+        auto values = hot_cold_array<fields>{};
+        values.push_back(1, 2);
+
+        const auto throws = [](auto&& operation) {
+            fragile::armed = true;
+            auto threw = false;
+            try {
+                operation();
+            }
+            catch(const std::runtime_error&) {
+                threw = true;
+            }
+            fragile::armed = false;
+            return threw;
+        };
+
+        test::check(throws([&] { values.push_back(3, 4); }));
+        test::check(values.size() == 1_usize && values.cold().size() == 1_usize);
+
+        test::check(throws([&] { values.resize(4_usize); }));
+        test::check(values.size() == 1_usize && values.cold().size() == 1_usize);
+
+        test::check(values.get<0>(0) == 1 && values.get<1>(0).number == 2);
+        values.push_back(5, 6);
+        test::check(values.size() == 2_usize && values.get<1>(1).number == 6);
+    }
+} // namespace
+
+auto main() -> i32 {
+    push_back_round_trips();
+    writes_reach_blocks();
+    push_back_forwards();
+    all_hot();
+    throwing_cold_field();
+
+    return test::result();
+}
@@ -0,0 +1,233 @@
+/// @file injector.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::injector`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <hyperion/mpl/injector.h>
+#include <hyperion/mpl/thread_pool.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    /// @brief Records the order components are constructed and destroyed in
+    struct event_log {
+        std::atomic<usize> num_constructed = 0_usize;
+        std::atomic<usize> num_destroyed = 0_usize;
+        std::array<i32, 8> destroyed = {};
+
+        auto reset() noexcept -> void {
+            num_constructed = 0_usize;
+            num_destroyed = 0_usize;
+        }
+    };
+
+    // NOLINTNEXTLINE(*-avoid-non-const-global-variables)
+    auto events = event_log{};
+
+    /// @brief Base of the test components, logging their construction and destruction
+    template<i32 TId>
+    struct logged {
+        logged() noexcept {
+            events.num_constructed.fetch_add(1_usize);
+        }
+        logged(const logged&) = delete;
+        logged(logged&&) = delete;
+        auto operator=(const logged&) -> logged& = delete;
+        auto operator=(logged&&) -> logged& = delete;
+        ~logged() noexcept {
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            events.destroyed[events.num_destroyed.fetch_add(1_usize)] = TId;
+        }
+    };
+
+    struct config : logged<1> {
+        i32 pool_size = 4;
+    };
+
+    struct database : logged<2> {
+        explicit database(const config& cfg) noexcept : connections{cfg.pool_size * 2} {
+        }
+        i32 connections;
+    };
+
+    struct metrics : logged<3> {
+        alignas(64) std::array<u64, 4> samples = {};
+    };
+
+    struct cache : logged<4> {
+        cache(database& database_ref, metrics& metrics_ref) noexcept
+            : db{&database_ref}, stats{&metrics_ref} {
+        }
+        database* db;
+        metrics* stats;
+    };
+
+    struct order_service : logged<5> {
+        order_service(cache& cache_ref, const config& config_ref) noexcept
+            : orders{&cache_ref}, cfg{&config_ref} {
+        }
+        cache* orders;
+        const config* cfg;
+    };
+
+    struct failing_service {
+        explicit failing_service([[maybe_unused]] cache& cache_ref) {
+            throw std::runtime_error{"failing_service"};
+        }
+    };
+
+    using services = injector<List<order_service, cache, metrics, database, config>>;
+
+    /// @brief Checks that every component of `container` was constructed from the other
+    /// components of `container`, and is suitably aligned
+    auto check_wiring(services& container) -> void {
+        auto& orders = container.get<order_service>();
+        auto& cached = container.get<cache>();
+        test::check(orders.orders == &cached);
+        test::check(orders.cfg == &container.get<config>());
+        test::check(cached.db == &container.get<database>());
+        test::check(cached.stats == &container.get<metrics>());
+        test::check(container.get<database>().connections == 8);
+        const auto address = reinterpret_cast<std::uintptr_t>(&container.get<metrics>());
+        test::check(address % alignof(metrics) == 0);
+        test::check(events.num_constructed == 5_usize);
+    }
+
+    /// @brief Checks that the components were destroyed in the reverse of the construction
+    /// order (`metrics` and `config` form the first level, so either may come first)
+    auto check_destruction_order() -> void {
+        test::check(events.num_destroyed == 5_usize);
+        test::check(events.destroyed[0] == 5 && events.destroyed[1] == 4
+                    && events.destroyed[2] == 2);
+        test::check((events.destroyed[3] == 1 && events.destroyed[4] == 3)
+                    || (events.destroyed[3] == 3 && events.destroyed[4] == 1));
+    }
+
+    /// @brief Constructs the components on the calling thread
+    auto construct_inline() -> void {
+        events.reset();
+        {
+            auto container = services{};
+            check_wiring(container);
+        }
+        check_destruction_order();
+    }
+
+    /// @brief Constructs the components on a `work_stealing_pool`, with each level's
+    /// components constructed in parallel
+    auto construct_on_executor() -> void {
+        auto pool = work_stealing_pool{4_usize};
+        for(auto repetition = 0_usize; repetition < 32_usize; ++repetition) {
+            events.reset();
+            {
+                auto container = services{pool};
+                check_wiring(container);
+            }
+            check_destruction_order();
+        }
+    }
+
+    /// @brief Checks that when a constructor throws, the components that were already
+    /// constructed are destroyed and the exception is rethrown
+    template<typename... TArgs>
+    auto constructor_throws(TArgs&... args) -> void {
+        events.reset();
+        auto threw = false;
+        try {
+            auto container
+                = injector<List<failing_service, cache, metrics, database, config>>{args...};
+        }
+        catch(const std::runtime_error&) {
+            threw = true;
+        }
+        test::check(threw);
+        test::check(events.num_constructed == 4_usize && events.num_destroyed == 4_usize);
+        test::check(events.destroyed[0] == 4 && events.destroyed[1] == 2);
+        test::check((events.destroyed[2] == 1 && events.destroyed[3] == 3)
+                    || (events.destroyed[2] == 3 && events.destroyed[3] == 1));
+    }
+
+    /// @brief Executor running each job on the calling thread, which throws after running
+    /// the jobs of its second call
+    struct throwing_executor {
+        struct job {
+            void (*invoke)(void* context) noexcept;
+            void* context;
+        };
+
+        usize calls = 0_usize;
+
+        auto execute(std::span<const job> jobs) -> void {
+            for(const auto& current : jobs) {
+                current.invoke(current.context);
+            }
+            if(++calls == 2_usize) {
+                throw std::runtime_error{"throwing_executor"};
+            }
+        }
+    };
+
+    /// @brief Checks that when the executor throws, the components that were already
+    /// constructed, including those of the level it was running, are destroyed and the
+    /// exception is rethrown
+    auto executor_throws() -> void {
+        events.reset();
+        auto executor = throwing_executor{};
+        auto threw = false;
+        try {
+            auto container = services{executor};
+        }
+        catch(const std::runtime_error&) {
+            threw = true;
+        }
+        test::check(threw && executor.calls == 2_usize);
+        test::check(events.num_constructed == 3_usize && events.num_destroyed == 3_usize);
+        test::check(events.destroyed[0] == 2);
+        test::check((events.destroyed[1] == 1 && events.destroyed[2] == 3)
+                    || (events.destroyed[1] == 3 && events.destroyed[2] == 1));
+    }
+} // namespace
+
+auto main() -> i32 {
+    construct_inline();
+    construct_on_executor();
+    constructor_throws();
+    auto pool = work_stealing_pool{4_usize};
+    constructor_throws(pool);
+    executor_throws();
+
+    return test::result();
+}
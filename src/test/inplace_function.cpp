@@ -0,0 +1,222 @@
+/// @file inplace_function.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::inplace_function`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/inplace_function.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    /// @brief A callable that counts how many instances of it are alive, and how many
+    /// times it has been copied and moved
+    struct counted {
+        static inline auto live = 0;   // NOLINT(*-avoid-non-const-global-variables)
+        static inline auto copies = 0; // NOLINT(*-avoid-non-const-global-variables)
+        static inline auto moves = 0;  // NOLINT(*-avoid-non-const-global-variables)
+
+        std::string label;
+
+        explicit counted(std::string init) : label{std::move(init)} {
+            ++live;
+        }
+        counted(const counted& other) : label{other.label} {
+            ++live;
+            ++copies;
+        }
+        counted(counted&& other) noexcept : label{std::move(other.label)} {
+            ++live;
+            ++moves;
+        }
+        auto operator=(const counted&) -> counted& = default;
+        auto operator=(counted&&) noexcept -> counted& = default;
+        ~counted() noexcept {
+            --live;
+        }
+
+        auto operator()(i32 value) const -> i32 {
+            return value + static_cast<i32>(label.size());
+        }
+
+        static auto reset_counts() noexcept -> void {
+            copies = 0;
+            moves = 0;
+        }
+    };
+
+    /// @brief A trivially copyable callable, larger than `counted`
+    struct offsets {
+        std::array<i32, 16> values;
+
+        auto operator()(i32 value) const noexcept -> i32 {
+            return value + values[0] + values[15];
+        }
+    };
+
+    using function = inplace_function<i32(i32), List<counted, offsets>>;
+
+    static_assert(std::is_trivially_copyable_v<offsets>);
+    static_assert(not std::is_trivially_copyable_v<counted>);
+
+    auto invoke() -> void {
+        auto captured = 10;
+        auto lambda_func = function{[&captured](i32 value) { return value * captured; }};
+        test::check(lambda_func(3) == 30);
+        captured = 20;
+        test::check(lambda_func(3) == 60);
+
+        auto offsets_func = function{offsets{{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2}}};
+        test::check(offsets_func(4) == 7);
+
+        auto total = 0;
+        auto add = inplace_function<void(i32&, std::unique_ptr<i32>), List<offsets>>{
+            [](i32& out, std::unique_ptr<i32> value) { out += *value; }};
+        add(total, std::make_unique<i32>(5));
+        add(total, std::make_unique<i32>(6));
+        test::check(total == 11);
+
+        // a function pointer is held like any other callable
+        auto negate = function{+[](i32 value) { return -value; }};
+        test::check(negate(4) == -4);
+    }
+
+    /// @brief Checks that copies and moves of a non-trivial callable go through its copy and
+    /// move constructors, and that every instance is destroyed
+    auto lifetimes() -> void {
+        {
+            const auto original = counted{"four"};
+            counted::reset_counts();
+
+            auto func = function{original};
+            test::check(counted::copies == 1 && counted::moves == 0);
+            test::check(counted::live == 2);
+
+            auto copy = func;
+            test::check(counted::copies == 2 && counted::live == 3);
+            test::check(copy(1) == 5 && func(1) == 5);
+
+            auto moved = std::move(func);
+            test::check(counted::moves == 1);
+            test::check(counted::live == 3);
+            // NOLINTNEXTLINE(bugprone-use-after-move, hicpp-invalid-access-moved)
+            test::check(func == nullptr && not static_cast<bool>(func));
+            test::check(moved(0) == 4);
+
+            copy = nullptr;
+            test::check(counted::live == 2);
+
+            copy = moved;
+            test::check(counted::live == 3 && copy(0) == 4);
+
+            // replacing a non-trivial callable with a trivial one destroys the old one
+            copy = offsets{};
+            test::check(counted::live == 2 && copy(3) == 3);
+
+            moved = std::move(copy);
+            test::check(counted::live == 1 && moved(3) == 3);
+
+            // self-assignment leaves the callable in place
+            auto& self = moved;
+            moved = self;
+            test::check(moved(3) == 3);
+        }
+        test::check(counted::live == 0);
+    }
+
+    /// @brief Checks that copies of a trivially copyable callable are independent
+    auto trivial_copies() -> void {
+        struct accumulator {
+            i32 total = 0;
+
+            auto operator()(i32 value) noexcept -> i32 {
+                total += value;
+                return total;
+            }
+        };
+
+        using accumulating = inplace_function<i32(i32), List<accumulator>>;
+        auto func = accumulating{accumulator{}};
+        test::check(func(1) == 1);
+        test::check(func(2) == 3);
+
+        auto copy = func;
+        test::check(copy(10) == 13);
+        test::check(func(1) == 4);
+
+        auto moved = std::move(copy);
+        test::check(moved(1) == 14);
+        // NOLINTNEXTLINE(bugprone-use-after-move, hicpp-invalid-access-moved)
+        test::check(copy == nullptr);
+    }
+
+    /// @brief Checks that invoking an empty `inplace_function` throws
+    /// `std::bad_function_call`
+    auto empty_call() -> void {
+        const auto throws = [](const function& func) {
+            try {
+                static_cast<void>(func(1));
+            }
+            catch(const std::bad_function_call&) {
+                return true;
+            }
+            return false;
+        };
+
+        test::check(throws(function{}));
+        test::check(throws(function{nullptr}));
+        test::check(function{} == nullptr);
+
+        auto func = function{offsets{}};
+        test::check(not throws(func));
+        func = nullptr;
+        test::check(throws(func));
+
+        auto source = function{offsets{}};
+        auto destination = std::move(source);
+        // NOLINTNEXTLINE(bugprone-use-after-move, hicpp-invalid-access-moved)
+        test::check(throws(source));
+        test::check(not throws(destination));
+    }
+} // namespace
+
+auto main() -> i32 {
+    invoke();
+    lifetimes();
+    trivial_copies();
+    empty_call();
+
+    return test::result();
+}
@@ -0,0 +1,206 @@
+/// @file json.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::json_record`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <hyperion/mpl/fixed_string.h>
+#include <hyperion/mpl/json.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <string_view>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    using trade = json_record<List<Pair<Value<fixed_string{"id"}>, Type<u64>>,
+                                   Pair<Value<fixed_string{"qty"}>, Type<i32>>,
+                                   Pair<Value<fixed_string{"price"}>, Type<double>>,
+                                   Pair<Value<fixed_string{"symbol"}>, Type<fixed_string<8>>>,
+                                   Pair<Value<fixed_string{"venue"}>, Type<std::string_view>>,
+                                   Pair<Value<fixed_string{"open"}>, Type<bool>>>>;
+
+    /// @brief Decodes `text` into a default `trade`, checking that it fails with `error`
+    /// at `offset`
+    auto check_error(std::string_view text, json_errc error, usize offset) -> void {
+        auto value = trade{};
+        const auto result = value.decode(text);
+        test::check(result.error == error);
+        test::check(result.offset == offset);
+    }
+
+    /// @brief Decodes a record with every field type, surrounded and interspersed with
+    /// whitespace
+    auto valid_record() -> void {
+        constexpr auto text = std::string_view{" \n{\"id\": 42, \"qty\" :-7,\t\"price\": 101.25,"
+                                               "\r\n \"symbol\": \"ABC\", \"venue\": \"XNAS\","
+                                               " \"open\": true }\n"};
+        auto value = trade{};
+        const auto result = value.decode(text);
+        test::check(static_cast<bool>(result) && result.offset == text.size());
+        test::check(value.get<"id">() == 42_u64 && value.get<"qty">() == -7);
+        test::check(value.get<"price">() == 101.25);
+        test::check(value.get<"symbol">().view() == "ABC");
+        // `std::string_view` fields refer into the input
+        test::check(value.get<"venue">() == "XNAS");
+        test::check(value.get<"venue">().data() == text.data() + text.find("XNAS"));
+        test::check(value.get<"open">());
+
+        auto empty = trade{};
+        test::check(static_cast<bool>(empty.decode("{ }")) && empty.get<"id">() == 0_u64);
+    }
+
+    /// @brief Checks that values of keys that are not fields are skipped, however deeply
+    /// they nest, and that `null`s and repeated keys are handled
+    auto skipped_fields() -> void {
+        constexpr auto text = std::string_view{
+            R"({"meta": {"tags": ["a", "}]", {"q": "\"{["}], "n": null, "x": -1e9},)"
+            R"( "id": 7, "flags": [true, false, [[]]], "note": "say \"hi\"", "count": 3,)"
+            R"( "price": null, "id": 8})"};
+        auto value = trade{};
+        value.get<"price">() = 2.5;
+        const auto result = value.decode(text);
+        test::check(static_cast<bool>(result) && result.offset == text.size());
+        test::check(value.get<"id">() == 8_u64);
+        test::check(value.get<"price">() == 2.5);
+    }
+
+    /// @brief Checks that `fixed_string` fields are unescaped, `std::string_view` fields
+    /// keep their escape sequences, and keys are not unescaped
+    auto escapes() -> void {
+        auto value = trade{};
+        auto result = value.decode(R"({"symbol": "a\"\\\né", "venue": "x\ty"})");
+        test::check(static_cast<bool>(result));
+        test::check(value.get<"symbol">().view() == "a\"\\\n\xC3\xA9");
+        test::check(value.get<"venue">() == R"(x\ty)");
+
+        result = value.decode(R"({"symbol": "😀"})");
+        test::check(static_cast<bool>(result));
+        test::check(value.get<"symbol">().view() == "\xF0\x9F\x98\x80");
+
+        // an escaped key names no field, so its value is skipped
+        value.get<"id">() = 0_u64;
+        test::check(static_cast<bool>(value.decode(R"({"\u0069d": 5})")));
+        test::check(value.get<"id">() == 0_u64);
+
+        check_error(R"({"symbol": "\ud83d"})", json_errc::invalid_value, 19_usize);
+        check_error(R"({"symbol": "\q"})", json_errc::invalid_value, 15_usize);
+    }
+
+    /// @brief Checks that every proper prefix of a valid record fails to decode, and that
+    /// input ending inside the object is reported as such
+    auto truncated() -> void {
+        constexpr auto text = std::string_view{
+            R"({"id": 42, "skip": [1, {"a": "b"}], "symbol": "A\"B", "open": false})"};
+        for(auto length = 0_usize; length < text.size(); ++length) {
+            auto value = trade{};
+            const auto result = value.decode(text.substr(0_usize, length));
+            test::check(result.error == json_errc::unexpected_end
+                        || result.error == json_errc::syntax_error);
+        }
+
+        check_error("", json_errc::unexpected_end, 0_usize);
+        check_error(R"({"id": 42)", json_errc::unexpected_end, 9_usize);
+        check_error(R"({"id": 42,)", json_errc::unexpected_end, 10_usize);
+        check_error(R"({"symbol": "AB)", json_errc::unexpected_end, 14_usize);
+        check_error(R"({"skip": [1, {"a": )", json_errc::unexpected_end, 19_usize);
+    }
+
+    /// @brief Checks that input that is not a JSON object is rejected as a syntax error
+    auto malformed() -> void {
+        check_error("[1]", json_errc::syntax_error, 0_usize);
+        check_error(R"({id: 1})", json_errc::syntax_error, 1_usize);
+        check_error(R"({"id" 1})", json_errc::syntax_error, 6_usize);
+        check_error(R"({"id": 1,})", json_errc::syntax_error, 9_usize);
+        check_error(R"({"id": 1 "qty": 2})", json_errc::syntax_error, 9_usize);
+        check_error(R"({"id": 1} x)", json_errc::syntax_error, 10_usize);
+        check_error(R"({"open": truex})", json_errc::syntax_error, 13_usize);
+        check_error(R"({"qty": 12abc})", json_errc::syntax_error, 10_usize);
+    }
+
+    /// @brief Checks that numbers must follow the JSON grammar, rather than everything
+    /// `std::from_chars` accepts
+    auto number_grammar() -> void {
+        constexpr auto invalid = std::array<std::string_view, 10>{
+            R"({"price": nan})",
+            R"({"price": NaN})",
+            R"({"price": inf})",
+            R"({"price": -Infinity})",
+            R"({"price": +1})",
+            R"({"price": .5})",
+            R"({"price": 1.})",
+            R"({"price": 1e})",
+            R"({"price": 01})",
+            R"({"qty": -007})",
+        };
+        for(const auto text : invalid) {
+            auto value = trade{};
+            const auto result = value.decode(text);
+            test::check(result.error == json_errc::syntax_error);
+            test::check(value.get<"price">() == 0.0 && value.get<"qty">() == 0);
+        }
+
+        auto value = trade{};
+        test::check(static_cast<bool>(value.decode(R"({"price": -0.0e+0, "qty": 0})")));
+        test::check(static_cast<bool>(value.decode(R"({"price": 2.5E-1})")));
+        test::check(value.get<"price">() == 0.25);
+    }
+
+    /// @brief Checks that valid JSON values that do not fit their field's type are rejected
+    /// as invalid values, and leave the field unchanged
+    auto invalid_values() -> void {
+        check_error(R"({"id": -1})", json_errc::invalid_value, 9_usize);
+        check_error(R"({"id": 18446744073709551616})", json_errc::invalid_value, 27_usize);
+        check_error(R"({"qty": 1.5})", json_errc::invalid_value, 11_usize);
+        check_error(R"({"qty": 1e3})", json_errc::invalid_value, 11_usize);
+        check_error(R"({"qty": "1"})", json_errc::invalid_value, 8_usize);
+        check_error(R"({"open": 1})", json_errc::invalid_value, 9_usize);
+        check_error(R"({"venue": 1})", json_errc::invalid_value, 10_usize);
+        check_error(R"({"symbol": ["A"]})", json_errc::invalid_value, 11_usize);
+        check_error(R"({"symbol": "NINECHARS"})", json_errc::invalid_value, 22_usize);
+
+        // fields decoded before the error keep their new values
+        auto value = trade{};
+        const auto result = value.decode(R"({"id": 3, "qty": true, "open": true})");
+        test::check(result.error == json_errc::invalid_value);
+        test::check(value.get<"id">() == 3_u64 && not value.get<"open">());
+    }
+} // namespace
+
+auto main() -> i32 {
+    valid_record();
+    skipped_fields();
+    escapes();
+    truncated();
+    malformed();
+    number_grammar();
+    invalid_values();
+
+    return test::result();
+}
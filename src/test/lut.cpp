@@ -0,0 +1,128 @@
+/// @file lut.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::make_lut`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/lut.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <concepts>
+#include <type_traits>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    /// @brief A generator whose entries are distinct across the whole of every table
+    /// below, so that an entry stored at the wrong coordinates is detected
+    constexpr auto encode = [](i32 first, i32 second, i32 third) noexcept {
+        return first * 10'000 + second * 100 + third;
+    };
+
+    /// @brief Checks that the first dimension of a table covering `[B, E)` starts at index
+    /// `0` with the entry for `B`, and ends at index `E - B - 1` with the entry for `E - 1`
+    auto offset_range() -> void {
+        static constexpr auto table
+            = make_lut([](i32 value) noexcept { return value * 3; }, Pair<Value<-4>, Value<5>>{});
+
+        test::check(decltype(table)::size() == 9_usize);
+        test::check(table[0] == -12);
+        test::check(table[8] == 12);
+
+        auto matches = true;
+        for(auto value = -4; value < 5; ++value) {
+            matches = matches && table[static_cast<usize>(value + 4)] == value * 3;
+        }
+        test::check(matches);
+    }
+
+    /// @brief Checks every entry of a three dimensional table whose dimensions are a
+    /// `Value` range and two offset `Pair` ranges, including the entries at the bounds of
+    /// every dimension
+    auto nested_table() -> void {
+        static constexpr auto table = make_lut(encode,
+                                               Value<3>{},
+                                               Pair<Value<-2>, Value<2>>{},
+                                               Pair<Value<10>, Value<13>>{});
+        using table_type = std::remove_cvref_t<decltype(table)>;
+
+        test::check(table_type::rank() == 3_usize);
+        test::check(table_type::extents() == std::array{3_usize, 4_usize, 3_usize});
+        // the entries span [-190, 20112]
+        test::check(std::same_as<table_type::array_type,
+                                 std::array<std::array<std::array<i16, 3>, 4>, 3>>);
+
+        auto matches = true;
+        for(auto first = 0; first < 3; ++first) {
+            for(auto second = -2; second < 2; ++second) {
+                for(auto third = 10; third < 13; ++third) {
+                    const auto entry = table[static_cast<usize>(first)]
+                                            [static_cast<usize>(second + 2)]
+                                            [static_cast<usize>(third - 10)];
+                    matches = matches && entry == encode(first, second, third);
+                }
+            }
+        }
+        test::check(matches);
+
+        test::check(table[0][0][0] == encode(0, -2, 10));
+        test::check(table[2][3][2] == encode(2, 1, 12));
+        test::check(table.array()[2][3][2] == table[2][3][2]);
+        test::check(static_cast<usize>(table.end() - table.begin()) == 3_usize);
+    }
+
+    /// @brief Checks that entries at the limits of the narrowest element types are stored
+    /// exactly, and that one past those limits selects the next wider type
+    auto element_type_bounds() -> void {
+        static constexpr auto to_u8_max
+            = make_lut([](i32 value) noexcept { return value; }, Pair<Value<250>, Value<256>>{});
+        static constexpr auto past_u8_max
+            = make_lut([](i32 value) noexcept { return value; }, Pair<Value<250>, Value<257>>{});
+        static constexpr auto to_i8_min
+            = make_lut([](i32 value) noexcept { return value; }, Pair<Value<-128>, Value<0>>{});
+        static constexpr auto past_i8_min
+            = make_lut([](i32 value) noexcept { return value; }, Pair<Value<-129>, Value<0>>{});
+
+        test::check(std::same_as<decltype(to_u8_max)::value_type, u8>);
+        test::check(to_u8_max[5] == 255);
+        test::check(std::same_as<decltype(past_u8_max)::value_type, u16>);
+        test::check(past_u8_max[6] == 256);
+        test::check(std::same_as<decltype(to_i8_min)::value_type, i8>);
+        test::check(to_i8_min[0] == -128);
+        test::check(std::same_as<decltype(past_i8_min)::value_type, i16>);
+        test::check(past_i8_min[0] == -129);
+    }
+} // namespace
+
+auto main() -> i32 {
+    offset_range();
+    nested_table();
+    element_type_bounds();
+
+    return test::result();
+}
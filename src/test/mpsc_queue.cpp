@@ -0,0 +1,222 @@
+/// @file mpsc_queue.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::mpsc_queue`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/mpsc_queue.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <concepts>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    /// @brief A message that counts how many instances of it are alive
+    // NOLINTNEXTLINE(*-special-member-functions)
+    struct counted {
+        static inline auto live = 0; // NOLINT(*-avoid-non-const-global-variables)
+        u32 id;
+
+        explicit counted(u32 init) noexcept : id{init} {
+            ++live;
+        }
+        counted(counted&& other) noexcept : id{other.id} {
+            ++live;
+        }
+        ~counted() noexcept {
+            --live;
+        }
+    };
+
+    /// @brief Pushes messages of each type, then drains them, checking that each arrives
+    /// once, in order, as the type it was pushed as
+    auto push_and_drain() -> void {
+        auto queue = mpsc_queue<List<u32, std::string, counted>, 8>{};
+        test::check(queue.try_push(1_u32));
+        test::check(queue.try_push(std::string{"two"}));
+        test::check(queue.try_emplace<counted>(3_u32));
+        test::check(queue.try_emplace<u32>(4_u32));
+        test::check(queue.size_approx() == 4_usize);
+        test::check(counted::live == 1);
+
+        auto seen = std::vector<std::string>{};
+        const auto handled = queue.drain([&seen](auto&& message) {
+            using message_type = std::remove_cvref_t<decltype(message)>;
+            if constexpr(std::same_as<message_type, u32>) {
+                seen.push_back("u32 " + std::to_string(message));
+            }
+            else if constexpr(std::same_as<message_type, std::string>) {
+                seen.push_back("string " + message);
+            }
+            else {
+                seen.push_back("counted " + std::to_string(message.id));
+            }
+        });
+
+        test::check(handled == 4_usize);
+        test::check(seen == std::vector<std::string>{"u32 1", "string two", "counted 3", "u32 4"});
+        test::check(counted::live == 0);
+        test::check(queue.size_approx() == 0_usize);
+        test::check(queue.drain([]([[maybe_unused]] auto&& message) {}) == 0_usize);
+    }
+
+    /// @brief Fills the queue, then drains it a few messages at a time, for enough laps of
+    /// the ring that the indices wrap around it many times
+    auto full_and_partial_drain() -> void {
+        auto queue = mpsc_queue<List<u32, u64>, 4>{};
+        auto next_in = 0_u32;
+        auto next_out = 0_u32;
+        auto in_order = true;
+        const auto check_order = [&](auto&& message) {
+            in_order = in_order && static_cast<u32>(message) == next_out++;
+        };
+
+        for(auto lap = 0_usize; lap < 32_usize; ++lap) {
+            while(queue.try_push(next_in)) {
+                ++next_in;
+            }
+            test::check(queue.size_approx() == 4_usize);
+            test::check(not queue.try_push(u64{next_in}));
+
+            test::check(queue.drain(check_order, 3_usize) == 3_usize);
+            test::check(queue.try_push(u64{next_in++}));
+            test::check(queue.drain(check_order) == 2_usize);
+        }
+        test::check(in_order);
+        test::check(next_out == next_in);
+    }
+
+    /// @brief Checks that messages left in the queue are destroyed with it
+    auto destroys_remaining() -> void {
+        {
+            auto queue = std::make_unique<mpsc_queue<List<counted>, 8>>();
+            for(auto id = 0_u32; id < 5_u32; ++id) {
+                test::check(queue->try_emplace<counted>(id));
+            }
+            test::check(queue->drain([]([[maybe_unused]] counted&& message) {}, 2_usize)
+                        == 2_usize);
+            test::check(counted::live == 3);
+        }
+        test::check(counted::live == 0);
+    }
+
+    /// @brief Checks that a message whose handler throws is still destroyed and its slot
+    /// released, and that draining can resume after it
+    auto throwing_handler() -> void {
+        auto queue = mpsc_queue<List<counted>, 2>{};
+        test::check(queue.try_emplace<counted>(0_u32));
+        test::check(queue.try_emplace<counted>(1_u32));
+
+        auto threw = false;
+        try {
+            static_cast<void>(queue.drain([](counted&& message) {
+                if(message.id == 0_u32) {
+                    throw std::runtime_error{"handler failed"};
+                }
+            }));
+        }
+        catch(const std::runtime_error&) {
+            threw = true;
+        }
+
+        test::check(threw);
+        test::check(counted::live == 1);
+        test::check(queue.try_emplace<counted>(2_u32));
+
+        auto ids = std::vector<u32>{};
+        test::check(queue.drain([&ids](counted&& message) { ids.push_back(message.id); })
+                    == 2_usize);
+        test::check(ids == std::vector{1_u32, 2_u32});
+        test::check(counted::live == 0);
+    }
+
+    /// @brief Pushes from several producer threads at once, checking that every message
+    /// arrives exactly once, and that the messages of each producer arrive in order
+    auto threaded_producers() -> void {
+        static constexpr auto num_producers = 4_usize;
+        static constexpr auto per_producer = 50'000_u64;
+        auto queue = std::make_unique<mpsc_queue<List<u64, u32>, 64>>();
+
+        auto producers = std::vector<std::thread>{};
+        for(auto producer = 0_usize; producer < num_producers; ++producer) {
+            producers.emplace_back([&queue, producer]() {
+                for(auto sequence = 0_u64; sequence < per_producer; ++sequence) {
+                    // the producer in the high bits, its sequence number in the low bits
+                    const auto message = (static_cast<u64>(producer) << 32U) | sequence;
+                    while(not queue->try_push(message)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        auto next = std::array<u64, num_producers>{};
+        auto in_order = true;
+        auto received = 0_u64;
+        while(received < num_producers * per_producer) {
+            const auto handled = queue->drain([&](auto&& message) {
+                if constexpr(std::same_as<std::remove_cvref_t<decltype(message)>, u64>) {
+                    const auto producer = static_cast<usize>(message >> 32U);
+                    in_order = in_order && producer < num_producers
+                               // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                               && (message & 0xFFFF'FFFF_u64) == next[producer]++;
+                }
+                else {
+                    in_order = false;
+                }
+            });
+            received += handled;
+            if(handled == 0_usize) {
+                std::this_thread::yield();
+            }
+        }
+        for(auto& producer : producers) {
+            producer.join();
+        }
+
+        test::check(in_order);
+        test::check(queue->size_approx() == 0_usize);
+    }
+} // namespace
+
+auto main() -> i32 {
+    push_and_drain();
+    full_and_partial_drain();
+    destroys_remaining();
+    throwing_handler();
+    threaded_producers();
+
+    return test::result();
+}
@@ -0,0 +1,182 @@
+/// @file options.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::options`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <hyperion/mpl/fixed_string.h>
+#include <hyperion/mpl/options.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <string_view>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    using threads = option<Value<fixed_string{"threads"}>, Type<u32>, Value<4_u32>>;
+    using verbose = option<Value<fixed_string{"verbose"}>, Type<bool>, Value<false>>;
+    using ratio = option<Value<fixed_string{"ratio"}>, Type<double>, Value<0.5>>;
+    using output = option<Value<fixed_string{"output"}>,
+                          Type<std::string_view>,
+                          Value<fixed_string{"out.bin"}>>;
+    using label
+        = option<Value<fixed_string{"label"}>, Type<fixed_string<8>>, Value<fixed_string{"none"}>>;
+
+    using cli = options<List<threads, verbose, ratio, output, label>>;
+
+    /// @brief Parses `args` as command line arguments, following a program name
+    template<usize TSize>
+    auto parse(cli& values, const std::array<const char*, TSize>& args) -> option_result {
+        return values.parse(static_cast<int>(args.size()), args.data());
+    }
+
+    /// @brief Checks every spelling of options, and that parsing stops at the first
+    /// positional argument
+    auto parse_arguments() -> void {
+        const auto args = std::array<const char*, 10>{"tool",
+                                                      "--threads",
+                                                      "8",
+                                                      "--verbose",
+                                                      "--ratio=1e-3",
+                                                      "--output=x.bin",
+                                                      "--label",
+                                                      "abc",
+                                                      "input.txt",
+                                                      "--threads=2"};
+        auto values = cli{};
+        const auto result = parse(values, args);
+        test::check(static_cast<bool>(result));
+        test::check(result.next == 8_usize);
+        test::check(values.get<"threads">() == 8_u32);
+        test::check(values.get<"verbose">());
+        test::check(values.get<"ratio">() == 1e-3);
+        // `std::string_view` options refer into the arguments
+        test::check(values.get<"output">() == "x.bin");
+        test::check(values.get<"output">().data() == args[5] + 9);
+        test::check(values.get<"label">().view() == "abc");
+    }
+
+    /// @brief Checks that options not given keep their defaults, and that `--` ends the
+    /// options
+    auto defaults_and_terminator() -> void {
+        const auto args = std::array<const char*, 4>{"tool", "--verbose=off", "--", "--ratio=2"};
+        auto values = cli{};
+        values.get<"verbose">() = true;
+        const auto result = parse(values, args);
+        test::check(static_cast<bool>(result) && result.next == 3_usize);
+        test::check(not values.get<"verbose">());
+        test::check(values.get<"threads">() == 4_u32 && values.get<"ratio">() == 0.5);
+        test::check(values.get<"output">() == "out.bin" && values.get<"label">().view() == "none");
+
+        auto no_options = cli{};
+        const auto empty = parse(no_options, std::array<const char*, 1>{"tool"});
+        test::check(static_cast<bool>(empty) && empty.next == 1_usize);
+    }
+
+    /// @brief Checks that parsing stops at the first error, reporting the offending
+    /// argument and its index, and keeps the values parsed before it
+    auto argument_errors() -> void {
+        auto values = cli{};
+        auto result
+            = parse(values, std::array<const char*, 4>{"tool", "--threads=3", "--nope", "1"});
+        test::check(result.error == option_errc::unknown_option);
+        test::check(result.token == "--nope" && result.next == 2_usize);
+        test::check(values.get<"threads">() == 3_u32);
+
+        result = parse(values, std::array<const char*, 2>{"tool", "--threads"});
+        test::check(result.error == option_errc::missing_value);
+        test::check(result.token == "--threads" && result.next == 1_usize);
+
+        result = parse(values, std::array<const char*, 3>{"tool", "--ratio", "0.25"});
+        test::check(static_cast<bool>(result) && values.get<"ratio">() == 0.25);
+
+        const auto invalid = std::array<const char*, 7>{"--threads=x",
+                                                        "--threads=8x",
+                                                        "--threads=-1",
+                                                        "--threads=4294967296",
+                                                        "--verbose=maybe",
+                                                        "--ratio=",
+                                                        "--label=ninechars"};
+        for(const auto* arg : invalid) {
+            result = parse(values, std::array<const char*, 2>{"tool", arg});
+            test::check(result.error == option_errc::invalid_value);
+            test::check(result.token == arg && result.next == 1_usize);
+        }
+        test::check(values.get<"threads">() == 3_u32 && values.get<"label">().view() == "none");
+    }
+
+    /// @brief Checks comments, blank lines, surrounding whitespace and line endings in
+    /// configuration text
+    auto parse_config() -> void {
+        constexpr auto text = std::string_view{"# settings\n"
+                                               "  threads =  16 \r\n"
+                                               "\n"
+                                               "\t# verbose = no\n"
+                                               "verbose=yes\n"
+                                               "output =\n"
+                                               "ratio=25e-2"};
+        auto values = cli{};
+        const auto result = values.parse_config(text);
+        test::check(static_cast<bool>(result) && result.next == text.size());
+        test::check(values.get<"threads">() == 16_u32);
+        test::check(values.get<"verbose">());
+        test::check(values.get<"output">().empty());
+        test::check(values.get<"ratio">() == 0.25);
+        test::check(values.get<"label">().view() == "none");
+    }
+
+    /// @brief Checks that configuration parsing stops at the first error, reporting the
+    /// offending line and its offset
+    auto config_errors() -> void {
+        auto values = cli{};
+        auto result = values.parse_config("threads=16\nverbose\nratio=2\n");
+        test::check(result.error == option_errc::missing_value);
+        test::check(result.token == "verbose" && result.next == 11_usize);
+        test::check(values.get<"threads">() == 16_u32 && values.get<"ratio">() == 0.5);
+
+        result = values.parse_config("# comment\n colour = red \n");
+        test::check(result.error == option_errc::unknown_option);
+        test::check(result.token == "colour = red" && result.next == 10_usize);
+
+        result = values.parse_config("threads = 1.5\n");
+        test::check(result.error == option_errc::invalid_value);
+        test::check(result.token == "threads = 1.5" && result.next == 0_usize);
+        test::check(values.get<"threads">() == 16_u32);
+    }
+} // namespace
+
+auto main() -> i32 {
+    parse_arguments();
+    defaults_and_terminator();
+    argument_errors();
+    parse_config();
+    config_errors();
+
+    return test::result();
+}
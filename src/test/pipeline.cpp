@@ -0,0 +1,162 @@
+/// @file pipeline.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::pipeline`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/pipeline.h>
+#include <hyperion/platform/types.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    struct add_one {
+        auto operator()(u64 value) const noexcept -> u64 {
+            return value + 1_u64;
+        }
+    };
+
+    struct to_double {
+        auto operator()(u64 value) const noexcept -> double {
+            return static_cast<double>(value) * 0.5;
+        }
+    };
+
+    /// @brief Counts the values reaching the last stage, which returns `void`
+    struct count_values {
+        std::atomic<u64>* count;
+
+        auto operator()([[maybe_unused]] double value) const noexcept -> void {
+            count->fetch_add(1_u64, std::memory_order_relaxed);
+        }
+    };
+
+    /// @brief Runs enough values through a threaded pipeline to wrap every inter-stage queue
+    /// many times, checking that they all arrive at the sink exactly once, in order
+    auto run_preserves_order() -> void {
+        static constexpr auto count = 50'000_u64;
+        auto stages = pipeline<u64, List<add_one, add_one, to_double>, 16, 8>{};
+
+        auto next = 0_u64;
+        auto outputs = std::vector<double>{};
+        outputs.reserve(count);
+        stages.run(
+            [&next](u64& input) {
+                input = next++;
+                return input < count;
+            },
+            [&outputs](double output) { outputs.push_back(output); });
+
+        test::check(outputs.size() == count);
+        auto in_order = true;
+        for(auto index = 0_usize; index < outputs.size(); ++index) {
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            in_order = in_order && outputs[index] == static_cast<double>(index + 2_usize) * 0.5;
+        }
+        test::check(in_order);
+    }
+
+    /// @brief Runs a pipeline whose last stage returns `void`, with pinned threads
+    auto run_void_output() -> void {
+        auto count = std::atomic<u64>{0_u64};
+        auto stages = pipeline<u64, List<add_one, to_double, count_values>>{
+            add_one{},
+            to_double{},
+            count_values{&count}};
+
+        auto next = 0_u64;
+        stages.run(
+            [&next](u64& input) {
+                input = next++;
+                return input < 1000_u64;
+            },
+            discard_output{},
+            pipeline_options{.pin_threads = true});
+
+        test::check(count.load() == 1000_u64);
+    }
+
+    /// @brief Throws from the source part way through a batch, checking that the exception
+    /// propagates to the caller after every stage thread is joined, and that the inputs
+    /// produced before it still reach the sink
+    auto run_rethrows_source_exception() -> void {
+        auto stages = pipeline<u64, List<add_one, to_double>, 16, 8>{};
+
+        auto next = 0_u64;
+        auto outputs = std::vector<double>{};
+        auto caught = false;
+        try {
+            stages.run(
+                [&next](u64& input) {
+                    if(next == 1001_u64) {
+                        throw std::runtime_error("source failed");
+                    }
+                    input = next++;
+                    return true;
+                },
+                [&outputs](double output) { outputs.push_back(output); });
+        }
+        catch(const std::runtime_error& error) {
+            caught = std::string_view{error.what()} == "source failed";
+        }
+
+        test::check(caught);
+        test::check(outputs.size() == 1001_usize);
+        test::check(not outputs.empty() && outputs.back() == 500.5);
+    }
+
+    /// @brief Runs the same stages fused on the calling thread
+    auto run_fused_matches_run() -> void {
+        auto stages = pipeline<u64, List<fused<add_one, add_one>, to_double>>{};
+
+        auto next = 0_u64;
+        auto sum = 0.0;
+        stages.run_fused(
+            [&next](u64& input) {
+                input = next++;
+                return input < 4_u64;
+            },
+            [&sum](double output) { sum += output; });
+
+        // (2 + 3 + 4 + 5) * 0.5
+        test::check(sum == 7.0);
+    }
+} // namespace
+
+auto main() -> i32 {
+    run_preserves_order();
+    run_void_output();
+    run_rethrows_source_exception();
+    run_fused_matches_run();
+
+    return test::result();
+}
@@ -0,0 +1,205 @@
+/// @file radix_sort.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::lsd_radix_sort` and `mpl::msd_radix_sort`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/radix_sort.h>
+#include <hyperion/platform/types.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    struct lsd {
+        template<typename TValue, typename TKeyOf>
+        auto operator()(std::span<TValue> values, TKeyOf&& key_of) const -> void {
+            lsd_radix_sort(values, std::forward<TKeyOf>(key_of));
+        }
+    };
+
+    struct msd {
+        template<typename TValue, typename TKeyOf>
+        auto operator()(std::span<TValue> values, TKeyOf&& key_of) const -> void {
+            msd_radix_sort(values, std::forward<TKeyOf>(key_of));
+        }
+    };
+
+    /// @brief A value with a sort key and the position it was generated at, to check
+    /// stability
+    template<typename TKey>
+    struct tagged {
+        TKey key;
+        usize position;
+
+        friend auto operator==(const tagged& lhs, const tagged& rhs) -> bool = default;
+    };
+
+    /// @brief Sorts `values` with `sort` by their `key` alone, and checks that the result
+    /// matches `std::stable_sort` by `key`
+    template<typename TKey, typename TSort>
+    auto check_matches_stable_sort(TSort sort, std::vector<tagged<TKey>> values) -> void {
+        auto expected = values;
+        std::stable_sort(expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.key < rhs.key;
+        });
+
+        sort(std::span{values},
+             [](const tagged<TKey>& value) { return radix_key<List<TKey>>::encode(value.key); });
+        test::check(values == expected);
+    }
+
+    /// @brief Sorts unsigned keys with many duplicates, at sizes below and well above the
+    /// size at which `msd_radix_sort` switches to a comparison sort
+    template<typename TSort>
+    auto unsigned_stability(TSort sort) -> void {
+        auto engine = std::mt19937{42_u32};
+        for(const auto size : {0_usize, 1_usize, 2_usize, 31_usize, 33_usize, 100'000_usize}) {
+            // keys below 2^16 leave the top two key bytes equal in every key, which the
+            // sorts must skip without reordering anything
+            auto distribution = std::uniform_int_distribution<u32>{0_u32, 4'000_u32};
+            auto values = std::vector<tagged<u32>>(size);
+            for(auto index = 0_usize; index < size; ++index) {
+                values[index] = {distribution(engine), index};
+            }
+            check_matches_stable_sort<u32>(sort, values);
+        }
+    }
+
+    template<typename TSort>
+    auto signed_values(TSort sort) -> void {
+        constexpr auto min = std::numeric_limits<i64>::min();
+        constexpr auto max = std::numeric_limits<i64>::max();
+        auto engine = std::mt19937_64{7_u64};
+        auto values = std::vector<tagged<i64>>{};
+        for(const auto key : {max, 0_i64, -1_i64, min, 1_i64, -256_i64, 255_i64, min + 1_i64}) {
+            values.push_back({key, values.size()});
+        }
+        for(auto index = 0_usize; index < 1'000_usize; ++index) {
+            // duplicates of the extremes, mixed with values of every magnitude
+            const auto key = index % 10_usize == 0_usize ? (index % 20_usize == 0_usize ? min : max)
+                                                         : static_cast<i64>(engine());
+            values.push_back({key, values.size()});
+        }
+        check_matches_stable_sort<i64>(sort, values);
+    }
+
+    /// @brief Checks the order of signed zeros, infinities and NaNs, which `<` can't express
+    template<typename TSort>
+    auto floating_point(TSort sort) -> void {
+        constexpr auto infinity = std::numeric_limits<double>::infinity();
+        constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+        constexpr auto lowest = std::numeric_limits<double>::lowest();
+        constexpr auto denormal = std::numeric_limits<double>::denorm_min();
+
+        auto values = std::vector<double>{
+            nan, 1.5, -0.0, -nan, infinity, 0.0, -1.5, -infinity, denormal, -denormal, lowest, 0.0};
+        sort(std::span{values},
+             [](double value) { return radix_key<List<double>>::encode(value); });
+
+        const auto expected = std::array{
+            -nan, -infinity, lowest, -1.5, -denormal, -0.0, 0.0, 0.0, denormal, 1.5, infinity, nan};
+        auto bitwise_equal = values.size() == expected.size();
+        for(auto index = 0_usize; bitwise_equal && index < expected.size(); ++index) {
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            bitwise_equal
+                = std::bit_cast<u64>(values[index]) == std::bit_cast<u64>(expected[index]);
+        }
+        test::check(bitwise_equal);
+
+        // finite values, with many duplicates, in the same order as `std::stable_sort`
+        auto engine = std::mt19937{3_u32};
+        auto distribution = std::uniform_int_distribution<i32>{-50, 50};
+        auto finite = std::vector<tagged<double>>(2'000_usize);
+        for(auto index = 0_usize; index < finite.size(); ++index) {
+            finite[index] = {static_cast<double>(distribution(engine)) / 4.0, index};
+        }
+        check_matches_stable_sort<double>(sort, finite);
+    }
+
+    /// @brief Sorts by a composite key of a `fixed_string` then a signed integer
+    template<typename TSort>
+    auto fixed_string_keys(TSort sort) -> void {
+        struct trade {
+            fixed_string<4> symbol;
+            i32 quantity;
+            usize position;
+        };
+
+        const auto symbols = std::array{fixed_string<4>{"ab"},
+                                        fixed_string<4>{"abc"},
+                                        fixed_string<4>{"abcd"},
+                                        fixed_string<4>{"b"},
+                                        fixed_string<4>{"\xff"}};
+        auto engine = std::mt19937{11_u32};
+        auto trades = std::vector<trade>(500_usize);
+        for(auto index = 0_usize; index < trades.size(); ++index) {
+            trades[index] = {symbols[engine() % symbols.size()],
+                             static_cast<i32>(engine() % 7U) - 3,
+                             index};
+        }
+
+        auto expected = trades;
+        std::stable_sort(expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.symbol < rhs.symbol
+                   || (lhs.symbol == rhs.symbol && lhs.quantity < rhs.quantity);
+        });
+
+        sort(std::span{trades}, [](const trade& value) {
+            return radix_key<List<fixed_string<4>, i32>>::encode(value.symbol, value.quantity);
+        });
+
+        auto same = true;
+        for(auto index = 0_usize; index < trades.size(); ++index) {
+            same = same && trades[index].position == expected[index].position;
+        }
+        test::check(same);
+    }
+
+    template<typename TSort>
+    auto run_all(TSort sort) -> void {
+        unsigned_stability(sort);
+        signed_values(sort);
+        floating_point(sort);
+        fixed_string_keys(sort);
+    }
+} // namespace
+
+auto main() -> i32 {
+    run_all(lsd{});
+    run_all(msd{});
+
+    return test::result();
+}
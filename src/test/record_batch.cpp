@@ -0,0 +1,268 @@
+/// @file record_batch.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::record_batch`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <hyperion/mpl/record_batch.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    using batch_type = record_batch<List<u32, f64, i16>>;
+    using optional_row = std::tuple<u32, std::optional<f64>, i16>;
+
+    constexpr auto num_plain_rows = 1000_u32;
+    constexpr auto num_rows = 1300_u32;
+
+    /// @brief Returns whether the row with id `id` has a valid value in column 1: ids past the
+    /// plain rows are null every third row
+    auto has_value(u32 id) -> bool {
+        return id < num_plain_rows || id % 3_u32 != 0_u32;
+    }
+
+    /// @brief Returns the value of column 1 of the row with id `id`
+    auto value_of(u32 id) -> f64 {
+        return static_cast<f64>(id) * 0.5;
+    }
+
+    /// @brief Returns a batch of `num_plain_rows` `row_type` rows, followed by rows appended
+    /// as `std::optional`s, some of which are null
+    auto make_batch() -> batch_type {
+        auto rows = std::vector<batch_type::row_type>{};
+        for(auto id = 0_u32; id < num_plain_rows; ++id) {
+            rows.emplace_back(id, value_of(id), static_cast<i16>(-static_cast<i32>(id)));
+        }
+        auto batch = batch_type{};
+        batch.append(rows);
+
+        auto optional_rows = std::vector<optional_row>{};
+        for(auto id = num_plain_rows; id < num_rows; ++id) {
+            optional_rows.emplace_back(id,
+                                       has_value(id) ? std::optional{value_of(id)} : std::nullopt,
+                                       static_cast<i16>(-static_cast<i32>(id)));
+        }
+        batch.append(std::span{optional_rows});
+        return batch;
+    }
+
+    /// @brief Checks appending plain and `std::optional` rows, and that appending to a batch
+    /// sharing its columns leaves the other batch unchanged
+    auto append() -> void {
+        auto batch = make_batch();
+        test::check(batch.size() == num_rows);
+        test::check(reinterpret_cast<std::uintptr_t>(batch.column<1>().data())
+                        % record_batch_alignment
+                    == 0_usize);
+        test::check(batch.has_validity<1>() && not batch.has_validity<0>());
+
+        auto expected_nulls = 0_usize;
+        auto all_matched = true;
+        for(auto id = 0_u32; id < num_rows; ++id) {
+            expected_nulls += has_value(id) ? 0_usize : 1_usize;
+            all_matched = all_matched && batch.get<0>(id) == id
+                          && batch.is_valid<1>(id) == has_value(id)
+                          && (not has_value(id) || batch.get<1>(id) == value_of(id))
+                          && batch.get<2>(id) == static_cast<i16>(-static_cast<i32>(id));
+        }
+        test::check(all_matched);
+        test::check(batch.null_count<1>() == expected_nulls && batch.null_count<0>() == 0_usize);
+
+        const auto shared = batch;
+        const auto extra = std::vector<optional_row>{{num_rows, std::nullopt, 0_i16}};
+        batch.append(std::span<const optional_row>{extra});
+        test::check(shared.size() == num_rows && batch.size() == num_rows + 1_u32);
+        test::check(shared.column<0>().data() != batch.column<0>().data());
+        test::check(shared.null_count<1>() == expected_nulls);
+        test::check(batch.null_count<1>() == expected_nulls + 1_usize);
+    }
+
+    /// @brief Appends `rows` to `batch`, if `append` accepts them
+    constexpr auto appender = [](auto& batch, const auto& rows) -> decltype(batch.append(rows)) {
+        batch.append(rows);
+    };
+
+    /// @brief Checks the ways of passing rows to `append` shown in the documentation:
+    /// `std::span{rows}` over const and non-const rows, and containers passed directly
+    auto append_ranges() -> void {
+        using example_type = record_batch<List<u32, f64>>;
+
+        auto batch = example_type{};
+        const auto rows = std::array{std::tuple{1_u32, std::optional{1.5}},
+                                     std::tuple{2_u32, std::optional<f64>{}}};
+        batch.append(std::span{rows});
+        test::check(batch.size() == 2_usize && batch.is_valid<1>(0) && not batch.is_valid<1>(1));
+        test::check(batch.slice(1_usize, 1_usize).get<0>(0) == 2_u32);
+
+        auto mutable_rows = std::vector<example_type::row_type>{{3_u32, 3.5}, {4_u32, 4.5}};
+        batch.append(std::span{mutable_rows});
+        batch.append(mutable_rows);
+        batch.append(std::array{std::tuple{5_u32, 5.5}});
+        test::check(batch.size() == 7_usize);
+        test::check(batch.get<0>(3) == 4_u32 && batch.get<0>(5) == 4_u32);
+        test::check(batch.get<0>(6) == 5_u32 && batch.get<1>(6) == 5.5);
+        test::check(batch.null_count<1>() == 1_usize);
+
+        using row = std::tuple<u32, f64>;
+        test::check(std::invocable<decltype(appender), example_type&, std::span<const row>>);
+        // rows must be contiguous, and have one field per column
+        test::check(not std::invocable<decltype(appender), example_type&, std::list<row>>);
+        test::check(
+            not std::invocable<decltype(appender), example_type&, std::vector<std::tuple<u32>>>);
+    }
+
+    /// @brief Checks that slices share their batch's columns, at offsets that are not a
+    /// multiple of the validity bitmap's word size, and copy them when appended to
+    auto slice() -> void {
+        const auto batch = make_batch();
+        const auto sliced = batch.slice(37_usize, 1200_usize);
+        test::check(sliced.column<0>().data() == batch.column<0>().data() + 37);
+
+        auto expected_nulls = 0_usize;
+        auto all_matched = true;
+        for(auto index = 0_usize; index < sliced.size(); ++index) {
+            const auto id = static_cast<u32>(index + 37_usize);
+            expected_nulls += has_value(id) ? 0_usize : 1_usize;
+            all_matched = all_matched && sliced.get<0>(index) == id
+                          && sliced.is_valid<1>(index) == has_value(id);
+        }
+        test::check(all_matched);
+        test::check(sliced.null_count<1>() == expected_nulls);
+
+        auto tail = batch.slice(10_usize, 5_usize);
+        const auto rows = std::vector<optional_row>{{7_u32, std::nullopt, 1_i16},
+                                                    {8_u32, 4.0, 2_i16}};
+        tail.append(std::span<const optional_row>{rows});
+        test::check(tail.size() == 7_usize && tail.get<0>(4) == 14_u32);
+        test::check(tail.get<0>(5) == 7_u32 && not tail.is_valid<1>(5));
+        test::check(tail.get<0>(6) == 8_u32 && tail.is_valid<1>(6));
+        test::check(batch.get<0>(15) == 15_u32 && batch.is_valid<1>(15));
+    }
+
+    /// @brief Checks `where` and the selection operators against a scalar evaluation, and
+    /// that null values are never selected
+    auto where() -> void {
+        const auto batch = make_batch().slice(37_usize, 1200_usize);
+        const auto large = batch.where<1>([](f64 value) { return value > 300.0; });
+        test::check(large.size() == batch.size());
+
+        auto expected = 0_usize;
+        auto all_matched = true;
+        for(auto index = 0_usize; index < batch.size(); ++index) {
+            const auto selected = batch.is_valid<1>(index) && batch.get<1>(index) > 300.0;
+            expected += selected ? 1_usize : 0_usize;
+            all_matched = all_matched && large.contains(index) == selected;
+        }
+        test::check(all_matched);
+        test::check(large.count() == expected);
+
+        // the predicate also accepts the placeholder values stored for nulls
+        const auto everything = batch.where<1>([](f64) { return true; });
+        test::check(everything.count() == batch.size() - batch.null_count<1>());
+
+        const auto even = batch.where<0>([](u32 id) { return id % 2_u32 == 0_u32; });
+        const auto low = batch.where<0>([](u32 id) { return id < 100_u32; });
+        const auto combined = (even & large) | low;
+        all_matched = true;
+        for(auto index = 0_usize; index < batch.size(); ++index) {
+            all_matched = all_matched
+                          && combined.contains(index)
+                                 == ((even.contains(index) && large.contains(index))
+                                     || low.contains(index));
+        }
+        test::check(all_matched);
+    }
+
+    /// @brief Checks that `filter` compacts the selected rows in order, carrying over the
+    /// validity of their values
+    auto filter() -> void {
+        const auto batch = make_batch().slice(37_usize, 1200_usize);
+
+        const auto projected = batch.select<0, 1>();
+        static_assert(std::same_as<decltype(projected), const record_batch<List<u32, f64>>>,
+                      "hyperion::mpl::record_batch runtime test (failing)");
+        test::check(projected.column<0>().data() == batch.column<0>().data());
+
+        const auto large = projected.where<1>([](f64 value) { return value > 300.0; });
+        const auto filtered = projected.filter(large);
+        test::check(filtered.size() == large.count());
+        test::check(filtered.has_validity<1>() && filtered.null_count<1>() == 0_usize);
+        auto next = 0_usize;
+        auto all_matched = true;
+        for(auto index = 0_usize; index < batch.size(); ++index) {
+            if(large.contains(index)) {
+                all_matched = all_matched && filtered.get<0>(next) == batch.get<0>(index)
+                              && filtered.get<1>(next) == batch.get<1>(index);
+                ++next;
+            }
+        }
+        test::check(all_matched);
+
+        // every row: whole words of selected rows take the bulk copy path, and nulls are kept
+        const auto everything = batch.where<0>([](u32) { return true; });
+        const auto copied = batch.filter(everything);
+        test::check(copied.size() == batch.size());
+        test::check(copied.null_count<1>() == batch.null_count<1>());
+        all_matched = true;
+        for(auto index = 0_usize; index < batch.size(); ++index) {
+            all_matched = all_matched && copied.get<0>(index) == batch.get<0>(index)
+                          && copied.get<2>(index) == batch.get<2>(index)
+                          && copied.is_valid<1>(index) == batch.is_valid<1>(index);
+        }
+        test::check(all_matched);
+
+        // only nulls
+        const auto nulls = batch.where<0>([](u32 id) { return not has_value(id); });
+        const auto only_nulls = batch.filter(nulls);
+        test::check(only_nulls.size() == batch.null_count<1>());
+        test::check(only_nulls.null_count<1>() == only_nulls.size());
+
+        const auto none = batch.filter(batch.where<0>([](u32) { return false; }));
+        test::check(none.empty());
+    }
+} // namespace
+
+auto main() -> i32 {
+    append();
+    append_ranges();
+    slice();
+    where();
+    filter();
+
+    return test::result();
+}
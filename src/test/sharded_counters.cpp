@@ -0,0 +1,148 @@
+/// @file sharded_counters.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::sharded_counters`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/sharded_counters.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    struct hits;
+    struct misses;
+    struct evictions;
+
+    using metrics = sharded_counters<List<hits, misses, evictions>>;
+
+    auto shard_counts() -> void {
+        test::check(metrics{0_usize}.shard_count() == 1_usize);
+        test::check(metrics{1_usize}.shard_count() == 1_usize);
+        test::check(metrics{3_usize}.shard_count() == 4_usize);
+        test::check(metrics{8_usize}.shard_count() == 8_usize);
+        test::check(metrics{}.shard_count() >= 1_usize);
+    }
+
+    /// @brief Checks `add`, `get`, `snapshot` and `reset` from a single thread
+    auto single_thread() -> void {
+        auto counters = metrics{4_usize};
+        test::check(counters.get<hits>() == 0_u64);
+
+        counters.add<hits>();
+        counters.add<hits>();
+        counters.add<misses>(5_u64);
+        test::check(counters.get<hits>() == 2_u64);
+        test::check(counters.get<misses>() == 5_u64);
+        test::check(counters.get<evictions>() == 0_u64);
+
+        const auto snapshot = counters.snapshot();
+        test::check(snapshot.get<hits>() == 2_u64);
+        test::check(snapshot.get<misses>() == 5_u64);
+        test::check(snapshot.totals() == std::array{2_u64, 5_u64, 0_u64});
+
+        counters.reset();
+        test::check(counters.snapshot().totals() == std::array{0_u64, 0_u64, 0_u64});
+        // a snapshot is a copy, unaffected by later changes
+        test::check(snapshot.get<misses>() == 5_u64);
+    }
+
+    /// @brief Adds from several threads at once, with fewer shards than threads so that
+    /// some threads share a shard, and checks that no increment is lost
+    auto threaded_totals() -> void {
+        static constexpr auto num_threads = 8_usize;
+        static constexpr auto increments = 100'000_u64;
+        auto counters = metrics{2_usize};
+
+        auto threads = std::vector<std::thread>{};
+        for(auto thread = 0_usize; thread < num_threads; ++thread) {
+            threads.emplace_back([&counters]() {
+                for(auto count = 0_u64; count < increments; ++count) {
+                    counters.add<hits>();
+                    counters.add<evictions>(2_u64);
+                }
+            });
+        }
+        for(auto& thread : threads) {
+            thread.join();
+        }
+
+        const auto expected = num_threads * increments;
+        test::check(counters.get<hits>() == expected);
+        test::check(counters.get<misses>() == 0_u64);
+        test::check(counters.get<evictions>() == 2_u64 * expected);
+        test::check(counters.snapshot().totals() == std::array{expected, 0_u64, 2_u64 * expected});
+    }
+
+    /// @brief Takes snapshots while other threads add, checking that the totals seen by
+    /// successive snapshots never decrease
+    auto concurrent_snapshots() -> void {
+        static constexpr auto num_threads = 4_usize;
+        static constexpr auto increments = 50'000_u64;
+        auto counters = metrics{8_usize};
+        auto done = std::atomic<usize>{0_usize};
+
+        auto threads = std::vector<std::thread>{};
+        for(auto thread = 0_usize; thread < num_threads; ++thread) {
+            threads.emplace_back([&counters, &done]() {
+                for(auto count = 0_u64; count < increments; ++count) {
+                    counters.add<misses>();
+                }
+                done.fetch_add(1_usize, std::memory_order_release);
+            });
+        }
+
+        auto previous = 0_u64;
+        auto monotonic = true;
+        while(done.load(std::memory_order_acquire) != num_threads) {
+            const auto current = counters.snapshot().get<misses>();
+            monotonic = monotonic && current >= previous && current <= num_threads * increments;
+            previous = current;
+            std::this_thread::yield();
+        }
+        for(auto& thread : threads) {
+            thread.join();
+        }
+
+        test::check(monotonic);
+        test::check(counters.get<misses>() == num_threads * increments);
+    }
+} // namespace
+
+auto main() -> i32 {
+    shard_counts();
+    single_thread();
+    threaded_totals();
+    concurrent_snapshots();
+
+    return test::result();
+}
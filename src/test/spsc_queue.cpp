@@ -0,0 +1,158 @@
+/// @file spsc_queue.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::spsc_queue`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/spsc_queue.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    /// @brief Pushes and pops single values through enough laps of the ring that both
+    /// indices wrap around it many times
+    auto single_value_wraparound() -> void {
+        auto queue = spsc_queue<u32, 4>{};
+        auto out = 0_u32;
+        for(auto value = 0_u32; value < 64_u32; value += 3_u32) {
+            test::check(queue.try_push(value));
+            test::check(queue.try_push(value + 1_u32));
+            test::check(queue.try_push(value + 2_u32));
+            test::check(queue.size_approx() == 3_usize);
+
+            for(auto offset = 0_u32; offset < 3_u32; ++offset) {
+                test::check(queue.try_pop(out) && out == value + offset);
+            }
+            test::check(not queue.try_pop(out));
+        }
+    }
+
+    /// @brief Fills the queue, then checks that it rejects pushes until it is popped
+    auto full_and_empty() -> void {
+        auto queue = spsc_queue<u32, 4>{};
+        auto out = 0_u32;
+        test::check(not queue.try_pop(out));
+        for(auto value = 0_u32; value < 4_u32; ++value) {
+            test::check(queue.try_push(value));
+        }
+        test::check(not queue.try_push(4_u32));
+        test::check(queue.try_pop(out) && out == 0_u32);
+        test::check(queue.try_push(4_u32));
+        test::check(queue.size_approx() == 4_usize);
+    }
+
+    /// @brief Pushes and pops batches whose copies straddle the end of the ring, for both
+    /// the `memcpy` path and the element-wise path
+    template<typename TType, typename TMake>
+    auto batch_wraparound(TMake make) -> void {
+        auto queue = spsc_queue<TType, 8>{};
+        auto next_in = 0_u32;
+        auto next_out = 0_u32;
+        for(auto lap = 0_usize; lap < 16_usize; ++lap) {
+            auto in = std::array<TType, 5>{};
+            for(auto& value : in) {
+                value = make(next_in++);
+            }
+            test::check(queue.try_push_batch(std::span{in}) == in.size());
+
+            // the queue holds 5 of its 8 slots, so this can only push 3
+            auto overflow = std::array<TType, 5>{};
+            for(auto& value : overflow) {
+                value = make(next_in + 100_u32);
+            }
+            test::check(queue.try_push_batch(std::span{overflow}) == 3_usize);
+
+            auto out = std::array<TType, 8>{};
+            test::check(queue.try_pop_batch(std::span{out}) == 8_usize);
+            for(auto index = 0_usize; index < in.size(); ++index) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                test::check(out[index] == make(next_out++));
+            }
+            test::check(queue.try_pop_batch(std::span{out}) == 0_usize);
+        }
+    }
+
+    /// @brief Streams values from a producer thread to the calling thread, checking that
+    /// every value arrives exactly once, in order
+    auto threaded_transfer() -> void {
+        static constexpr auto count = 200'000_u64;
+        auto queue = std::make_unique<spsc_queue<u64, 64>>();
+
+        auto producer = std::thread([&queue]() {
+            auto batch = std::array<u64, 7>{};
+            auto next = 0_u64;
+            while(next < count) {
+                auto size = 0_usize;
+                for(; size < batch.size() && next + size < count; ++size) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    batch[size] = next + size;
+                }
+                auto pending = std::span{batch}.first(size);
+                while(not pending.empty()) {
+                    pending = pending.subspan(queue->try_push_batch(pending));
+                    std::this_thread::yield();
+                }
+                next += size;
+            }
+        });
+
+        auto expected = 0_u64;
+        auto in_order = true;
+        auto out = std::array<u64, 16>{};
+        while(expected < count) {
+            const auto popped = queue->try_pop_batch(std::span{out});
+            for(auto index = 0_usize; index < popped; ++index) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                in_order = in_order && out[index] == expected++;
+            }
+            if(popped == 0_usize) {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+
+        test::check(in_order);
+        test::check(queue->size_approx() == 0_usize);
+    }
+} // namespace
+
+auto main() -> i32 {
+    single_value_wraparound();
+    full_and_empty();
+    batch_wraparound<u32>([](u32 value) { return value; });
+    batch_wraparound<std::string>([](u32 value) { return std::to_string(value); });
+    threaded_transfer();
+
+    return test::result();
+}
@@ -0,0 +1,135 @@
+/// @file static_vector.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::static_vector`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <hyperion/mpl/static_vector.h>
+#include <hyperion/platform/types.h>
+
+#include <stdexcept>
+#include <utility>
+
+#include "check.h"
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    /// @brief The number of live `counted`s
+    i32 live = 0; // NOLINT(*-avoid-non-const-global-variables)
+    /// @brief The number of copies and moves of `counted`s to allow before one throws,
+    /// or negative to never throw
+    i32 copies_until_throw = -1; // NOLINT(*-avoid-non-const-global-variables)
+
+    /// @brief Throws once `copies_until_throw` copies or moves have been made
+    auto count_copy() -> void {
+        if(copies_until_throw == 0) {
+            throw std::runtime_error{"copy"};
+        }
+        if(copies_until_throw > 0) {
+            --copies_until_throw;
+        }
+    }
+
+    /// @brief A value that counts its live instances, and whose copy and move
+    /// constructors can be made to throw
+    struct counted {
+        i32 number;
+
+        explicit counted(i32 _number) noexcept : number{_number} {
+            ++live;
+        }
+        counted(const counted& other) : number{other.number} {
+            count_copy();
+            ++live;
+        }
+        counted(counted&& other) // NOLINT(*-noexcept-move-*)
+            : number{other.number} {
+            count_copy();
+            ++live;
+        }
+        ~counted() noexcept {
+            --live;
+        }
+        auto operator=(const counted&) -> counted& = default;
+        auto operator=(counted&&) -> counted& = default; // NOLINT(*-noexcept-move-*)
+    };
+
+    /// @brief Runs `construct`, expecting it to throw, and returns whether it did
+    auto throws(auto construct) -> bool {
+        try {
+            construct();
+        }
+        catch(const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Checks that a constructor throwing part way through copying elements
+    /// destroys the elements it had already constructed
+    auto throwing_element_constructor() -> void {
+        {
+            const auto values = {counted{1}, counted{2}, counted{3}};
+            copies_until_throw = 2;
+            test::check(throws([&values] {
+                static_cast<void>(static_vector<counted, 4>(values));
+            }));
+            test::check(live == 3);
+        }
+        test::check(live == 0);
+
+        {
+            auto vector = static_vector<counted, 4>{};
+            vector.emplace_back(1);
+            vector.emplace_back(2);
+            vector.emplace_back(3);
+
+            copies_until_throw = 1;
+            test::check(throws([&vector] {
+                static_cast<void>(static_vector<counted, 4>(vector));
+            }));
+            test::check(live == 3);
+
+            copies_until_throw = 2;
+            test::check(throws([&vector] {
+                static_cast<void>(static_vector<counted, 4>(std::move(vector)));
+            }));
+            test::check(live == 3);
+
+            copies_until_throw = -1;
+            const auto copy = vector;
+            test::check(live == 6 && copy.size() == 3_usize && copy[2].number == 3);
+        }
+        test::check(live == 0);
+    }
+} // namespace
+
+auto main() -> i32 {
+    throwing_element_constructor();
+
+    return test::result();
+}
@@ -0,0 +1,298 @@
+/// @file thread_pool.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::work_stealing_pool`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/thread_pool.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "check.h"
+
+namespace {
+    /// @brief The number of allocations the current thread may make through the global
+    /// `operator new` before they start failing, or `-1` if they never fail
+    thread_local hyperion::i64 allocations_until_failure = -1; // NOLINT(*-non-const-global-*)
+} // namespace
+
+// NOLINTBEGIN(*-no-malloc, *-owning-memory)
+auto operator new(std::size_t size) -> void* {
+    if(allocations_until_failure == 0) {
+        throw std::bad_alloc{};
+    }
+    if(allocations_until_failure > 0) {
+        --allocations_until_failure;
+    }
+    if(auto* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+auto operator delete(void* memory) noexcept -> void {
+    std::free(memory);
+}
+
+auto operator delete(void* memory, [[maybe_unused]] std::size_t size) noexcept -> void {
+    std::free(memory);
+}
+// NOLINTEND(*-no-malloc, *-owning-memory)
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    /// @brief A job that counts how many times it has run
+    struct counted {
+        std::atomic<u32> runs = 0_u32;
+
+        static auto invoke(void* context) noexcept -> void {
+            static_cast<counted*>(context)->runs.fetch_add(1_u32, std::memory_order_relaxed);
+        }
+    };
+
+    /// @brief Executes `num_jobs` counted jobs on `pool`, checking that each one ran
+    /// exactly once by the time `execute` returns
+    auto each_job_runs_once(work_stealing_pool& pool, usize num_jobs) -> void {
+        auto counters = std::vector<counted>(num_jobs);
+        auto jobs = std::vector<work_stealing_pool::job>{};
+        jobs.reserve(num_jobs);
+        for(auto& counter : counters) {
+            jobs.push_back({&counted::invoke, &counter});
+        }
+
+        pool.execute(jobs);
+
+        auto exactly_once = true;
+        for(const auto& counter : counters) {
+            exactly_once = exactly_once && counter.runs.load(std::memory_order_relaxed) == 1_u32;
+        }
+        test::check(exactly_once);
+    }
+
+    /// @brief Runs batches smaller than, equal to, and much larger than the number of
+    /// workers, including an empty batch
+    auto batch_sizes() -> void {
+        auto pool = work_stealing_pool{3_usize};
+        test::check(pool.num_workers() == 3_usize);
+        for(const auto num_jobs : {0_usize, 1_usize, 2_usize, 3_usize, 4_usize, 1000_usize}) {
+            each_job_runs_once(pool, num_jobs);
+        }
+    }
+
+    /// @brief Checks that a pool without workers runs every job on the calling thread,
+    /// in order
+    auto zero_workers() -> void {
+        struct ordered {
+            std::vector<usize>* order;
+            std::thread::id* thread;
+            usize index;
+
+            static auto invoke(void* context) noexcept -> void {
+                auto* self = static_cast<ordered*>(context);
+                self->order->push_back(self->index);
+                *self->thread = std::this_thread::get_id();
+            }
+        };
+
+        auto pool = work_stealing_pool{0_usize};
+        test::check(pool.num_workers() == 0_usize);
+
+        auto order = std::vector<usize>{};
+        order.reserve(3_usize);
+        auto thread = std::thread::id{};
+        auto contexts = std::array{ordered{&order, &thread, 0_usize},
+                                   ordered{&order, &thread, 1_usize},
+                                   ordered{&order, &thread, 2_usize}};
+        auto jobs = std::array<work_stealing_pool::job, 3>{};
+        for(auto index = 0_usize; index < jobs.size(); ++index) {
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            jobs[index] = {&ordered::invoke, &contexts[index]};
+        }
+
+        pool.execute(jobs);
+        test::check(order == std::vector{0_usize, 1_usize, 2_usize});
+        test::check(thread == std::this_thread::get_id());
+    }
+
+    /// @brief Checks that a job may itself call `execute` on the pool that runs it,
+    /// even when every worker is busy running such a job
+    auto nested_execute() -> void {
+        struct nested {
+            work_stealing_pool* pool;
+            std::array<counted, 8> inner;
+
+            static auto invoke(void* context) noexcept -> void {
+                auto* self = static_cast<nested*>(context);
+                auto jobs = std::array<work_stealing_pool::job, 8>{};
+                for(auto index = 0_usize; index < jobs.size(); ++index) {
+                    // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                    jobs[index] = {&counted::invoke, &self->inner[index]};
+                }
+                self->pool->execute(jobs);
+            }
+        };
+
+        auto pool = work_stealing_pool{2_usize};
+        auto outer = std::vector<nested>(6_usize);
+        auto jobs = std::vector<work_stealing_pool::job>{};
+        for(auto& context : outer) {
+            context.pool = &pool;
+            jobs.push_back({&nested::invoke, &context});
+        }
+
+        pool.execute(jobs);
+
+        auto exactly_once = true;
+        for(const auto& context : outer) {
+            for(const auto& counter : context.inner) {
+                exactly_once = exactly_once
+                               && counter.runs.load(std::memory_order_relaxed) == 1_u32;
+            }
+        }
+        test::check(exactly_once);
+    }
+
+    /// @brief Calls `execute` from several threads at once on the same pool
+    auto concurrent_callers() -> void {
+        auto pool = work_stealing_pool{2_usize};
+        auto callers = std::vector<std::thread>{};
+        for(auto caller = 0_usize; caller < 3_usize; ++caller) {
+            callers.emplace_back([&pool]() {
+                for(auto round = 0_usize; round < 50_usize; ++round) {
+                    each_job_runs_once(pool, 64_usize);
+                }
+            });
+        }
+        for(auto& caller : callers) {
+            caller.join();
+        }
+    }
+
+    /// @brief Fails every allocation from the `allocations`th one on while constructing a
+    /// pool, checking that a failed construction stops the workers it already started
+    /// @return Whether the construction succeeded
+    auto construct_failing_after(i64 allocations) -> bool {
+        auto pool = std::optional<work_stealing_pool>{};
+        allocations_until_failure = allocations;
+        try {
+            pool.emplace(3_usize);
+        }
+        catch(const std::bad_alloc&) {
+            allocations_until_failure = -1;
+            return false;
+        }
+        allocations_until_failure = -1;
+
+        test::check(pool->num_workers() == 3_usize);
+        each_job_runs_once(*pool, 64_usize);
+        return true;
+    }
+
+    /// @brief Checks that the pool can be constructed after failing at every allocation
+    /// the construction makes
+    auto failed_construction() -> void {
+        auto allocations = 0_i64;
+        while(not construct_failing_after(allocations)) {
+            ++allocations;
+        }
+        test::check(allocations > 0_i64);
+    }
+
+    /// @brief Fails every allocation from the `allocations`th one on while executing a
+    /// batch, checking that a failed `execute` leaves every job run at most once and no
+    /// job running after it returns
+    /// @return Whether the execution succeeded
+    auto execute_failing_after(i64 allocations) -> bool {
+        constexpr auto num_jobs = 1000_usize;
+        auto counters = std::vector<counted>(num_jobs);
+        auto jobs = std::vector<work_stealing_pool::job>{};
+        jobs.reserve(num_jobs);
+        for(auto& counter : counters) {
+            jobs.push_back({&counted::invoke, &counter});
+        }
+
+        auto runs = std::array<u32, num_jobs>{};
+        auto succeeded = true;
+        {
+            auto pool = work_stealing_pool{2_usize};
+            allocations_until_failure = allocations;
+            try {
+                pool.execute(jobs);
+            }
+            catch(const std::bad_alloc&) {
+                succeeded = false;
+            }
+            allocations_until_failure = -1;
+
+            for(auto index = 0_usize; index < num_jobs; ++index) {
+                // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+                runs[index] = counters[index].runs.load(std::memory_order_relaxed);
+            }
+        }
+
+        auto expected_runs = true;
+        auto unchanged = true;
+        for(auto index = 0_usize; index < num_jobs; ++index) {
+            const auto final_runs = counters[index].runs.load(std::memory_order_relaxed);
+            const auto expected = succeeded ? final_runs == 1_u32 : final_runs <= 1_u32;
+            expected_runs = expected_runs && expected;
+            // NOLINTNEXTLINE(*-pro-bounds-constant-array-index)
+            unchanged = unchanged && final_runs == runs[index];
+        }
+        test::check(expected_runs);
+        test::check(unchanged);
+        return succeeded;
+    }
+
+    /// @brief Checks a batch large enough to allocate while being queued, failing at every
+    /// allocation `execute` makes
+    auto failed_execute() -> void {
+        auto allocations = 0_i64;
+        while(not execute_failing_after(allocations)) {
+            ++allocations;
+        }
+        test::check(allocations > 0_i64);
+    }
+} // namespace
+
+auto main() -> i32 {
+    batch_sizes();
+    zero_workers();
+    nested_execute();
+    concurrent_callers();
+    failed_construction();
+    failed_execute();
+
+    return test::result();
+}
@@ -0,0 +1,314 @@
+/// @file when_all.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime tests for `mpl::when_all` and `mpl::when_any`
+/// @version 0.1
+/// @date 2026-10-17
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <hyperion/mpl/when_all.h>
+#include <hyperion/platform/types.h>
+
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+#include "check.h"
+
+namespace {
+    /// @brief The number of allocations made through the global `operator new`
+    std::atomic<hyperion::usize> allocations = 0; // NOLINT(*-avoid-non-const-global-variables)
+} // namespace
+
+// NOLINTBEGIN(*-no-malloc, *-owning-memory)
+auto operator new(std::size_t size) -> void* {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if(auto* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+auto operator delete(void* memory) noexcept -> void {
+    std::free(memory);
+}
+
+auto operator delete(void* memory, [[maybe_unused]] std::size_t size) noexcept -> void {
+    std::free(memory);
+}
+// NOLINTEND(*-no-malloc, *-owning-memory)
+
+using namespace hyperion;      // NOLINT(google-build-using-namespace)
+using namespace hyperion::mpl; // NOLINT(google-build-using-namespace)
+
+namespace {
+    /// @brief An awaitable completed manually by the test, with a value or an exception
+    template<typename TType>
+    class event {
+      public:
+        [[nodiscard]] auto await_ready() const noexcept -> bool {
+            return m_done;
+        }
+
+        auto await_suspend(std::coroutine_handle<> waiter) noexcept -> void {
+            m_waiter = waiter;
+        }
+
+        auto await_resume() -> TType {
+            if(m_exception) {
+                std::rethrow_exception(m_exception);
+            }
+            return m_value;
+        }
+
+        auto set(TType value) -> void {
+            m_value = std::move(value);
+            finish();
+        }
+
+        auto fail(std::exception_ptr exception) -> void {
+            m_exception = std::move(exception);
+            finish();
+        }
+
+      private:
+        TType m_value{};
+        std::exception_ptr m_exception;
+        std::coroutine_handle<> m_waiter;
+        bool m_done = false;
+
+        auto finish() -> void {
+            m_done = true;
+            if(m_waiter) {
+                std::exchange(m_waiter, nullptr).resume();
+            }
+        }
+    };
+
+    /// @brief An awaitable that completes synchronously, and whose awaiter is a separate
+    /// object returned by `operator co_await`
+    struct ready {
+        [[nodiscard]] auto operator co_await() const noexcept {
+            struct awaiter {
+                [[nodiscard]] auto await_ready() const noexcept -> bool {
+                    return true;
+                }
+                auto await_suspend(std::coroutine_handle<> handle) const noexcept -> void {
+                    static_cast<void>(handle);
+                }
+                auto await_resume() const noexcept -> void {
+                }
+            };
+
+            return awaiter{};
+        }
+    };
+
+    /// @brief An awaitable that completes synchronously with a large awaiter, which is stored
+    /// in the frame of the coroutine awaiting it
+    struct large {
+        [[nodiscard]] auto operator co_await() const noexcept {
+            struct awaiter {
+                std::array<char, 512> padding{};
+
+                [[nodiscard]] auto await_ready() const noexcept -> bool {
+                    return true;
+                }
+                auto await_suspend(std::coroutine_handle<> handle) const noexcept -> void {
+                    static_cast<void>(handle);
+                }
+                [[nodiscard]] auto await_resume() const noexcept -> usize {
+                    return padding.size();
+                }
+            };
+
+            return awaiter{};
+        }
+    };
+
+    /// @brief An eagerly started coroutine running a test body, whose frame is allocated in
+    /// static storage so that the only global allocations are those of the code under test
+    struct driver {
+        struct promise_type {
+            static inline auto storage // NOLINT(*-avoid-non-const-global-variables)
+                = std::array<std::max_align_t, 256>{};
+
+            [[nodiscard]] static auto operator new(std::size_t size) -> void* {
+                if(size > sizeof(storage)) {
+                    throw std::bad_alloc{};
+                }
+                return storage.data();
+            }
+
+            static auto operator delete([[maybe_unused]] void* frame) noexcept -> void {
+            }
+
+            [[nodiscard]] auto get_return_object() const noexcept -> driver {
+                return {};
+            }
+
+            [[nodiscard]] auto initial_suspend() const noexcept -> std::suspend_never {
+                return {};
+            }
+
+            [[nodiscard]] auto final_suspend() const noexcept -> std::suspend_never {
+                return {};
+            }
+
+            auto return_void() const noexcept -> void {
+            }
+
+            [[noreturn]] auto unhandled_exception() const noexcept -> void {
+                std::terminate();
+            }
+        };
+    };
+
+    template<typename TResult>
+    struct outcome {
+        std::optional<TResult> result;
+        std::string error;
+        usize allocations = 0;
+    };
+
+    template<typename TCombinator, typename TResult>
+    auto await_into(TCombinator& combinator, outcome<TResult>& out) -> driver {
+        const auto before = allocations.load();
+        try {
+            out.result.emplace(co_await combinator);
+        }
+        catch(const std::runtime_error& error) {
+            out.error = error.what();
+        }
+        out.allocations = allocations.load() - before;
+    }
+
+    /// @brief Completes the awaitables in reverse order, checking that the awaiting
+    /// coroutine is only resumed by the last completion, with every result
+    auto when_all_completion_order() -> void {
+        auto first = event<std::string>{};
+        auto second = event<int>{};
+        auto combinator = when_all(first, second, ready{}, large{});
+        auto out = outcome<std::tuple<std::string, int, std::monostate, usize>>{};
+
+        await_into(combinator, out);
+        test::check(not out.result.has_value());
+        second.set(2);
+        test::check(not out.result.has_value());
+        first.set("first");
+
+        test::check(out.result.has_value());
+        test::check(out.result
+                    == std::tuple{std::string{"first"}, 2, std::monostate{}, 512_usize});
+        test::check(out.allocations == 0_usize);
+    }
+
+    /// @brief Fails both awaitables, the second first, checking that the exception of the
+    /// first in `List` order is rethrown
+    auto when_all_propagates_first_exception() -> void {
+        auto first = event<int>{};
+        auto second = event<int>{};
+        auto combinator = when_all(first, second);
+        auto out = outcome<std::tuple<int, int>>{};
+
+        await_into(combinator, out);
+        second.fail(std::make_exception_ptr(std::runtime_error("second")));
+        test::check(out.error.empty());
+        first.fail(std::make_exception_ptr(std::runtime_error("first")));
+
+        test::check(not out.result.has_value());
+        test::check(out.error == "first");
+    }
+
+    /// @brief Checks that `when_all` of no awaitables completes immediately
+    auto when_all_empty() -> void {
+        auto combinator = when_all();
+        auto out = outcome<std::tuple<>>{};
+        await_into(combinator, out);
+        test::check(out.result.has_value());
+    }
+
+    /// @brief Completes the second awaitable first, checking that its result is produced,
+    /// at its index, but only once every awaitable has completed
+    auto when_any_first_completion_wins() -> void {
+        auto first = event<int>{};
+        auto second = event<int>{};
+        auto combinator = when_any(first, second);
+        auto out = outcome<std::variant<int, int>>{};
+
+        await_into(combinator, out);
+        second.set(2);
+        test::check(not out.result.has_value());
+        first.set(1);
+
+        test::check(out.result.has_value());
+        test::check(out.result.has_value() && out.result->index() == 1_usize
+                    && std::get<1>(*out.result) == 2);
+        test::check(out.allocations == 0_usize);
+    }
+
+    /// @brief Checks that the exception of the first awaitable to complete is rethrown,
+    /// and that exceptions from later completions are discarded
+    auto when_any_propagates_first_exception() -> void {
+        auto first = event<int>{};
+        auto second = event<int>{};
+        auto combinator = when_any(first, second);
+        auto out = outcome<std::variant<int, int>>{};
+
+        await_into(combinator, out);
+        second.fail(std::make_exception_ptr(std::runtime_error("second")));
+        first.set(1);
+        test::check(not out.result.has_value());
+        test::check(out.error == "second");
+
+        auto third = event<int>{};
+        auto fourth = event<int>{};
+        auto other = when_any(third, fourth);
+        auto other_out = outcome<std::variant<int, int>>{};
+        await_into(other, other_out);
+        third.set(3);
+        fourth.fail(std::make_exception_ptr(std::runtime_error("fourth")));
+        test::check(other_out.error.empty());
+        test::check(other_out.result.has_value() && other_out.result->index() == 0_usize);
+    }
+} // namespace
+
+auto main() -> i32 {
+    when_all_completion_order();
+    when_all_propagates_first_exception();
+    when_all_empty();
+    when_any_first_completion_wins();
+    when_any_propagates_first_exception();
+
+    return test::result();
+}
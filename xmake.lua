@@ -14,6 +14,14 @@ option("hyperion_enable_tracy", function()
     set_default(false)
 end)
 
+option("hyperion_mpl_build_benchmarks", function()
+    set_default(false)
+end)
+
+option("hyperion_mpl_build_stress_tests", function()
+    set_default(false)
+end)
+
 add_requires("hyperion_platform", {
     system = false,
     external = true,
@@ -34,6 +42,29 @@ local hyperion_mpl_headers = {
     "$(projectdir)/include/hyperion/mpl/pair.h",
     "$(projectdir)/include/hyperion/mpl/type.h",
     "$(projectdir)/include/hyperion/mpl/type_traits.h",
+    "$(projectdir)/include/hyperion/mpl/pipeline.h",
+    "$(projectdir)/include/hyperion/mpl/spsc_queue.h",
+    "$(projectdir)/include/hyperion/mpl/when_all.h",
+    "$(projectdir)/include/hyperion/mpl/thread_pool.h",
+    "$(projectdir)/include/hyperion/mpl/search_table.h",
+    "$(projectdir)/include/hyperion/mpl/lut.h",
+    "$(projectdir)/include/hyperion/mpl/aggregate_hash.h",
+    "$(projectdir)/include/hyperion/mpl/fixed_string.h",
+    "$(projectdir)/include/hyperion/mpl/radix_sort.h",
+    "$(projectdir)/include/hyperion/mpl/record.h",
+    "$(projectdir)/include/hyperion/mpl/hot_cold.h",
+    "$(projectdir)/include/hyperion/mpl/concurrent_layout.h",
+    "$(projectdir)/include/hyperion/mpl/sharded_counters.h",
+    "$(projectdir)/include/hyperion/mpl/mpsc_queue.h",
+    "$(projectdir)/include/hyperion/mpl/event_bus.h",
+    "$(projectdir)/include/hyperion/mpl/inplace_function.h",
+    "$(projectdir)/include/hyperion/mpl/static_vector.h",
+    "$(projectdir)/include/hyperion/mpl/flat_map.h",
+    "$(projectdir)/include/hyperion/mpl/injector.h",
+    "$(projectdir)/include/hyperion/mpl/options.h",
+    "$(projectdir)/include/hyperion/mpl/json.h",
+    "$(projectdir)/include/hyperion/mpl/delta.h",
+    "$(projectdir)/include/hyperion/mpl/record_batch.h",
     "$(projectdir)/include/hyperion/mpl/value.h",
 }
 local hyperion_mpl_concepts_headers = {
@@ -41,6 +72,10 @@ local hyperion_mpl_concepts_headers = {
     "$(projectdir)/include/hyperion/mpl/concepts/operator_able.h",
     "$(projectdir)/include/hyperion/mpl/concepts/std_supplemental.h",
 }
+local hyperion_mpl_detail_headers = {
+    "$(projectdir)/include/hyperion/mpl/detail/all_distinct.h",
+    "$(projectdir)/include/hyperion/mpl/detail/perfect_hash.h",
+}
 local hyperion_mpl_type_traits_headers = {
     "$(projectdir)/include/hyperion/mpl/type_traits/is_comparable.h",
     "$(projectdir)/include/hyperion/mpl/type_traits/is_operator_able.h",
@@ -54,6 +89,7 @@ target("hyperion_mpl", function()
     add_headerfiles(hyperion_mpl_main_header, { prefixdir = "hyperion", public = true })
     add_headerfiles(hyperion_mpl_headers, { prefixdir = "hyperion/mpl", public = true })
     add_headerfiles(hyperion_mpl_concepts_headers, { prefixdir = "hyperion/mpl/concepts", public = true })
+    add_headerfiles(hyperion_mpl_detail_headers, { prefixdir = "hyperion/mpl/detail", public = true })
     add_headerfiles(hyperion_mpl_type_traits_headers, { prefixdir = "hyperion/mpl/type_traits", public = true })
     set_default(true)
     on_config(function(target)
@@ -63,6 +99,9 @@ target("hyperion_mpl", function()
     add_options("hyperion_enable_tracy", {public = true})
 
     add_packages("hyperion_platform", { public = true })
+    if is_plat("linux") then
+        add_syslinks("pthread", { public = true })
+    end
 end)
 
 target("hyperion_mpl_main", function()
@@ -78,6 +117,116 @@ target("hyperion_mpl_main", function()
     add_tests("hyperion_mpl_main")
 end)
 
+-- Exercises every `List` operation at 1K, 4K, and 16K elements, built only with
+-- `hyperion_mpl_build_stress_tests`
+if has_config("hyperion_mpl_build_stress_tests") then
+    target("hyperion_mpl_list_stress", function()
+        set_kind("binary")
+        set_languages("cxx20")
+        add_files("$(projectdir)/src/list_stress.cpp", { prefixdir = "hyperion/mpl" })
+        add_deps("hyperion_mpl")
+        set_default(true)
+        on_config(function(target)
+            import("hyperion_compiler_settings", { alias = "settings" })
+            settings.set_compiler_settings(target)
+        end)
+        add_tests("hyperion_mpl_list_stress")
+    end)
+end
+
+-- Runtime behavior tests, for what the `static_assert` tests in the headers can't check
+-- (threads, allocation, exceptions, non-`constexpr` code). Each is `src/test/<name>.cpp`
+local hyperion_mpl_runtime_tests = {
+    "spsc_queue",
+    "pipeline",
+    "when_all",
+    "thread_pool",
+    "aggregate_hash",
+    "radix_sort",
+    "sharded_counters",
+    "mpsc_queue",
+    "inplace_function",
+    "flat_map",
+    "injector",
+    "options",
+    "json",
+    "delta",
+    "record_batch",
+    "lut",
+    "hot_cold",
+    "event_bus",
+    "static_vector",
+}
+
+for _, test_name in ipairs(hyperion_mpl_runtime_tests) do
+    target("hyperion_mpl_test_" .. test_name, function()
+        set_kind("binary")
+        set_languages("cxx20")
+        add_files("$(projectdir)/src/test/" .. test_name .. ".cpp", { prefixdir = "hyperion/mpl" })
+        add_deps("hyperion_mpl")
+        set_default(true)
+        on_config(function(target)
+            import("hyperion_compiler_settings", { alias = "settings" })
+            settings.set_compiler_settings(target)
+        end)
+        add_tests("hyperion_mpl_test_" .. test_name)
+    end)
+end
+
+-- Benchmarks, built only with `hyperion_mpl_build_benchmarks`. Each is `src/bench/<name>.cpp`
+local hyperion_mpl_benchmarks = {
+    "pipeline",
+    "search_table",
+    "aggregate_hash",
+    "hot_cold",
+    "event_bus",
+    "inplace_function",
+    "static_vector",
+    "json",
+    "delta",
+    "record_batch",
+}
+
+-- Compile-time benchmark corpora, measured by compiling them with `src/bench/compile/measure.py`.
+-- They are built with the benchmarks to keep them compiling. Each is `src/bench/compile/<name>.cpp`
+local hyperion_mpl_compile_benchmarks = {
+    "list_symbols",
+    "list_algorithms",
+    "list_spellings",
+}
+
+if has_config("hyperion_mpl_build_benchmarks") then
+    for _, benchmark_name in ipairs(hyperion_mpl_benchmarks) do
+        target("hyperion_mpl_bench_" .. benchmark_name, function()
+            set_kind("binary")
+            set_languages("cxx20")
+            add_files("$(projectdir)/src/bench/" .. benchmark_name .. ".cpp",
+                      { prefixdir = "hyperion/mpl" })
+            add_deps("hyperion_mpl")
+            set_default(true)
+            on_config(function(target)
+                import("hyperion_compiler_settings", { alias = "settings" })
+                settings.set_compiler_settings(target)
+            end)
+        end)
+    end
+
+    for _, benchmark_name in ipairs(hyperion_mpl_compile_benchmarks) do
+        target("hyperion_mpl_compile_bench_" .. benchmark_name, function()
+            set_kind("binary")
+            set_languages("cxx20")
+            add_files("$(projectdir)/src/bench/compile/" .. benchmark_name .. ".cpp",
+                      { prefixdir = "hyperion/mpl" })
+            add_deps("hyperion_mpl")
+            set_default(true)
+            on_config(function(target)
+                import("hyperion_compiler_settings", { alias = "settings" })
+                settings.set_compiler_settings(target)
+            end)
+        end)
+    end
+end
+
 target("hyperion_mpl_docs", function()
     set_kind("phony")
     set_default(false)